@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////
+// camerapath.cpp
+// ============
+// replay a fixed camera flight through the 3D scene
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "CameraPath.h"
+
+#include <cmath>
+
+// declaration of global variables
+namespace
+{
+	/***********************************************************
+	 *  CatmullRom()
+	 *
+	 *  This function is used for interpolating between p1 and
+	 *  p2 along a Catmull-Rom spline through the four points.
+	 ***********************************************************/
+	glm::vec3 CatmullRom(
+		const glm::vec3& p0,
+		const glm::vec3& p1,
+		const glm::vec3& p2,
+		const glm::vec3& p3,
+		float t)
+	{
+		float t2 = t * t;
+		float t3 = t2 * t;
+
+		return(0.5f * ((2.0f * p1) +
+			(-p0 + p2) * t +
+			(2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 +
+			(-p0 + 3.0f * p1 - 3.0f * p2 + p3) * t3));
+	}
+}
+
+/***********************************************************
+ *  CameraPath()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+CameraPath::CameraPath()
+{
+}
+
+/***********************************************************
+ *  AddKey()
+ *
+ *  This method is used for adding a key pose to the end of
+ *  the path.
+ ***********************************************************/
+void CameraPath::AddKey(const glm::vec3& position, const glm::vec3& target)
+{
+	CAMERA_KEY key;
+	key.position = position;
+	key.target = target;
+	m_keys.push_back(key);
+}
+
+/***********************************************************
+ *  Clear()
+ *
+ *  This method is used for removing all the key poses.
+ ***********************************************************/
+void CameraPath::Clear()
+{
+	m_keys.clear();
+}
+
+/***********************************************************
+ *  Sample()
+ *
+ *  This method is used for getting the camera pose at the
+ *  passed in point of the looping path. The keys are spaced
+ *  evenly along the path and joined with Catmull-Rom splines,
+ *  so the camera moves without sudden turns.
+ ***********************************************************/
+CameraPath::CAMERA_KEY CameraPath::Sample(float pathTime) const
+{
+	CAMERA_KEY pose;
+	pose.position = glm::vec3(0.0f, 0.0f, 0.0f);
+	pose.target = glm::vec3(0.0f, 0.0f, -1.0f);
+
+	int keyCount = (int)m_keys.size();
+	if (keyCount == 0)
+	{
+		return(pose);
+	}
+	if (keyCount == 1)
+	{
+		return(m_keys[0]);
+	}
+
+	// wrap the path time into [0, 1)
+	pathTime = pathTime - std::floor(pathTime);
+
+	float keyTime = pathTime * keyCount;
+	int key = (int)keyTime;
+	float t = keyTime - key;
+
+	const CAMERA_KEY& k0 = m_keys[(key + keyCount - 1) % keyCount];
+	const CAMERA_KEY& k1 = m_keys[key % keyCount];
+	const CAMERA_KEY& k2 = m_keys[(key + 1) % keyCount];
+	const CAMERA_KEY& k3 = m_keys[(key + 2) % keyCount];
+
+	pose.position = CatmullRom(k0.position, k1.position, k2.position, k3.position, t);
+	pose.target = CatmullRom(k0.target, k1.target, k2.target, k3.target, t);
+
+	return(pose);
+}
+
+/***********************************************************
+ *  CreateDefaultPath()
+ *
+ *  This method is used for creating a flight around the room
+ *  of the final project scene, passing the dumbbell racks,
+ *  the kickboxing stand and the mirrors.
+ ***********************************************************/
+CameraPath CameraPath::CreateDefaultPath()
+{
+	CameraPath path;
+
+	path.AddKey(glm::vec3(0.0f, 5.0f, 12.0f), glm::vec3(0.0f, 2.5f, -8.0f));
+	path.AddKey(glm::vec3(9.0f, 6.0f, 6.0f), glm::vec3(2.0f, 1.0f, -8.5f));
+	path.AddKey(glm::vec3(10.0f, 3.0f, -3.0f), glm::vec3(-4.0f, 0.5f, -8.5f));
+	path.AddKey(glm::vec3(0.0f, 2.5f, -4.0f), glm::vec3(-12.0f, 0.5f, 5.0f));
+	path.AddKey(glm::vec3(-7.0f, 4.0f, 0.0f), glm::vec3(-12.5f, 0.5f, 7.5f));
+	path.AddKey(glm::vec3(-8.0f, 7.0f, 9.0f), glm::vec3(4.0f, 2.0f, -6.0f));
+
+	return(path);
+}
@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////////
+// camerapath.h
+// ============
+// replay a fixed camera flight through the 3D scene
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+/***********************************************************
+ *  CameraPath
+ *
+ *  This class holds a looping list of camera key poses and
+ *  computes a smooth camera pose anywhere along the path, so
+ *  the same flight can be replayed for every benchmark run.
+ ***********************************************************/
+class CameraPath
+{
+public:
+	// constructor
+	CameraPath();
+
+	// a camera pose along the path
+	struct CAMERA_KEY
+	{
+		glm::vec3 position;
+		glm::vec3 target;
+	};
+
+	// add a key pose to the end of the path
+	void AddKey(const glm::vec3& position, const glm::vec3& target);
+	// remove all the key poses
+	void Clear();
+	int GetKeyCount() const { return((int)m_keys.size()); }
+
+	// get the camera pose at a point of the path, where 0 is
+	// the first key and 1 is back at the first key again
+	CAMERA_KEY Sample(float pathTime) const;
+
+	// a flight around the room of the final project scene
+	static CameraPath CreateDefaultPath();
+
+private:
+	std::vector<CAMERA_KEY> m_keys;
+};
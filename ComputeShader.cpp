@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////
+// computeshader.cpp
+// ============
+// compile compute shader files into programs
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ComputeShader.h"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+/***********************************************************
+ *  LoadProgram()
+ *
+ *  This method is used for compiling and linking a
+ *  compute shader file into a program, returning 0 and
+ *  printing the log when either step fails.
+ ***********************************************************/
+GLuint ComputeShader::LoadProgram(const char* filename)
+{
+	std::ifstream file(filename);
+	if (!file)
+	{
+		std::cout << "Could not open compute shader: " << filename << std::endl;
+		return(0);
+	}
+	std::stringstream stream;
+	stream << file.rdbuf();
+	std::string source = stream.str();
+	const char* pSource = source.c_str();
+
+	GLint bSuccess = GL_FALSE;
+	char log[1024];
+
+	GLuint shader = glCreateShader(GL_COMPUTE_SHADER);
+	glShaderSource(shader, 1, &pSource, NULL);
+	glCompileShader(shader);
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &bSuccess);
+	if (bSuccess == GL_FALSE)
+	{
+		glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+		std::cout << "Compute shader compilation failed: " << filename << std::endl << log << std::endl;
+		glDeleteShader(shader);
+		return(0);
+	}
+
+	GLuint program = glCreateProgram();
+	glAttachShader(program, shader);
+	glLinkProgram(program);
+	glDeleteShader(shader);
+	glGetProgramiv(program, GL_LINK_STATUS, &bSuccess);
+	if (bSuccess == GL_FALSE)
+	{
+		glGetProgramInfoLog(program, sizeof(log), NULL, log);
+		std::cout << "Compute shader linking failed: " << filename << std::endl << log << std::endl;
+		glDeleteProgram(program);
+		return(0);
+	}
+
+	return(program);
+}
@@ -0,0 +1,25 @@
+///////////////////////////////////////////////////////////////////////////////
+// computeshader.h
+// ============
+// compile compute shader files into programs
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <GL/glew.h>
+
+/***********************************************************
+ *  ComputeShader
+ *
+ *  This class loads the compute passes that run next to the
+ *  scene shader, which ShaderManager only builds from a
+ *  vertex and a fragment shader.
+ ***********************************************************/
+class ComputeShader
+{
+public:
+	// compile and link a compute shader file into a program,
+	// returning 0 and printing the log when either step fails
+	static GLuint LoadProgram(const char* filename);
+};
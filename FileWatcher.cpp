@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////
+// filewatcher.cpp
+// ============
+// notice when the files the running scene was loaded from are changed
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FileWatcher.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+// declaration of the global variables
+namespace
+{
+	// seconds between two checks of the files, unless set
+	const double g_DefaultPollInterval = 0.5;
+}
+
+/***********************************************************
+ *  FileWatcher()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+FileWatcher::FileWatcher()
+{
+	m_pollInterval = g_DefaultPollInterval;
+	m_lastPoll = std::chrono::steady_clock::now();
+}
+
+/***********************************************************
+ *  Watch()
+ *
+ *  This method is used for adding a file to the watched
+ *  files. Its current state is the one changes are found
+ *  against, and a file that does not exist yet is reported
+ *  once it has been created.
+ ***********************************************************/
+int FileWatcher::Watch(const std::string& filename)
+{
+	WATCHED_FILE file;
+	file.filename = filename;
+	GetFileStamp(filename, file.modifiedTime, file.size);
+	file.pendingTime = file.modifiedTime;
+	file.pendingSize = file.size;
+	file.bPending = false;
+	m_files.push_back(file);
+
+	return((int)m_files.size() - 1);
+}
+
+/***********************************************************
+ *  Poll()
+ *
+ *  This method is used for checking the watched files once
+ *  the poll interval has passed since the last check. A new
+ *  time or size is held back until the next check finds it
+ *  unchanged, and is only then reported. Files that were
+ *  deleted are not reported until they are back.
+ ***********************************************************/
+bool FileWatcher::Poll(std::vector<int>& changedIDs)
+{
+	changedIDs.clear();
+
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	if (std::chrono::duration<double>(now - m_lastPoll).count() < m_pollInterval)
+	{
+		return(false);
+	}
+	m_lastPoll = now;
+
+	for (int i = 0; i < m_files.size(); i++)
+	{
+		WATCHED_FILE& file = m_files[i];
+
+		uint64_t modifiedTime = 0;
+		uint64_t size = 0;
+		GetFileStamp(file.filename, modifiedTime, size);
+		if ((modifiedTime == 0) && (size == 0))
+		{
+			file.bPending = false;
+			continue;
+		}
+
+		if ((modifiedTime == file.modifiedTime) && (size == file.size))
+		{
+			file.bPending = false;
+		}
+		else if ((file.bPending == true) && (modifiedTime == file.pendingTime) && (size == file.pendingSize))
+		{
+			file.modifiedTime = modifiedTime;
+			file.size = size;
+			file.bPending = false;
+			changedIDs.push_back(i);
+		}
+		else
+		{
+			file.pendingTime = modifiedTime;
+			file.pendingSize = size;
+			file.bPending = true;
+		}
+	}
+
+	return(changedIDs.empty() == false);
+}
+
+/***********************************************************
+ *  GetFileStamp()
+ *
+ *  This method is used for getting the modified time and the
+ *  size of a file. The time is kept in the finest steps the
+ *  file system has - 100 ns on Windows and nanoseconds
+ *  elsewhere - as whole seconds would miss a save of the
+ *  same size within the second of the last check.
+ ***********************************************************/
+void FileWatcher::GetFileStamp(const std::string& filename, uint64_t& modifiedTime, uint64_t& size)
+{
+	modifiedTime = 0;
+	size = 0;
+
+#ifdef _WIN32
+	WIN32_FILE_ATTRIBUTE_DATA info;
+	if (GetFileAttributesExA(filename.c_str(), GetFileExInfoStandard, &info) == 0)
+	{
+		return;
+	}
+	modifiedTime = ((uint64_t)info.ftLastWriteTime.dwHighDateTime << 32) | info.ftLastWriteTime.dwLowDateTime;
+	size = ((uint64_t)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+#else
+	struct stat info;
+	if (stat(filename.c_str(), &info) != 0)
+	{
+		return;
+	}
+#ifdef __APPLE__
+	const struct timespec& modified = info.st_mtimespec;
+#else
+	const struct timespec& modified = info.st_mtim;
+#endif
+	modifiedTime = (uint64_t)modified.tv_sec * 1000000000ull + (uint64_t)modified.tv_nsec;
+	size = (uint64_t)info.st_size;
+#endif
+}
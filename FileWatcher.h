@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////
+// filewatcher.h
+// ============
+// notice when the files the running scene was loaded from are changed
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/***********************************************************
+ *  FileWatcher
+ *
+ *  This class checks the modified time and size of a set of
+ *  files at a fixed interval. A change is only reported once
+ *  the file has kept its new time and size for a whole
+ *  interval, so a file that an editor writes in several
+ *  steps is reported once, after it has been written.
+ ***********************************************************/
+class FileWatcher
+{
+public:
+	// constructor
+	FileWatcher();
+
+	// start watching a file, returning the ID its changes are
+	// reported with
+	int Watch(const std::string& filename);
+	const std::string& GetFilename(int fileID) const { return(m_files[fileID].filename); }
+
+	// set the seconds between two checks of the files
+	void SetPollInterval(double seconds) { m_pollInterval = seconds; }
+
+	// check the files when the interval has passed, filling in
+	// the IDs of the files that changed, and returning true
+	// when there are any
+	bool Poll(std::vector<int>& changedIDs);
+
+private:
+	struct WATCHED_FILE
+	{
+		std::string filename;
+		// time and size the file was last reported with
+		uint64_t modifiedTime;
+		uint64_t size;
+		// new time and size waiting to settle
+		uint64_t pendingTime;
+		uint64_t pendingSize;
+		bool bPending;
+	};
+
+	std::vector<WATCHED_FILE> m_files;
+	double m_pollInterval;
+	std::chrono::steady_clock::time_point m_lastPoll;
+
+	// get the modified time and size of a file, both 0 when
+	// the file does not exist
+	static void GetFileStamp(const std::string& filename, uint64_t& modifiedTime, uint64_t& size);
+};
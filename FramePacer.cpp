@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////
+// framepacer.cpp
+// ============
+// hold the frame rate at a cap with evenly spaced frames
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FramePacer.h"
+
+#include <thread>
+
+// declaration of the global variables
+namespace
+{
+	// the end of a wait is spun instead of slept, as a sleep
+	// can overshoot by about a scheduler tick
+	const std::chrono::microseconds g_SpinTime(1500);
+}
+
+/***********************************************************
+ *  FramePacer()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+FramePacer::FramePacer()
+{
+	m_frameRateCap = 0.0;
+	m_frameDuration = CLOCK::duration::zero();
+	m_bStarted = false;
+}
+
+/***********************************************************
+ *  SetFrameRateCap()
+ *
+ *  This method is used for setting the highest frame rate,
+ *  or turning the cap off with 0. The spacing starts over
+ *  from the next frame.
+ ***********************************************************/
+void FramePacer::SetFrameRateCap(double framesPerSecond)
+{
+	m_frameRateCap = (framesPerSecond > 0.0) ? framesPerSecond : 0.0;
+	m_frameDuration = CLOCK::duration::zero();
+	if (m_frameRateCap > 0.0)
+	{
+		m_frameDuration = std::chrono::duration_cast<CLOCK::duration>(std::chrono::duration<double>(1.0 / m_frameRateCap));
+	}
+	m_bStarted = false;
+}
+
+/***********************************************************
+ *  WaitForNextFrame()
+ *
+ *  This method is used for waiting until the deadline of
+ *  the next frame, then moving the deadline on by one frame.
+ *  A frame that finishes more than a whole frame late moves
+ *  the deadline to now, so the frames after it are not run
+ *  back to back to catch up.
+ ***********************************************************/
+void FramePacer::WaitForNextFrame()
+{
+	if (m_frameRateCap <= 0.0)
+	{
+		return;
+	}
+
+	CLOCK::time_point now = CLOCK::now();
+	if ((m_bStarted == false) || (now - m_nextFrame > m_frameDuration))
+	{
+		m_nextFrame = now;
+		m_bStarted = true;
+	}
+
+	if (m_nextFrame - now > g_SpinTime)
+	{
+		std::this_thread::sleep_until(m_nextFrame - g_SpinTime);
+	}
+	while (CLOCK::now() < m_nextFrame)
+	{
+		std::this_thread::yield();
+	}
+
+	m_nextFrame += m_frameDuration;
+}
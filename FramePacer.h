@@ -0,0 +1,41 @@
+///////////////////////////////////////////////////////////////////////////////
+// framepacer.h
+// ============
+// hold the frame rate at a cap with evenly spaced frames
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <chrono>
+
+/***********************************************************
+ *  FramePacer
+ *
+ *  This class waits out the rest of each frame's share of
+ *  the capped frame rate. Frames are spaced from a running
+ *  deadline rather than from when the last one finished, so
+ *  the rate holds even when single frames run long, and the
+ *  wait sleeps most of the way so the CPU and GPU idle.
+ ***********************************************************/
+class FramePacer
+{
+public:
+	// constructor
+	FramePacer();
+
+	// set the highest frame rate, 0 for no cap
+	void SetFrameRateCap(double framesPerSecond);
+	double GetFrameRateCap() const { return(m_frameRateCap); }
+
+	// wait until the next frame may start
+	void WaitForNextFrame();
+
+private:
+	typedef std::chrono::steady_clock CLOCK;
+
+	double m_frameRateCap;
+	CLOCK::duration m_frameDuration;
+	CLOCK::time_point m_nextFrame;
+	bool m_bStarted;
+};
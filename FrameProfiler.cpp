@@ -0,0 +1,544 @@
+///////////////////////////////////////////////////////////////////////////////
+// frameprofiler.cpp
+// ============
+// measure the CPU and GPU time of every frame and keep rolling statistics
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "FrameProfiler.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+// declaration of global variables
+namespace
+{
+	// number of recent frames covered by default
+	const int g_DefaultHistorySize = 240;
+}
+
+/***********************************************************
+ *  FrameProfiler()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+FrameProfiler::FrameProfiler()
+{
+	m_historySize = g_DefaultHistorySize;
+	m_frameCount = 0;
+	m_gpuQueries[0] = 0;
+	m_gpuQueries[1] = 0;
+	m_bQueryPending[0] = false;
+	m_bQueryPending[1] = false;
+	m_currentQuery = 0;
+	m_bInitialized = false;
+	m_lastGPUTime = 0.0;
+
+	for (int i = 0; i < METRIC_COUNT; i++)
+	{
+		m_frameValues[i] = 0.0;
+	}
+	ClearHistory();
+}
+
+/***********************************************************
+ *  ~FrameProfiler()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+FrameProfiler::~FrameProfiler()
+{
+	Destroy();
+}
+
+/***********************************************************
+ *  Initialize()
+ *
+ *  This method is used for creating the GPU timer queries.
+ *  It needs a current OpenGL context.
+ ***********************************************************/
+void FrameProfiler::Initialize()
+{
+	if (m_bInitialized == true)
+	{
+		return;
+	}
+
+	glGenQueries(2, m_gpuQueries);
+	m_bQueryPending[0] = false;
+	m_bQueryPending[1] = false;
+	m_currentQuery = 0;
+	m_bInitialized = true;
+}
+
+/***********************************************************
+ *  Destroy()
+ *
+ *  This method is used for freeing the GPU timer queries and
+ *  closing the CSV file.
+ ***********************************************************/
+void FrameProfiler::Destroy()
+{
+	if (m_bInitialized == true)
+	{
+		glDeleteQueries(2, m_gpuQueries);
+		m_gpuQueries[0] = 0;
+		m_gpuQueries[1] = 0;
+		m_bInitialized = false;
+	}
+	CloseCSV();
+}
+
+/***********************************************************
+ *  SetHistorySize()
+ *
+ *  This method is used for setting how many of the most
+ *  recent frames the statistics cover. The recorded frames
+ *  are cleared.
+ ***********************************************************/
+void FrameProfiler::SetHistorySize(int frameCount)
+{
+	m_historySize = std::max(frameCount, 1);
+	ClearHistory();
+}
+
+/***********************************************************
+ *  ClearHistory()
+ *
+ *  This method is used for forgetting all the recorded
+ *  frames.
+ ***********************************************************/
+void FrameProfiler::ClearHistory()
+{
+	for (int i = 0; i < METRIC_COUNT; i++)
+	{
+		m_history[i].samples.assign(m_historySize, 0.0);
+		m_history[i].nextSample = 0;
+		m_history[i].sampleCount = 0;
+	}
+	m_frameCount = 0;
+}
+
+/***********************************************************
+ *  BeginFrame()
+ *
+ *  This method is used for marking the start of a frame. Any
+ *  GPU timer query that has finished by now is read back,
+ *  without waiting for the ones that have not.
+ ***********************************************************/
+void FrameProfiler::BeginFrame()
+{
+	for (int i = 0; i < METRIC_COUNT; i++)
+	{
+		m_frameValues[i] = 0.0;
+	}
+
+	if (m_bInitialized == true)
+	{
+		for (int query = 0; query < 2; query++)
+		{
+			ReadGPUQuery(query);
+		}
+	}
+
+	m_frameStart = CLOCK::now();
+}
+
+/***********************************************************
+ *  EndFrame()
+ *
+ *  This method is used for marking the end of a frame and
+ *  adding its values to the rolling statistics and the CSV
+ *  file.
+ ***********************************************************/
+void FrameProfiler::EndFrame()
+{
+	m_frameValues[METRIC_FRAME] = ElapsedMilliseconds(m_frameStart, CLOCK::now());
+
+	for (int i = 0; i < METRIC_COUNT; i++)
+	{
+		// GPU times are added once they are read back
+		if (i != METRIC_GPU)
+		{
+			AddSample(i, m_frameValues[i]);
+		}
+	}
+
+	if (m_csvFile.is_open() == true)
+	{
+		m_csvFile << m_frameCount;
+		for (int section = 0; section < SECTION_COUNT; section++)
+		{
+			m_csvFile << "," << m_frameValues[section];
+		}
+		m_csvFile << "," << m_frameValues[METRIC_FRAME] << "," << m_lastGPUTime;
+		for (int counter = 0; counter < COUNTER_COUNT; counter++)
+		{
+			m_csvFile << "," << m_frameValues[METRIC_FIRST_COUNTER + counter];
+		}
+		m_csvFile << "\n";
+	}
+
+	m_frameCount++;
+}
+
+/***********************************************************
+ *  BeginSection()
+ *
+ *  This method is used for marking the start of a timed CPU
+ *  section of the frame.
+ ***********************************************************/
+void FrameProfiler::BeginSection(PROFILE_SECTION section)
+{
+	if ((section < 0) || (section >= SECTION_COUNT))
+	{
+		return;
+	}
+
+	m_sectionStart[section] = CLOCK::now();
+}
+
+/***********************************************************
+ *  EndSection()
+ *
+ *  This method is used for marking the end of a timed CPU
+ *  section. A section that runs more than once per frame
+ *  adds up its times.
+ ***********************************************************/
+void FrameProfiler::EndSection(PROFILE_SECTION section)
+{
+	if ((section < 0) || (section >= SECTION_COUNT))
+	{
+		return;
+	}
+
+	m_frameValues[section] += ElapsedMilliseconds(m_sectionStart[section], CLOCK::now());
+}
+
+/***********************************************************
+ *  BeginGPUTimer()
+ *
+ *  This method is used for starting the GPU timer query of
+ *  the frame. When the query from two frames ago has still
+ *  not finished, its result is dropped instead of waited on.
+ ***********************************************************/
+void FrameProfiler::BeginGPUTimer()
+{
+	if (m_bInitialized == false)
+	{
+		return;
+	}
+
+	m_bQueryPending[m_currentQuery] = false;
+	glBeginQuery(GL_TIME_ELAPSED, m_gpuQueries[m_currentQuery]);
+}
+
+/***********************************************************
+ *  EndGPUTimer()
+ *
+ *  This method is used for ending the GPU timer query of the
+ *  frame and switching to the other query for the next one.
+ ***********************************************************/
+void FrameProfiler::EndGPUTimer()
+{
+	if (m_bInitialized == false)
+	{
+		return;
+	}
+
+	glEndQuery(GL_TIME_ELAPSED);
+	m_bQueryPending[m_currentQuery] = true;
+	m_currentQuery = 1 - m_currentQuery;
+}
+
+/***********************************************************
+ *  ReadGPUQuery()
+ *
+ *  This method is used for reading back the result of the
+ *  passed in GPU timer query if it is available.
+ ***********************************************************/
+void FrameProfiler::ReadGPUQuery(int query)
+{
+	if (m_bQueryPending[query] == false)
+	{
+		return;
+	}
+
+	GLint bAvailable = GL_FALSE;
+	glGetQueryObjectiv(m_gpuQueries[query], GL_QUERY_RESULT_AVAILABLE, &bAvailable);
+	if (bAvailable == GL_FALSE)
+	{
+		return;
+	}
+
+	GLuint64 elapsedNanoseconds = 0;
+	glGetQueryObjectui64v(m_gpuQueries[query], GL_QUERY_RESULT, &elapsedNanoseconds);
+	m_bQueryPending[query] = false;
+
+	m_lastGPUTime = (double)elapsedNanoseconds / 1000000.0;
+	AddSample(METRIC_GPU, m_lastGPUTime);
+}
+
+/***********************************************************
+ *  SetCounter()
+ *
+ *  This method is used for setting the value of a counter
+ *  for the frame being recorded.
+ ***********************************************************/
+void FrameProfiler::SetCounter(PROFILE_COUNTER counter, double value)
+{
+	if ((counter < 0) || (counter >= COUNTER_COUNT))
+	{
+		return;
+	}
+
+	m_frameValues[METRIC_FIRST_COUNTER + counter] = value;
+}
+
+/***********************************************************
+ *  OpenCSV()
+ *
+ *  This method is used for opening a CSV file that every
+ *  following frame is written to as one row. The GPU column
+ *  holds the most recent GPU time that was read back, which
+ *  lags the frame by one or two frames.
+ ***********************************************************/
+bool FrameProfiler::OpenCSV(const std::string& filename)
+{
+	CloseCSV();
+
+	m_csvFile.open(filename.c_str(), std::ios::out | std::ios::trunc);
+	if (m_csvFile.is_open() == false)
+	{
+		std::cout << "Could not open profiler CSV file:" << filename << std::endl;
+		return(false);
+	}
+
+	m_csvFile << "frame";
+	for (int section = 0; section < SECTION_COUNT; section++)
+	{
+		m_csvFile << "," << GetSectionName((PROFILE_SECTION)section) << "_ms";
+	}
+	m_csvFile << ",frame_ms,gpu_ms";
+	for (int counter = 0; counter < COUNTER_COUNT; counter++)
+	{
+		m_csvFile << "," << GetCounterName((PROFILE_COUNTER)counter);
+	}
+	m_csvFile << "\n";
+
+	return(true);
+}
+
+/***********************************************************
+ *  CloseCSV()
+ *
+ *  This method is used for closing the CSV file.
+ ***********************************************************/
+void FrameProfiler::CloseCSV()
+{
+	if (m_csvFile.is_open() == true)
+	{
+		m_csvFile.close();
+	}
+}
+
+/***********************************************************
+ *  AddSample()
+ *
+ *  This method is used for adding a sample to the history of
+ *  a metric, replacing the oldest one when it is full.
+ ***********************************************************/
+void FrameProfiler::AddSample(int metric, double value)
+{
+	METRIC_HISTORY& history = m_history[metric];
+
+	history.samples[history.nextSample] = value;
+	history.nextSample = (history.nextSample + 1) % m_historySize;
+	history.sampleCount = std::min(history.sampleCount + 1, m_historySize);
+}
+
+/***********************************************************
+ *  ComputeStats()
+ *
+ *  This method is used for computing the statistics of the
+ *  recorded samples of a metric.
+ ***********************************************************/
+FrameProfiler::METRIC_STATS FrameProfiler::ComputeStats(int metric) const
+{
+	const METRIC_HISTORY& history = m_history[metric];
+
+	METRIC_STATS stats;
+	stats.minimum = 0.0;
+	stats.average = 0.0;
+	stats.median = 0.0;
+	stats.p99 = 0.0;
+	stats.maximum = 0.0;
+	stats.sampleCount = history.sampleCount;
+
+	if (history.sampleCount == 0)
+	{
+		return(stats);
+	}
+
+	std::vector<double> sorted(history.samples.begin(), history.samples.begin() + history.sampleCount);
+	std::sort(sorted.begin(), sorted.end());
+
+	double total = 0.0;
+	for (int i = 0; i < sorted.size(); i++)
+	{
+		total += sorted[i];
+	}
+
+	stats.minimum = sorted.front();
+	stats.maximum = sorted.back();
+	stats.average = total / sorted.size();
+	stats.median = sorted[(sorted.size() - 1) / 2];
+	stats.p99 = sorted[((sorted.size() - 1) * 99) / 100];
+
+	return(stats);
+}
+
+/***********************************************************
+ *  GetFrameStats()
+ *
+ *  This method is used for getting the statistics of the
+ *  whole frame time.
+ ***********************************************************/
+FrameProfiler::METRIC_STATS FrameProfiler::GetFrameStats() const
+{
+	return(ComputeStats(METRIC_FRAME));
+}
+
+/***********************************************************
+ *  GetSectionStats()
+ *
+ *  This method is used for getting the statistics of the
+ *  CPU time of a section.
+ ***********************************************************/
+FrameProfiler::METRIC_STATS FrameProfiler::GetSectionStats(PROFILE_SECTION section) const
+{
+	if ((section < 0) || (section >= SECTION_COUNT))
+	{
+		return(ComputeStats(METRIC_FRAME));
+	}
+
+	return(ComputeStats(section));
+}
+
+/***********************************************************
+ *  GetGPUStats()
+ *
+ *  This method is used for getting the statistics of the
+ *  GPU time of the timed commands.
+ ***********************************************************/
+FrameProfiler::METRIC_STATS FrameProfiler::GetGPUStats() const
+{
+	return(ComputeStats(METRIC_GPU));
+}
+
+/***********************************************************
+ *  GetCounterStats()
+ *
+ *  This method is used for getting the statistics of a per
+ *  frame counter.
+ ***********************************************************/
+FrameProfiler::METRIC_STATS FrameProfiler::GetCounterStats(PROFILE_COUNTER counter) const
+{
+	if ((counter < 0) || (counter >= COUNTER_COUNT))
+	{
+		counter = COUNTER_DRAW_CALLS;
+	}
+
+	return(ComputeStats(METRIC_FIRST_COUNTER + counter));
+}
+
+/***********************************************************
+ *  GetSummary()
+ *
+ *  This method is used for building a one line summary of
+ *  the rolling averages and p99 values, short enough to be
+ *  shown in the window title.
+ ***********************************************************/
+std::string FrameProfiler::GetSummary() const
+{
+	std::ostringstream summary;
+	summary << std::fixed << std::setprecision(2);
+
+	METRIC_STATS frame = GetFrameStats();
+	METRIC_STATS gpu = GetGPUStats();
+	summary << "frame " << frame.average << "/" << frame.p99 << " ms";
+	summary << " | gpu " << gpu.average << "/" << gpu.p99 << " ms";
+
+	for (int section = 0; section < SECTION_COUNT; section++)
+	{
+		METRIC_STATS stats = GetSectionStats((PROFILE_SECTION)section);
+		summary << " | " << GetSectionName((PROFILE_SECTION)section) << " " << stats.average << "/" << stats.p99;
+	}
+
+	summary << std::setprecision(0);
+	for (int counter = 0; counter < COUNTER_COUNT; counter++)
+	{
+		summary << " | " << GetCounterName((PROFILE_COUNTER)counter) << " " << GetCounterStats((PROFILE_COUNTER)counter).average;
+	}
+
+	return(summary.str());
+}
+
+/***********************************************************
+ *  GetSectionName()
+ *
+ *  This method is used for getting the display name of a
+ *  timed section.
+ ***********************************************************/
+const char* FrameProfiler::GetSectionName(PROFILE_SECTION section)
+{
+	switch (section)
+	{
+	case SECTION_PREPARE_VIEW:
+		return("view");
+	case SECTION_RENDER_SCENE:
+		return("render");
+	case SECTION_SWAP_BUFFERS:
+		return("swap");
+	default:
+		return("unknown");
+	}
+}
+
+/***********************************************************
+ *  GetCounterName()
+ *
+ *  This method is used for getting the display name of a
+ *  per frame counter.
+ ***********************************************************/
+const char* FrameProfiler::GetCounterName(PROFILE_COUNTER counter)
+{
+	switch (counter)
+	{
+	case COUNTER_DRAW_CALLS:
+		return("draws");
+	case COUNTER_UNIFORM_UPLOADS:
+		return("uniforms");
+	case COUNTER_TEXTURE_BINDS:
+		return("texbinds");
+	case COUNTER_VISIBLE_ITEMS:
+		return("visible");
+	case COUNTER_CULLED_ITEMS:
+		return("culled");
+	default:
+		return("unknown");
+	}
+}
+
+/***********************************************************
+ *  ElapsedMilliseconds()
+ *
+ *  This method is used for getting the milliseconds between
+ *  two time points.
+ ***********************************************************/
+double FrameProfiler::ElapsedMilliseconds(CLOCK::time_point start, CLOCK::time_point end)
+{
+	return(std::chrono::duration<double, std::milli>(end - start).count());
+}
@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////
+// frameprofiler.h
+// ============
+// measure the CPU and GPU time of every frame and keep rolling statistics
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <GL/glew.h>
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/***********************************************************
+ *  FrameProfiler
+ *
+ *  This class records the CPU time of the main sections of
+ *  every frame, the GPU time of the scene rendering and a set
+ *  of per frame counters. The GPU time is measured with two
+ *  alternating timer queries, so a result is only read back
+ *  one frame after it was issued and the CPU never waits for
+ *  the GPU. Rolling statistics are kept over the most recent
+ *  frames, and every frame can also be written to a CSV file.
+ ***********************************************************/
+class FrameProfiler
+{
+public:
+	// constructor
+	FrameProfiler();
+	// destructor
+	~FrameProfiler();
+
+	// timed CPU sections of a frame
+	enum PROFILE_SECTION
+	{
+		SECTION_PREPARE_VIEW = 0,
+		SECTION_RENDER_SCENE,
+		SECTION_SWAP_BUFFERS,
+		SECTION_COUNT
+	};
+
+	// values counted once per frame
+	enum PROFILE_COUNTER
+	{
+		COUNTER_DRAW_CALLS = 0,
+		COUNTER_UNIFORM_UPLOADS,
+		COUNTER_TEXTURE_BINDS,
+		COUNTER_VISIBLE_ITEMS,
+		COUNTER_CULLED_ITEMS,
+		COUNTER_COUNT
+	};
+
+	// statistics of one metric over the recorded frames
+	struct METRIC_STATS
+	{
+		double minimum;
+		double average;
+		double median;
+		double p99;
+		double maximum;
+		int sampleCount;
+	};
+
+	// create the GPU timer queries - needs a current context
+	void Initialize();
+	// free the GPU timer queries and close the CSV file
+	void Destroy();
+
+	// set how many recent frames the statistics cover
+	void SetHistorySize(int frameCount);
+	// forget all the recorded frames
+	void ClearHistory();
+
+	// mark the start and the end of a frame
+	void BeginFrame();
+	void EndFrame();
+
+	// mark the start and the end of a timed CPU section
+	void BeginSection(PROFILE_SECTION section);
+	void EndSection(PROFILE_SECTION section);
+
+	// mark the GPU commands that are timed for this frame
+	void BeginGPUTimer();
+	void EndGPUTimer();
+
+	// set the value of a counter for this frame
+	void SetCounter(PROFILE_COUNTER counter, double value);
+
+	// write every following frame as a row of a CSV file
+	bool OpenCSV(const std::string& filename);
+	void CloseCSV();
+
+	// statistics over the recorded frames, in milliseconds
+	// for the timings
+	METRIC_STATS GetFrameStats() const;
+	METRIC_STATS GetSectionStats(PROFILE_SECTION section) const;
+	METRIC_STATS GetGPUStats() const;
+	METRIC_STATS GetCounterStats(PROFILE_COUNTER counter) const;
+
+	// one line summary of the rolling statistics
+	std::string GetSummary() const;
+	// number of frames recorded since the history was cleared
+	int GetFrameCount() const { return(m_frameCount); }
+
+	static const char* GetSectionName(PROFILE_SECTION section);
+	static const char* GetCounterName(PROFILE_COUNTER counter);
+
+private:
+	typedef std::chrono::steady_clock CLOCK;
+
+	// ring buffer of the recent samples of one metric
+	struct METRIC_HISTORY
+	{
+		std::vector<double> samples;
+		int nextSample;
+		int sampleCount;
+	};
+
+	// metric slots - the sections first, then the whole
+	// frame, the GPU time and the counters
+	enum
+	{
+		METRIC_FRAME = SECTION_COUNT,
+		METRIC_GPU,
+		METRIC_FIRST_COUNTER,
+		METRIC_COUNT = METRIC_FIRST_COUNTER + COUNTER_COUNT
+	};
+
+	METRIC_HISTORY m_history[METRIC_COUNT];
+	int m_historySize;
+	int m_frameCount;
+
+	CLOCK::time_point m_frameStart;
+	CLOCK::time_point m_sectionStart[SECTION_COUNT];
+	// values of the frame being recorded
+	double m_frameValues[METRIC_COUNT];
+
+	// alternating GPU timer queries
+	GLuint m_gpuQueries[2];
+	// true while a query holds a result that was not read back yet
+	bool m_bQueryPending[2];
+	// query used by the frame being recorded
+	int m_currentQuery;
+	bool m_bInitialized;
+	// most recent GPU time that was read back
+	double m_lastGPUTime;
+
+	std::ofstream m_csvFile;
+
+	// add a sample to the history of a metric
+	void AddSample(int metric, double value);
+	// compute the statistics of a metric history
+	METRIC_STATS ComputeStats(int metric) const;
+	// read the result of a finished GPU timer query
+	void ReadGPUQuery(int query);
+	// milliseconds between two time points
+	static double ElapsedMilliseconds(CLOCK::time_point start, CLOCK::time_point end);
+};
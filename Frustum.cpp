@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////
+// frustum.cpp
+// ============
+// test bounding volumes against the view frustum of a camera
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "Frustum.h"
+
+/***********************************************************
+ *  Frustum()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+Frustum::Frustum()
+{
+	// start with planes that let everything through
+	for (int i = 0; i < PLANE_COUNT; i++)
+	{
+		m_planes[i] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+	}
+}
+
+/***********************************************************
+ *  Update()
+ *
+ *  This method is used for extracting the six clip planes
+ *  from the combined projection and view matrix. Each plane
+ *  is a sum or difference of the fourth row and one of the
+ *  other rows, and is normalized so the plane equation gives
+ *  the signed distance to a point.
+ ***********************************************************/
+void Frustum::Update(const glm::mat4& view, const glm::mat4& projection)
+{
+	glm::mat4 clip = projection * view;
+
+	// glm matrices are stored by column, so gather the rows
+	glm::vec4 rows[4];
+	for (int row = 0; row < 4; row++)
+	{
+		rows[row] = glm::vec4(clip[0][row], clip[1][row], clip[2][row], clip[3][row]);
+	}
+
+	m_planes[PLANE_LEFT] = rows[3] + rows[0];
+	m_planes[PLANE_RIGHT] = rows[3] - rows[0];
+	m_planes[PLANE_BOTTOM] = rows[3] + rows[1];
+	m_planes[PLANE_TOP] = rows[3] - rows[1];
+	m_planes[PLANE_NEAR] = rows[3] + rows[2];
+	m_planes[PLANE_FAR] = rows[3] - rows[2];
+
+	for (int i = 0; i < PLANE_COUNT; i++)
+	{
+		float length = glm::length(glm::vec3(m_planes[i]));
+		if (length > 0.0f)
+		{
+			m_planes[i] /= length;
+		}
+	}
+}
+
+/***********************************************************
+ *  IsSphereVisible()
+ *
+ *  This method is used for testing whether the passed in
+ *  sphere is at least partly on the inner side of every clip
+ *  plane.
+ ***********************************************************/
+bool Frustum::IsSphereVisible(const glm::vec3& center, float radius) const
+{
+	for (int i = 0; i < PLANE_COUNT; i++)
+	{
+		if (glm::dot(glm::vec3(m_planes[i]), center) + m_planes[i].w < -radius)
+		{
+			return(false);
+		}
+	}
+
+	return(true);
+}
+
+/***********************************************************
+ *  IsBoxVisible()
+ *
+ *  This method is used for testing whether the passed in
+ *  axis aligned box is at least partly on the inner side of
+ *  every clip plane. Only the box corner furthest along each
+ *  plane normal needs to be checked.
+ ***********************************************************/
+bool Frustum::IsBoxVisible(const glm::vec3& boundsMin, const glm::vec3& boundsMax) const
+{
+	for (int i = 0; i < PLANE_COUNT; i++)
+	{
+		glm::vec3 normal = glm::vec3(m_planes[i]);
+		glm::vec3 corner(
+			(normal.x >= 0.0f) ? boundsMax.x : boundsMin.x,
+			(normal.y >= 0.0f) ? boundsMax.y : boundsMin.y,
+			(normal.z >= 0.0f) ? boundsMax.z : boundsMin.z);
+
+		if (glm::dot(normal, corner) + m_planes[i].w < 0.0f)
+		{
+			return(false);
+		}
+	}
+
+	return(true);
+}
@@ -0,0 +1,52 @@
+///////////////////////////////////////////////////////////////////////////////
+// frustum.h
+// ============
+// test bounding volumes against the view frustum of a camera
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <glm/glm.hpp>
+
+/***********************************************************
+ *  Frustum
+ *
+ *  This class holds the six clip planes of a view volume,
+ *  taken straight from the combined projection and view
+ *  matrix, so it works the same for perspective and
+ *  orthographic projections. Bounding spheres and boxes
+ *  in world space can be tested against it.
+ ***********************************************************/
+class Frustum
+{
+public:
+	// constructor
+	Frustum();
+
+	// clip planes of the view volume
+	enum FRUSTUM_PLANE
+	{
+		PLANE_LEFT = 0,
+		PLANE_RIGHT,
+		PLANE_BOTTOM,
+		PLANE_TOP,
+		PLANE_NEAR,
+		PLANE_FAR,
+		PLANE_COUNT
+	};
+
+	// extract the clip planes from the view and projection
+	void Update(const glm::mat4& view, const glm::mat4& projection);
+
+	// true when any part of the sphere may be inside the frustum
+	bool IsSphereVisible(const glm::vec3& center, float radius) const;
+	// true when any part of the box may be inside the frustum
+	bool IsBoxVisible(const glm::vec3& boundsMin, const glm::vec3& boundsMax) const;
+
+	// get a clip plane, xyz = inward normal and w = distance
+	const glm::vec4& GetPlane(FRUSTUM_PLANE plane) const { return(m_planes[plane]); }
+
+private:
+	glm::vec4 m_planes[PLANE_COUNT];
+};
@@ -0,0 +1,225 @@
+///////////////////////////////////////////////////////////////////////////////
+// geometryarena.cpp
+// ============
+// pack many meshes of one vertex layout into a single pair of GPU buffers
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "GeometryArena.h"
+
+#include <algorithm>
+
+// declaration of the global variables
+namespace
+{
+	// smallest number of vertices and indices the buffers are
+	// created with once the first mesh is added
+	const GLuint g_MinimumVertexCapacity = 4096;
+	const GLuint g_MinimumIndexCapacity = 16384;
+}
+
+/***********************************************************
+ *  GeometryArena()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+GeometryArena::GeometryArena()
+{
+	m_vertexStride = 0;
+	m_vertexCount = 0;
+	m_vertexCapacity = 0;
+	m_indexCount = 0;
+	m_indexCapacity = 0;
+}
+
+/***********************************************************
+ *  Create()
+ *
+ *  This method is used for creating the vertex array of the
+ *  arena for vertices of the passed in size and attributes.
+ *  The buffers are left empty until the first mesh is added.
+ ***********************************************************/
+void GeometryArena::Create(GLsizei vertexStride, const VERTEX_ATTRIBUTE* pAttributes, int attributeCount)
+{
+	Destroy();
+
+	m_vertexStride = vertexStride;
+	m_attributes.assign(pAttributes, pAttributes + attributeCount);
+
+	m_vao.Create();
+	m_vertexBuffer.Create(GpuResourceTracker::RESOURCE_VERTEX_BUFFER);
+	m_indexBuffer.Create(GpuResourceTracker::RESOURCE_INDEX_BUFFER);
+	SetVertexAttributes();
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+/***********************************************************
+ *  Destroy()
+ *
+ *  This method is used for freeing the vertex array and both
+ *  buffers of the arena.
+ ***********************************************************/
+void GeometryArena::Destroy()
+{
+	m_vao.Destroy();
+	m_vertexBuffer.Destroy();
+	m_indexBuffer.Destroy();
+	m_attributes.clear();
+	m_vertexStride = 0;
+	m_vertexCount = 0;
+	m_vertexCapacity = 0;
+	m_indexCount = 0;
+	m_indexCapacity = 0;
+}
+
+/***********************************************************
+ *  Add()
+ *
+ *  This method is used for appending a mesh after the ones
+ *  already in the arena. Its indices are kept as they are,
+ *  counting from its first vertex, which the draw calls pass
+ *  as the base vertex. A buffer that is too small is doubled
+ *  until the mesh fits, keeping the meshes already in it.
+ ***********************************************************/
+GeometryArena::ARENA_RANGE GeometryArena::Add(const void* pVertices, GLuint vertexCount, const uint32_t* pIndices, GLuint indexCount)
+{
+	ARENA_RANGE range;
+	range.baseVertex = (GLint)m_vertexCount;
+	range.vertexCount = vertexCount;
+	range.firstIndex = m_indexCount;
+	range.indexCount = indexCount;
+
+	if (IsCreated() == false)
+	{
+		range.vertexCount = 0;
+		range.indexCount = 0;
+		return(range);
+	}
+
+	bool bGrown = false;
+	if (m_vertexCount + vertexCount > m_vertexCapacity)
+	{
+		GLuint capacity = std::max(m_vertexCapacity, g_MinimumVertexCapacity);
+		while (capacity < m_vertexCount + vertexCount)
+		{
+			capacity *= 2;
+		}
+		GrowBuffer(m_vertexBuffer, GpuResourceTracker::RESOURCE_VERTEX_BUFFER,
+			(size_t)m_vertexCount * m_vertexStride, (size_t)capacity * m_vertexStride);
+		m_vertexCapacity = capacity;
+		bGrown = true;
+	}
+	if (m_indexCount + indexCount > m_indexCapacity)
+	{
+		GLuint capacity = std::max(m_indexCapacity, g_MinimumIndexCapacity);
+		while (capacity < m_indexCount + indexCount)
+		{
+			capacity *= 2;
+		}
+		GrowBuffer(m_indexBuffer, GpuResourceTracker::RESOURCE_INDEX_BUFFER,
+			(size_t)m_indexCount * sizeof(uint32_t), (size_t)capacity * sizeof(uint32_t));
+		m_indexCapacity = capacity;
+		bGrown = true;
+	}
+	if (bGrown == true)
+	{
+		SetVertexAttributes();
+		glBindVertexArray(0);
+	}
+
+	// the copy targets leave the element binding of whatever
+	// vertex array is bound alone
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_vertexBuffer.GetID());
+	glBufferSubData(GL_COPY_WRITE_BUFFER, (size_t)m_vertexCount * m_vertexStride, (size_t)vertexCount * m_vertexStride, pVertices);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_indexBuffer.GetID());
+	glBufferSubData(GL_COPY_WRITE_BUFFER, (size_t)m_indexCount * sizeof(uint32_t), (size_t)indexCount * sizeof(uint32_t), pIndices);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	m_vertexCount += vertexCount;
+	m_indexCount += indexCount;
+
+	return(range);
+}
+
+/***********************************************************
+ *  Reset()
+ *
+ *  This method is used for forgetting every mesh of the
+ *  arena. The buffers keep their size, so meshes added again
+ *  afterwards are written into the same storage.
+ ***********************************************************/
+void GeometryArena::Reset()
+{
+	m_vertexCount = 0;
+	m_indexCount = 0;
+}
+
+/***********************************************************
+ *  Bind()
+ *
+ *  This method is used for binding the vertex array that
+ *  every mesh of the arena is drawn with.
+ ***********************************************************/
+void GeometryArena::Bind() const
+{
+	glBindVertexArray(m_vao.GetID());
+}
+
+/***********************************************************
+ *  GrowBuffer()
+ *
+ *  This method is used for replacing a buffer with a larger
+ *  one, copying the used part of the old buffer on the GPU.
+ ***********************************************************/
+void GeometryArena::GrowBuffer(GpuBuffer& buffer, GpuResourceTracker::RESOURCE_CATEGORY category, size_t usedBytes, size_t newBytes)
+{
+	GpuBuffer grown;
+	grown.Create(category);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, grown.GetID());
+	glBufferData(GL_COPY_WRITE_BUFFER, newBytes, NULL, GL_STATIC_DRAW);
+	grown.SetSize(newBytes);
+
+	if (usedBytes > 0)
+	{
+		glBindBuffer(GL_COPY_READ_BUFFER, buffer.GetID());
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, usedBytes);
+		glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	}
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	buffer = std::move(grown);
+}
+
+/***********************************************************
+ *  SetVertexAttributes()
+ *
+ *  This method is used for pointing the attributes of the
+ *  arena at its vertex buffer and binding its index buffer
+ *  to the vertex array, which is left bound. Attributes that
+ *  the owner added for other buffers are not changed.
+ ***********************************************************/
+void GeometryArena::SetVertexAttributes()
+{
+	glBindVertexArray(m_vao.GetID());
+	glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer.GetID());
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer.GetID());
+
+	for (int i = 0; i < m_attributes.size(); i++)
+	{
+		const VERTEX_ATTRIBUTE& attribute = m_attributes[i];
+		if (attribute.bInteger == true)
+		{
+			glVertexAttribIPointer(attribute.location, attribute.componentCount, attribute.type,
+				m_vertexStride, (void*)attribute.offset);
+		}
+		else
+		{
+			glVertexAttribPointer(attribute.location, attribute.componentCount, attribute.type,
+				(attribute.bNormalized == true) ? GL_TRUE : GL_FALSE, m_vertexStride, (void*)attribute.offset);
+		}
+		glEnableVertexAttribArray(attribute.location);
+	}
+}
@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////
+// geometryarena.h
+// ============
+// pack many meshes of one vertex layout into a single pair of GPU buffers
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GpuResource.h"
+
+#include <GL/glew.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/***********************************************************
+ *  GeometryArena
+ *
+ *  This class owns one vertex buffer, one index buffer and
+ *  the vertex array that reads them. Meshes are appended one
+ *  after the other, and each one is drawn as a range of the
+ *  shared buffers from its first index and base vertex, so
+ *  drawing different meshes needs no vertex array changes
+ *  and one indirect command buffer can cover all of them.
+ *  The buffers double in size when a mesh does not fit.
+ ***********************************************************/
+class GeometryArena
+{
+public:
+	// constructor
+	GeometryArena();
+
+	// one attribute read per vertex from the vertex buffer
+	struct VERTEX_ATTRIBUTE
+	{
+		GLuint location;
+		GLint componentCount;
+		GLenum type;
+		// read as integers instead of converted to floats
+		bool bInteger;
+		// map integers to 0 to 1 or -1 to 1 when converted
+		bool bNormalized;
+		size_t offset;
+	};
+
+	// place of one mesh in the arena, its indices count from
+	// its own first vertex
+	struct ARENA_RANGE
+	{
+		GLint baseVertex;
+		GLuint vertexCount;
+		GLuint firstIndex;
+		GLuint indexCount;
+	};
+
+	// create the vertex array for vertices of the passed in
+	// size and attributes
+	void Create(GLsizei vertexStride, const VERTEX_ATTRIBUTE* pAttributes, int attributeCount);
+	// free the vertex array and both buffers
+	void Destroy();
+	bool IsCreated() const { return(m_vao.GetID() != 0); }
+
+	// append a mesh, growing the buffers when it does not fit
+	ARENA_RANGE Add(const void* pVertices, GLuint vertexCount, const uint32_t* pIndices, GLuint indexCount);
+	// forget every mesh, keeping the buffers for the next ones
+	void Reset();
+
+	// bind the vertex array every mesh of the arena is drawn with
+	void Bind() const;
+	GLuint GetVertexArrayID() const { return(m_vao.GetID()); }
+	// byte offset of a range's first index in the index buffer
+	static const void* GetIndexOffset(const ARENA_RANGE& range) { return((const void*)(range.firstIndex * sizeof(uint32_t))); }
+
+	GLuint GetVertexCount() const { return(m_vertexCount); }
+	GLuint GetIndexCount() const { return(m_indexCount); }
+
+private:
+	GpuVertexArray m_vao;
+	GpuBuffer m_vertexBuffer;
+	GpuBuffer m_indexBuffer;
+	GLsizei m_vertexStride;
+	std::vector<VERTEX_ATTRIBUTE> m_attributes;
+	// vertices and indices in use, and the room for them
+	GLuint m_vertexCount;
+	GLuint m_vertexCapacity;
+	GLuint m_indexCount;
+	GLuint m_indexCapacity;
+
+	// move the used part of a buffer into a new larger one
+	static void GrowBuffer(GpuBuffer& buffer, GpuResourceTracker::RESOURCE_CATEGORY category, size_t usedBytes, size_t newBytes);
+	// point the attributes of the vertex array at the vertex
+	// buffer and bind the index buffer to it
+	void SetVertexAttributes();
+};
@@ -0,0 +1,460 @@
+///////////////////////////////////////////////////////////////////////////////
+// gpuculler.cpp
+// ============
+// cull the instanced batches on the GPU with a compute pass
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "GpuCuller.h"
+#include "ComputeShader.h"
+#include "IndirectCommandBuffer.h"
+#include "InstancedMeshes.h"
+#include "PrimitiveGeometry.h"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+
+// declaration of the global variables
+namespace
+{
+	// storage buffer binding points of the cull pass
+	const GLuint g_SourceInstanceBinding = 0;
+	const GLuint g_CulledInstanceBinding = 1;
+	const GLuint g_CommandBinding = 2;
+	const GLuint g_BatchBinding = 3;
+	const GLuint g_CounterBinding = 4;
+	// image units of the pyramid pass
+	const GLuint g_SourceLevelUnit = 0;
+	const GLuint g_DestinationLevelUnit = 1;
+	// texture unit above the units of the texture arrays
+	const GLint g_DepthTextureUnit = 31;
+	// invocations in one work group of each pass
+	const GLuint g_CullGroupSize = 64;
+	const GLuint g_PyramidGroupSize = 8;
+}
+
+/***********************************************************
+ *  GpuCuller()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+GpuCuller::GpuCuller()
+{
+	m_cullProgram = 0;
+	m_pyramidProgram = 0;
+	m_instanceCapacity = 0;
+	m_commandCapacity = 0;
+	m_batchCapacity = 0;
+	m_batchCount = 0;
+	m_instanceCount = 0;
+	m_pyramidWidth = 0;
+	m_pyramidHeight = 0;
+	m_pyramidLevelCount = 0;
+	m_pyramidViewProjection = glm::mat4(1.0f);
+	m_bPyramidValid = false;
+	m_bReady = false;
+	for (int i = 0; i < COUNT_READBACK_COUNT; i++)
+	{
+		m_countReadbacks[i].fence = 0;
+	}
+	m_nextCountReadback = 0;
+	m_visibleInstanceCount = -1;
+}
+
+/***********************************************************
+ *  ~GpuCuller()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+GpuCuller::~GpuCuller()
+{
+	Destroy();
+}
+
+/***********************************************************
+ *  Initialize()
+ *
+ *  This method is used for loading the cull and depth
+ *  pyramid programs and creating the buffers they write.
+ ***********************************************************/
+bool GpuCuller::Initialize(const char* cullShaderPath, const char* pyramidShaderPath)
+{
+	Destroy();
+
+	m_cullProgram = ComputeShader::LoadProgram(cullShaderPath);
+	m_pyramidProgram = ComputeShader::LoadProgram(pyramidShaderPath);
+	if ((m_cullProgram == 0) || (m_pyramidProgram == 0))
+	{
+		Destroy();
+		return(false);
+	}
+
+	m_instanceBuffer.Create(GpuResourceTracker::RESOURCE_INSTANCE_BUFFER);
+	m_commandBuffer.Create(GpuResourceTracker::RESOURCE_STORAGE_BUFFER);
+	m_batchBuffer.Create(GpuResourceTracker::RESOURCE_STORAGE_BUFFER);
+	for (int i = 0; i < COUNT_READBACK_COUNT; i++)
+	{
+		COUNT_READBACK& readback = m_countReadbacks[i];
+		readback.buffer.Create(GpuResourceTracker::RESOURCE_STORAGE_BUFFER);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, readback.buffer.GetID());
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(GLuint), NULL, GL_DYNAMIC_READ);
+		readback.buffer.SetSize(sizeof(GLuint));
+	}
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+	// the local bounds of the meshes never change
+	glm::vec4 meshCenters[MESH_COUNT];
+	glm::vec4 meshExtents[MESH_COUNT];
+	for (int i = 0; i < MESH_COUNT; i++)
+	{
+		glm::vec3 localMin;
+		glm::vec3 localMax;
+		PrimitiveGeometry::GetLocalBounds((MESH_TYPE)i, localMin, localMax);
+		meshCenters[i] = glm::vec4((localMin + localMax) * 0.5f, 0.0f);
+		meshExtents[i] = glm::vec4((localMax - localMin) * 0.5f, 0.0f);
+	}
+
+	GLint previousProgram = 0;
+	glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+
+	glUseProgram(m_cullProgram);
+	glUniform4fv(glGetUniformLocation(m_cullProgram, "meshCenters"), MESH_COUNT, glm::value_ptr(meshCenters[0]));
+	glUniform4fv(glGetUniformLocation(m_cullProgram, "meshExtents"), MESH_COUNT, glm::value_ptr(meshExtents[0]));
+	glUniform1i(glGetUniformLocation(m_cullProgram, "depthPyramid"), g_DepthTextureUnit);
+	glUseProgram(m_pyramidProgram);
+	glUniform1i(glGetUniformLocation(m_pyramidProgram, "depthTexture"), g_DepthTextureUnit);
+	glUseProgram(previousProgram);
+
+	m_bReady = true;
+	return(true);
+}
+
+/***********************************************************
+ *  Destroy()
+ *
+ *  This method is used for freeing the compute programs,
+ *  the buffers and the depth textures.
+ ***********************************************************/
+void GpuCuller::Destroy()
+{
+	if (m_cullProgram != 0)
+	{
+		glDeleteProgram(m_cullProgram);
+		m_cullProgram = 0;
+	}
+	if (m_pyramidProgram != 0)
+	{
+		glDeleteProgram(m_pyramidProgram);
+		m_pyramidProgram = 0;
+	}
+
+	m_instanceBuffer.Destroy();
+	m_instanceCapacity = 0;
+	m_commandBuffer.Destroy();
+	m_commandCapacity = 0;
+	m_batchBuffer.Destroy();
+	m_batchCapacity = 0;
+	m_batchCount = 0;
+	m_instanceCount = 0;
+	m_depthTexture.Destroy();
+	m_pyramidTexture.Destroy();
+	m_pyramidWidth = 0;
+	m_pyramidHeight = 0;
+	m_pyramidLevelCount = 0;
+	m_bPyramidValid = false;
+	m_bReady = false;
+	for (int i = 0; i < COUNT_READBACK_COUNT; i++)
+	{
+		COUNT_READBACK& readback = m_countReadbacks[i];
+		if (readback.fence != 0)
+		{
+			glDeleteSync(readback.fence);
+			readback.fence = 0;
+		}
+		readback.buffer.Destroy();
+	}
+	m_nextCountReadback = 0;
+	m_visibleInstanceCount = -1;
+}
+
+/***********************************************************
+ *  ReserveBuffer()
+ *
+ *  This method is used for growing a buffer to hold at least
+ *  the passed in bytes. The buffer object is kept, so vertex
+ *  arrays reading it stay valid.
+ ***********************************************************/
+void GpuCuller::ReserveBuffer(GpuBuffer& buffer, size_t& capacity, size_t bytes)
+{
+	if (bytes <= capacity)
+	{
+		return;
+	}
+
+	capacity = std::max(bytes, capacity * 2);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer.GetID());
+	glBufferData(GL_SHADER_STORAGE_BUFFER, capacity, NULL, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+	buffer.SetSize(capacity);
+}
+
+/***********************************************************
+ *  SetBatches()
+ *
+ *  This method is used for uploading the batches that the
+ *  following passes cull, sorted by their first instance.
+ ***********************************************************/
+void GpuCuller::SetBatches(const std::vector<CULL_BATCH>& batches, int instanceCount)
+{
+	if (m_bReady == false)
+	{
+		return;
+	}
+
+	m_batchCount = (int)batches.size();
+	m_instanceCount = instanceCount;
+	ReserveBuffer(m_instanceBuffer, m_instanceCapacity, std::max(instanceCount, 1) * sizeof(InstancedMeshes::INSTANCE_DATA));
+	ReserveBuffer(m_batchBuffer, m_batchCapacity, std::max(m_batchCount, 1) * sizeof(CULL_BATCH));
+	if (m_batchCount > 0)
+	{
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_batchBuffer.GetID());
+		glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, m_batchCount * sizeof(CULL_BATCH), batches.data());
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+	}
+}
+
+/***********************************************************
+ *  Cull()
+ *
+ *  This method is used for running the cull pass. The
+ *  commands are copied from the passed in buffer, where the
+ *  opaque commands hold zero instances, and the pass adds
+ *  every visible instance to its command. The barrier makes
+ *  the results visible to the indirect draws that follow.
+ *  The instances are only tested against the depth pyramid
+ *  when it is asked for and one has been built. A counted
+ *  pass also adds every visible instance to the next free
+ *  counter of the ring, and is skipped when all of them are
+ *  still on their way.
+ ***********************************************************/
+void GpuCuller::Cull(
+	const Frustum& frustum,
+	bool bFrustumTest,
+	bool bOcclusionTest,
+	bool bCountVisible,
+	GLuint sourceInstances,
+	GLuint commandBuffer,
+	size_t commandOffset,
+	int commandCount)
+{
+	if ((m_bReady == false) || (commandCount <= 0) || (m_instanceCount <= 0))
+	{
+		return;
+	}
+
+	size_t commandBytes = commandCount * sizeof(IndirectCommandBuffer::DRAW_COMMAND);
+	ReserveBuffer(m_commandBuffer, m_commandCapacity, commandBytes);
+	glBindBuffer(GL_COPY_READ_BUFFER, commandBuffer);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_commandBuffer.GetID());
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, commandOffset, 0, commandBytes);
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	GLint previousProgram = 0;
+	glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+
+	glm::vec4 planes[Frustum::PLANE_COUNT];
+	for (int i = 0; i < Frustum::PLANE_COUNT; i++)
+	{
+		planes[i] = frustum.GetPlane((Frustum::FRUSTUM_PLANE)i);
+	}
+
+	glUseProgram(m_cullProgram);
+	glUniform1ui(glGetUniformLocation(m_cullProgram, "instanceCount"), (GLuint)m_instanceCount);
+	glUniform1ui(glGetUniformLocation(m_cullProgram, "batchCount"), (GLuint)m_batchCount);
+	glUniform4fv(glGetUniformLocation(m_cullProgram, "frustumPlanes"), Frustum::PLANE_COUNT, glm::value_ptr(planes[0]));
+	glUniform1i(glGetUniformLocation(m_cullProgram, "bFrustumTest"), bFrustumTest ? 1 : 0);
+	glUniform1i(glGetUniformLocation(m_cullProgram, "bOcclusionTest"), ((bOcclusionTest == true) && (m_bPyramidValid == true)) ? 1 : 0);
+	glUniformMatrix4fv(glGetUniformLocation(m_cullProgram, "occlusionViewProjection"), 1, GL_FALSE, glm::value_ptr(m_pyramidViewProjection));
+	glUniform1i(glGetUniformLocation(m_cullProgram, "pyramidLevelCount"), m_pyramidLevelCount);
+
+	COUNT_READBACK* pReadback = nullptr;
+	if (bCountVisible == true)
+	{
+		CollectVisibleCounts();
+		if (m_countReadbacks[m_nextCountReadback].fence == 0)
+		{
+			const GLuint zero = 0;
+			pReadback = &m_countReadbacks[m_nextCountReadback];
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, pReadback->buffer.GetID());
+			glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(GLuint), &zero);
+			glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+			glBindBufferBase(GL_SHADER_STORAGE_BUFFER, g_CounterBinding, pReadback->buffer.GetID());
+		}
+	}
+	glUniform1i(glGetUniformLocation(m_cullProgram, "bCountVisible"), (pReadback != nullptr) ? 1 : 0);
+
+	glActiveTexture(GL_TEXTURE0 + g_DepthTextureUnit);
+	glBindTexture(GL_TEXTURE_2D, m_pyramidTexture.GetID());
+	glActiveTexture(GL_TEXTURE0);
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, g_SourceInstanceBinding, sourceInstances);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, g_CulledInstanceBinding, m_instanceBuffer.GetID());
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, g_CommandBinding, m_commandBuffer.GetID());
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, g_BatchBinding, m_batchBuffer.GetID());
+
+	GLuint groupCount = ((GLuint)m_instanceCount + g_CullGroupSize - 1) / g_CullGroupSize;
+	glDispatchCompute(groupCount, 1, 1);
+	glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+
+	if (pReadback != nullptr)
+	{
+		// the counter is read with glGetBufferSubData() once
+		// the fence has passed
+		glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+		pReadback->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_nextCountReadback = (m_nextCountReadback + 1) % COUNT_READBACK_COUNT;
+	}
+
+	// the scene shader is current again for the draws
+	glUseProgram(previousProgram);
+}
+
+/***********************************************************
+ *  CollectVisibleCounts()
+ *
+ *  This method is used for reading the counters of the
+ *  counted passes that the GPU has finished, without waiting
+ *  for the others. The passes finish in the order they were
+ *  issued, so the first one still running ends the search.
+ ***********************************************************/
+void GpuCuller::CollectVisibleCounts()
+{
+	for (int i = 0; i < COUNT_READBACK_COUNT; i++)
+	{
+		COUNT_READBACK& readback = m_countReadbacks[(m_nextCountReadback + i) % COUNT_READBACK_COUNT];
+		if (readback.fence == 0)
+		{
+			continue;
+		}
+
+		GLenum result = glClientWaitSync(readback.fence, 0, 0);
+		if ((result != GL_ALREADY_SIGNALED) && (result != GL_CONDITION_SATISFIED))
+		{
+			break;
+		}
+		glDeleteSync(readback.fence);
+		readback.fence = 0;
+
+		GLuint count = 0;
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, readback.buffer.GetID());
+		glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(GLuint), &count);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+		m_visibleInstanceCount = (int)count;
+	}
+}
+
+/***********************************************************
+ *  CreatePyramid()
+ *
+ *  This method is used for creating the depth buffer copy and
+ *  the full mip chain of the pyramid for the passed in size.
+ ***********************************************************/
+void GpuCuller::CreatePyramid(int width, int height)
+{
+	m_pyramidWidth = width;
+	m_pyramidHeight = height;
+	m_pyramidLevelCount = 1;
+	while ((std::max(width, height) >> m_pyramidLevelCount) > 0)
+	{
+		m_pyramidLevelCount++;
+	}
+
+	m_depthTexture.Create();
+	glBindTexture(GL_TEXTURE_2D, m_depthTexture.GetID());
+	glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH_COMPONENT32F, width, height);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	m_depthTexture.SetSize((size_t)width * height * sizeof(float));
+
+	m_pyramidTexture.Create();
+	glBindTexture(GL_TEXTURE_2D, m_pyramidTexture.GetID());
+	glTexStorage2D(GL_TEXTURE_2D, m_pyramidLevelCount, GL_R32F, width, height);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	size_t pyramidBytes = 0;
+	for (int level = 0; level < m_pyramidLevelCount; level++)
+	{
+		pyramidBytes += (size_t)std::max(width >> level, 1) * std::max(height >> level, 1) * sizeof(float);
+	}
+	m_pyramidTexture.SetSize(pyramidBytes);
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+/***********************************************************
+ *  BuildDepthPyramid()
+ *
+ *  This method is used for copying the depth buffer of the
+ *  frame that was just drawn and reducing it level by level,
+ *  each texel keeping the farthest depth below it. The next
+ *  frame tests its instances against this pyramid with the
+ *  passed in view, so a box is only culled when everything
+ *  it covers was already closer to the camera.
+ ***********************************************************/
+void GpuCuller::BuildDepthPyramid(const glm::mat4& viewProjection)
+{
+	if (m_bReady == false)
+	{
+		return;
+	}
+
+	GLint viewport[4] = { 0, 0, 0, 0 };
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	if ((viewport[2] <= 0) || (viewport[3] <= 0))
+	{
+		return;
+	}
+	if ((viewport[2] != m_pyramidWidth) || (viewport[3] != m_pyramidHeight))
+	{
+		CreatePyramid(viewport[2], viewport[3]);
+	}
+
+	GLint previousProgram = 0;
+	glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+
+	glActiveTexture(GL_TEXTURE0 + g_DepthTextureUnit);
+	glBindTexture(GL_TEXTURE_2D, m_depthTexture.GetID());
+	glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, viewport[0], viewport[1], viewport[2], viewport[3]);
+
+	glUseProgram(m_pyramidProgram);
+	GLint fromDepthLocation = glGetUniformLocation(m_pyramidProgram, "bFromDepth");
+	for (int level = 0; level < m_pyramidLevelCount; level++)
+	{
+		int levelWidth = std::max(m_pyramidWidth >> level, 1);
+		int levelHeight = std::max(m_pyramidHeight >> level, 1);
+
+		glUniform1i(fromDepthLocation, (level == 0) ? 1 : 0);
+		if (level > 0)
+		{
+			glBindImageTexture(g_SourceLevelUnit, m_pyramidTexture.GetID(), level - 1, GL_FALSE, 0, GL_READ_ONLY, GL_R32F);
+		}
+		glBindImageTexture(g_DestinationLevelUnit, m_pyramidTexture.GetID(), level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+
+		glDispatchCompute(
+			(levelWidth + g_PyramidGroupSize - 1) / g_PyramidGroupSize,
+			(levelHeight + g_PyramidGroupSize - 1) / g_PyramidGroupSize,
+			1);
+		glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+	}
+	glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glActiveTexture(GL_TEXTURE0);
+	glUseProgram(previousProgram);
+
+	m_pyramidViewProjection = viewProjection;
+	m_bPyramidValid = true;
+}
@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////////
+// gpuculler.h
+// ============
+// cull the instanced batches on the GPU with a compute pass
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Frustum.h"
+#include "GpuResource.h"
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+#include <vector>
+
+/***********************************************************
+ *  GpuCuller
+ *
+ *  This class tests every instance of the indirect draws
+ *  against the view frustum and a depth pyramid built from
+ *  the depth buffer of the last frame. The visible instances
+ *  are compacted into a buffer of their own, and the instance
+ *  counts of a copy of the indirect commands are filled in by
+ *  the same pass, so the CPU never looks at single instances.
+ *  The pass can also count the visible instances into a
+ *  small buffer that is read back a frame or two later,
+ *  once its fence has passed, so the count never stalls.
+ ***********************************************************/
+class GpuCuller
+{
+public:
+	// constructor
+	GpuCuller();
+	// destructor
+	~GpuCuller();
+
+	// one instanced batch as seen by the cull pass - matches
+	// the CULL_BATCH struct of the compute shader
+	struct CULL_BATCH
+	{
+		GLuint firstInstance;
+		GLuint instanceCount;
+		// indirect command drawing the batch
+		GLuint command;
+		// mesh type, plus BATCH_TRANSPARENT
+		GLuint flags;
+	};
+
+	// the instances of a transparent batch keep their order,
+	// so hidden ones are collapsed instead of removed
+	static const GLuint BATCH_TRANSPARENT = 0x100;
+	// counted cull passes that can be on their way at once
+	static const int COUNT_READBACK_COUNT = 3;
+
+	// load the compute programs and create the buffers
+	bool Initialize(const char* cullShaderPath, const char* pyramidShaderPath);
+	// free the programs, buffers and textures
+	void Destroy();
+	// true once the compute programs have been loaded
+	bool IsReady() const { return(m_bReady); }
+
+	// set the batches that the next passes cull
+	void SetBatches(const std::vector<CULL_BATCH>& batches, int instanceCount);
+	// cull the instances of the source buffer, starting from a
+	// copy of the passed in commands with zero opaque instances.
+	// The occlusion test only fits the view the depth pyramid
+	// was built from, so other views turn it off, and only the
+	// view asking for it has its visible instances counted
+	void Cull(
+		const Frustum& frustum,
+		bool bFrustumTest,
+		bool bOcclusionTest,
+		bool bCountVisible,
+		GLuint sourceInstances,
+		GLuint commandBuffer,
+		size_t commandOffset,
+		int commandCount);
+	// build the depth pyramid from the depth buffer of the
+	// frame that was just drawn with the passed in view
+	void BuildDepthPyramid(const glm::mat4& viewProjection);
+
+	// buffers read by the culled indirect draws
+	GLuint GetCommandBufferID() const { return(m_commandBuffer.GetID()); }
+	GLuint GetInstanceBufferID() const { return(m_instanceBuffer.GetID()); }
+	// visible instances of the latest counted pass the GPU has
+	// finished, -1 until one has arrived
+	int GetVisibleInstanceCount() const { return(m_visibleInstanceCount); }
+
+private:
+	// counter of one cull pass and the fence of the pass
+	struct COUNT_READBACK
+	{
+		GpuBuffer buffer;
+		GLsync fence;
+	};
+
+	GLuint m_cullProgram;
+	GLuint m_pyramidProgram;
+	// compacted instances and the commands that draw them
+	GpuBuffer m_instanceBuffer;
+	size_t m_instanceCapacity;
+	GpuBuffer m_commandBuffer;
+	size_t m_commandCapacity;
+	GpuBuffer m_batchBuffer;
+	size_t m_batchCapacity;
+	int m_batchCount;
+	int m_instanceCount;
+	// copy of the depth buffer and the pyramid built from it
+	GpuTexture m_depthTexture;
+	GpuTexture m_pyramidTexture;
+	int m_pyramidWidth;
+	int m_pyramidHeight;
+	int m_pyramidLevelCount;
+	// view the pyramid was drawn with, and whether it exists
+	glm::mat4 m_pyramidViewProjection;
+	bool m_bPyramidValid;
+	bool m_bReady;
+	// ring of counters, the next one to be written first
+	COUNT_READBACK m_countReadbacks[COUNT_READBACK_COUNT];
+	int m_nextCountReadback;
+	int m_visibleInstanceCount;
+
+	// create the depth textures for the passed in size
+	void CreatePyramid(int width, int height);
+	// make a buffer big enough for the passed in bytes
+	void ReserveBuffer(GpuBuffer& buffer, size_t& capacity, size_t bytes);
+	// read the counters whose passes have finished, oldest first
+	void CollectVisibleCounts();
+};
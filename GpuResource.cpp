@@ -0,0 +1,422 @@
+///////////////////////////////////////////////////////////////////////////////
+// gpuresource.cpp
+// ============
+// own OpenGL objects and keep track of the GPU memory they hold
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "GpuResource.h"
+
+#include <iomanip>
+#include <sstream>
+
+// declaration of the global variables
+namespace
+{
+	// all GL objects are created on the GL thread, so the
+	// counters need no locking
+	GpuResourceTracker::CATEGORY_STATS g_CategoryStats[GpuResourceTracker::RESOURCE_CATEGORY_COUNT] = {};
+
+	const char* g_CategoryNames[GpuResourceTracker::RESOURCE_CATEGORY_COUNT] =
+	{
+		"textures",
+		"vertex buffers",
+		"index buffers",
+		"instance buffers",
+		"uniform buffers",
+		"upload buffers",
+		"storage buffers",
+		"readback buffers",
+		"vertex arrays"
+	};
+}
+
+/***********************************************************
+ *  OnCreate()
+ *
+ *  This method records a new object of the category.
+ ***********************************************************/
+void GpuResourceTracker::OnCreate(RESOURCE_CATEGORY category)
+{
+	g_CategoryStats[category].liveCount++;
+}
+
+/***********************************************************
+ *  OnDestroy()
+ *
+ *  This method records an object of the category and the
+ *  bytes of its storage being freed.
+ ***********************************************************/
+void GpuResourceTracker::OnDestroy(RESOURCE_CATEGORY category, size_t bytes)
+{
+	g_CategoryStats[category].liveCount--;
+	g_CategoryStats[category].liveBytes -= bytes;
+}
+
+/***********************************************************
+ *  OnResize()
+ *
+ *  This method records the storage of a live object of the
+ *  category changing size.
+ ***********************************************************/
+void GpuResourceTracker::OnResize(RESOURCE_CATEGORY category, size_t oldBytes, size_t newBytes)
+{
+	CATEGORY_STATS& stats = g_CategoryStats[category];
+	stats.liveBytes = stats.liveBytes - oldBytes + newBytes;
+	if (stats.liveBytes > stats.peakBytes)
+	{
+		stats.peakBytes = stats.liveBytes;
+	}
+}
+
+/***********************************************************
+ *  GetStats()
+ *
+ *  This method returns the live objects and bytes of the
+ *  category.
+ ***********************************************************/
+GpuResourceTracker::CATEGORY_STATS GpuResourceTracker::GetStats(RESOURCE_CATEGORY category)
+{
+	return(g_CategoryStats[category]);
+}
+
+/***********************************************************
+ *  GetTotalCount()
+ *
+ *  This method returns the number of live objects of all
+ *  categories.
+ ***********************************************************/
+int GpuResourceTracker::GetTotalCount()
+{
+	int count = 0;
+	for (int i = 0; i < RESOURCE_CATEGORY_COUNT; i++)
+	{
+		count += g_CategoryStats[i].liveCount;
+	}
+	return(count);
+}
+
+/***********************************************************
+ *  GetTotalBytes()
+ *
+ *  This method returns the bytes held by the live objects of
+ *  all categories.
+ ***********************************************************/
+size_t GpuResourceTracker::GetTotalBytes()
+{
+	size_t bytes = 0;
+	for (int i = 0; i < RESOURCE_CATEGORY_COUNT; i++)
+	{
+		bytes += g_CategoryStats[i].liveBytes;
+	}
+	return(bytes);
+}
+
+/***********************************************************
+ *  GetCategoryName()
+ *
+ *  This method returns the display name of the category.
+ ***********************************************************/
+const char* GpuResourceTracker::GetCategoryName(RESOURCE_CATEGORY category)
+{
+	return(g_CategoryNames[category]);
+}
+
+/***********************************************************
+ *  GetReport()
+ *
+ *  This method returns one line for every category that has
+ *  live objects, with the object count, the live bytes and
+ *  the peak bytes.
+ ***********************************************************/
+std::string GpuResourceTracker::GetReport()
+{
+	std::ostringstream report;
+	report << std::fixed << std::setprecision(2);
+
+	for (int i = 0; i < RESOURCE_CATEGORY_COUNT; i++)
+	{
+		const CATEGORY_STATS& stats = g_CategoryStats[i];
+		if ((stats.liveCount == 0) && (stats.liveBytes == 0))
+		{
+			continue;
+		}
+		report << g_CategoryNames[i] << ": " << stats.liveCount << " live, "
+			<< (stats.liveBytes / (1024.0 * 1024.0)) << " MB (peak "
+			<< (stats.peakBytes / (1024.0 * 1024.0)) << " MB)" << std::endl;
+	}
+
+	return(report.str());
+}
+
+/***********************************************************
+ *  GpuTexture()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+GpuTexture::GpuTexture()
+{
+	m_ID = 0;
+	m_size = 0;
+}
+
+/***********************************************************
+ *  ~GpuTexture()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+GpuTexture::~GpuTexture()
+{
+	Destroy();
+}
+
+/***********************************************************
+ *  GpuTexture(GpuTexture&&)
+ *
+ *  The move constructor, which takes over the texture.
+ ***********************************************************/
+GpuTexture::GpuTexture(GpuTexture&& other) noexcept
+{
+	m_ID = other.m_ID;
+	m_size = other.m_size;
+	other.m_ID = 0;
+	other.m_size = 0;
+}
+
+/***********************************************************
+ *  operator=(GpuTexture&&)
+ *
+ *  The move assignment, which frees the current texture and
+ *  takes over the other one.
+ ***********************************************************/
+GpuTexture& GpuTexture::operator=(GpuTexture&& other) noexcept
+{
+	if (this != &other)
+	{
+		Destroy();
+		m_ID = other.m_ID;
+		m_size = other.m_size;
+		other.m_ID = 0;
+		other.m_size = 0;
+	}
+	return(*this);
+}
+
+/***********************************************************
+ *  Create()
+ *
+ *  This method creates the texture object.
+ ***********************************************************/
+void GpuTexture::Create()
+{
+	Destroy();
+	glGenTextures(1, &m_ID);
+	GpuResourceTracker::OnCreate(GpuResourceTracker::RESOURCE_TEXTURE);
+}
+
+/***********************************************************
+ *  Destroy()
+ *
+ *  This method deletes the texture object.
+ ***********************************************************/
+void GpuTexture::Destroy()
+{
+	if (m_ID != 0)
+	{
+		glDeleteTextures(1, &m_ID);
+		GpuResourceTracker::OnDestroy(GpuResourceTracker::RESOURCE_TEXTURE, m_size);
+		m_ID = 0;
+	}
+	m_size = 0;
+}
+
+/***********************************************************
+ *  SetSize()
+ *
+ *  This method records the bytes of the texture storage.
+ ***********************************************************/
+void GpuTexture::SetSize(size_t bytes)
+{
+	if (m_ID == 0)
+	{
+		return;
+	}
+	GpuResourceTracker::OnResize(GpuResourceTracker::RESOURCE_TEXTURE, m_size, bytes);
+	m_size = bytes;
+}
+
+/***********************************************************
+ *  GpuBuffer()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+GpuBuffer::GpuBuffer()
+{
+	m_ID = 0;
+	m_size = 0;
+	m_category = GpuResourceTracker::RESOURCE_VERTEX_BUFFER;
+}
+
+/***********************************************************
+ *  ~GpuBuffer()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+GpuBuffer::~GpuBuffer()
+{
+	Destroy();
+}
+
+/***********************************************************
+ *  GpuBuffer(GpuBuffer&&)
+ *
+ *  The move constructor, which takes over the buffer.
+ ***********************************************************/
+GpuBuffer::GpuBuffer(GpuBuffer&& other) noexcept
+{
+	m_ID = other.m_ID;
+	m_size = other.m_size;
+	m_category = other.m_category;
+	other.m_ID = 0;
+	other.m_size = 0;
+}
+
+/***********************************************************
+ *  operator=(GpuBuffer&&)
+ *
+ *  The move assignment, which frees the current buffer and
+ *  takes over the other one.
+ ***********************************************************/
+GpuBuffer& GpuBuffer::operator=(GpuBuffer&& other) noexcept
+{
+	if (this != &other)
+	{
+		Destroy();
+		m_ID = other.m_ID;
+		m_size = other.m_size;
+		m_category = other.m_category;
+		other.m_ID = 0;
+		other.m_size = 0;
+	}
+	return(*this);
+}
+
+/***********************************************************
+ *  Create()
+ *
+ *  This method creates the buffer object, counted under the
+ *  passed in category.
+ ***********************************************************/
+void GpuBuffer::Create(GpuResourceTracker::RESOURCE_CATEGORY category)
+{
+	Destroy();
+	glGenBuffers(1, &m_ID);
+	m_category = category;
+	GpuResourceTracker::OnCreate(m_category);
+}
+
+/***********************************************************
+ *  Destroy()
+ *
+ *  This method deletes the buffer object.
+ ***********************************************************/
+void GpuBuffer::Destroy()
+{
+	if (m_ID != 0)
+	{
+		glDeleteBuffers(1, &m_ID);
+		GpuResourceTracker::OnDestroy(m_category, m_size);
+		m_ID = 0;
+	}
+	m_size = 0;
+}
+
+/***********************************************************
+ *  SetSize()
+ *
+ *  This method records the bytes of the buffer storage.
+ ***********************************************************/
+void GpuBuffer::SetSize(size_t bytes)
+{
+	if (m_ID == 0)
+	{
+		return;
+	}
+	GpuResourceTracker::OnResize(m_category, m_size, bytes);
+	m_size = bytes;
+}
+
+/***********************************************************
+ *  GpuVertexArray()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+GpuVertexArray::GpuVertexArray()
+{
+	m_ID = 0;
+}
+
+/***********************************************************
+ *  ~GpuVertexArray()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+GpuVertexArray::~GpuVertexArray()
+{
+	Destroy();
+}
+
+/***********************************************************
+ *  GpuVertexArray(GpuVertexArray&&)
+ *
+ *  The move constructor, which takes over the vertex array.
+ ***********************************************************/
+GpuVertexArray::GpuVertexArray(GpuVertexArray&& other) noexcept
+{
+	m_ID = other.m_ID;
+	other.m_ID = 0;
+}
+
+/***********************************************************
+ *  operator=(GpuVertexArray&&)
+ *
+ *  The move assignment, which frees the current vertex array
+ *  and takes over the other one.
+ ***********************************************************/
+GpuVertexArray& GpuVertexArray::operator=(GpuVertexArray&& other) noexcept
+{
+	if (this != &other)
+	{
+		Destroy();
+		m_ID = other.m_ID;
+		other.m_ID = 0;
+	}
+	return(*this);
+}
+
+/***********************************************************
+ *  Create()
+ *
+ *  This method creates the vertex array object.
+ ***********************************************************/
+void GpuVertexArray::Create()
+{
+	Destroy();
+	glGenVertexArrays(1, &m_ID);
+	GpuResourceTracker::OnCreate(GpuResourceTracker::RESOURCE_VERTEX_ARRAY);
+}
+
+/***********************************************************
+ *  Destroy()
+ *
+ *  This method deletes the vertex array object.
+ ***********************************************************/
+void GpuVertexArray::Destroy()
+{
+	if (m_ID != 0)
+	{
+		glDeleteVertexArrays(1, &m_ID);
+		GpuResourceTracker::OnDestroy(GpuResourceTracker::RESOURCE_VERTEX_ARRAY, 0);
+		m_ID = 0;
+	}
+}
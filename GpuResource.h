@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////
+// gpuresource.h
+// ============
+// own OpenGL objects and keep track of the GPU memory they hold
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstddef>
+#include <string>
+
+/***********************************************************
+ *  GpuResourceTracker
+ *
+ *  This class counts the live OpenGL objects created through
+ *  the owning classes below, and the bytes of GPU memory each
+ *  category of them holds, so leaks show up as live objects
+ *  after everything was destroyed and memory budgets can be
+ *  checked while running.
+ ***********************************************************/
+class GpuResourceTracker
+{
+public:
+	// kinds of tracked GPU objects
+	enum RESOURCE_CATEGORY
+	{
+		RESOURCE_TEXTURE = 0,
+		RESOURCE_VERTEX_BUFFER,
+		RESOURCE_INDEX_BUFFER,
+		RESOURCE_INSTANCE_BUFFER,
+		RESOURCE_UNIFORM_BUFFER,
+		RESOURCE_UPLOAD_BUFFER,
+		RESOURCE_STORAGE_BUFFER,
+		RESOURCE_READBACK_BUFFER,
+		RESOURCE_VERTEX_ARRAY,
+		RESOURCE_CATEGORY_COUNT
+	};
+
+	// live objects and bytes of one category
+	struct CATEGORY_STATS
+	{
+		int liveCount;
+		size_t liveBytes;
+		size_t peakBytes;
+	};
+
+	// record an object being created or destroyed, or the
+	// storage of a live object changing size
+	static void OnCreate(RESOURCE_CATEGORY category);
+	static void OnDestroy(RESOURCE_CATEGORY category, size_t bytes);
+	static void OnResize(RESOURCE_CATEGORY category, size_t oldBytes, size_t newBytes);
+
+	static CATEGORY_STATS GetStats(RESOURCE_CATEGORY category);
+	static int GetTotalCount();
+	static size_t GetTotalBytes();
+	static const char* GetCategoryName(RESOURCE_CATEGORY category);
+	// get one line per category with live objects
+	static std::string GetReport();
+};
+
+/***********************************************************
+ *  GpuTexture
+ *
+ *  This class owns one OpenGL texture object and deletes it
+ *  when destroyed. It can be moved but not copied.
+ ***********************************************************/
+class GpuTexture
+{
+public:
+	// constructor
+	GpuTexture();
+	// destructor
+	~GpuTexture();
+	GpuTexture(GpuTexture&& other) noexcept;
+	GpuTexture& operator=(GpuTexture&& other) noexcept;
+	GpuTexture(const GpuTexture&) = delete;
+	GpuTexture& operator=(const GpuTexture&) = delete;
+
+	// create the texture object, freeing any previous one
+	void Create();
+	// delete the texture object
+	void Destroy();
+	// record the bytes of storage allocated for the texture
+	void SetSize(size_t bytes);
+
+	GLuint GetID() const { return(m_ID); }
+	size_t GetSize() const { return(m_size); }
+
+private:
+	GLuint m_ID;
+	size_t m_size;
+};
+
+/***********************************************************
+ *  GpuBuffer
+ *
+ *  This class owns one OpenGL buffer object of a tracked
+ *  category and deletes it when destroyed. It can be moved
+ *  but not copied.
+ ***********************************************************/
+class GpuBuffer
+{
+public:
+	// constructor
+	GpuBuffer();
+	// destructor
+	~GpuBuffer();
+	GpuBuffer(GpuBuffer&& other) noexcept;
+	GpuBuffer& operator=(GpuBuffer&& other) noexcept;
+	GpuBuffer(const GpuBuffer&) = delete;
+	GpuBuffer& operator=(const GpuBuffer&) = delete;
+
+	// create the buffer object, freeing any previous one
+	void Create(GpuResourceTracker::RESOURCE_CATEGORY category);
+	// delete the buffer object
+	void Destroy();
+	// record the bytes of storage allocated for the buffer
+	void SetSize(size_t bytes);
+
+	GLuint GetID() const { return(m_ID); }
+	size_t GetSize() const { return(m_size); }
+
+private:
+	GLuint m_ID;
+	size_t m_size;
+	GpuResourceTracker::RESOURCE_CATEGORY m_category;
+};
+
+/***********************************************************
+ *  GpuVertexArray
+ *
+ *  This class owns one OpenGL vertex array object and
+ *  deletes it when destroyed. It can be moved but not
+ *  copied.
+ ***********************************************************/
+class GpuVertexArray
+{
+public:
+	// constructor
+	GpuVertexArray();
+	// destructor
+	~GpuVertexArray();
+	GpuVertexArray(GpuVertexArray&& other) noexcept;
+	GpuVertexArray& operator=(GpuVertexArray&& other) noexcept;
+	GpuVertexArray(const GpuVertexArray&) = delete;
+	GpuVertexArray& operator=(const GpuVertexArray&) = delete;
+
+	// create the vertex array object, freeing any previous one
+	void Create();
+	// delete the vertex array object
+	void Destroy();
+
+	GLuint GetID() const { return(m_ID); }
+
+private:
+	GLuint m_ID;
+};
@@ -0,0 +1,188 @@
+///////////////////////////////////////////////////////////////////////////////
+// indirectcommandbuffer.cpp
+// ============
+// hold the draw commands read by multi-draw-indirect calls
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "IndirectCommandBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+// declaration of the global variables
+namespace
+{
+	// commands each region has room for when first created
+	const size_t g_InitialRegionCapacity = 256;
+	// nanoseconds to wait for a region before checking again
+	const GLuint64 g_RegionWaitTimeout = 1000000;
+}
+
+/***********************************************************
+ *  IndirectCommandBuffer()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+IndirectCommandBuffer::IndirectCommandBuffer()
+{
+	m_pMemory = NULL;
+	m_regionCapacity = 0;
+	m_currentRegion = 0;
+	for (int i = 0; i < 2; i++)
+	{
+		m_regions[i].offset = 0;
+		m_regions[i].fence = 0;
+	}
+}
+
+/***********************************************************
+ *  ~IndirectCommandBuffer()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+IndirectCommandBuffer::~IndirectCommandBuffer()
+{
+	Destroy();
+}
+
+/***********************************************************
+ *  Create()
+ *
+ *  This method is used for creating the persistently mapped
+ *  buffer with two regions of the passed in number of
+ *  commands.
+ ***********************************************************/
+void IndirectCommandBuffer::Create(size_t regionCapacity)
+{
+	Destroy();
+
+	size_t regionBytes = regionCapacity * sizeof(DRAW_COMMAND);
+	GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	m_buffer.Create(GpuResourceTracker::RESOURCE_UPLOAD_BUFFER);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_buffer.GetID());
+	glBufferStorage(GL_DRAW_INDIRECT_BUFFER, 2 * regionBytes, NULL, flags);
+	m_pMemory = (unsigned char*)glMapBufferRange(GL_DRAW_INDIRECT_BUFFER, 0, 2 * regionBytes, flags);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	m_buffer.SetSize(2 * regionBytes);
+
+	if (NULL == m_pMemory)
+	{
+		std::cout << "Could not map the indirect command buffer" << std::endl;
+		Destroy();
+		return;
+	}
+
+	m_regionCapacity = regionCapacity;
+	for (int i = 0; i < 2; i++)
+	{
+		m_regions[i].offset = i * regionBytes;
+	}
+}
+
+/***********************************************************
+ *  Destroy()
+ *
+ *  This method is used for unmapping and freeing the buffer.
+ ***********************************************************/
+void IndirectCommandBuffer::Destroy()
+{
+	for (int i = 0; i < 2; i++)
+	{
+		if (m_regions[i].fence != 0)
+		{
+			glDeleteSync(m_regions[i].fence);
+			m_regions[i].fence = 0;
+		}
+	}
+
+	if ((m_buffer.GetID() != 0) && (NULL != m_pMemory))
+	{
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_buffer.GetID());
+		glUnmapBuffer(GL_DRAW_INDIRECT_BUFFER);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	}
+	m_buffer.Destroy();
+	m_pMemory = NULL;
+	m_regionCapacity = 0;
+	m_currentRegion = 0;
+}
+
+/***********************************************************
+ *  WaitForRegion()
+ *
+ *  This method is used for blocking until the GPU has
+ *  finished the draws fenced on the passed in region.
+ ***********************************************************/
+void IndirectCommandBuffer::WaitForRegion(COMMAND_REGION& region)
+{
+	if (region.fence == 0)
+	{
+		return;
+	}
+
+	GLenum result = GL_TIMEOUT_EXPIRED;
+	while (result == GL_TIMEOUT_EXPIRED)
+	{
+		result = glClientWaitSync(region.fence, GL_SYNC_FLUSH_COMMANDS_BIT, g_RegionWaitTimeout);
+	}
+	glDeleteSync(region.fence);
+	region.fence = 0;
+}
+
+/***********************************************************
+ *  Write()
+ *
+ *  This method is used for copying the passed in commands
+ *  into the region the GPU is not reading. The buffer is
+ *  created on first use, and again with twice the room when
+ *  the commands no longer fit.
+ ***********************************************************/
+size_t IndirectCommandBuffer::Write(const std::vector<DRAW_COMMAND>& commands)
+{
+	if (commands.size() > m_regionCapacity)
+	{
+		size_t regionCapacity = std::max(g_InitialRegionCapacity, m_regionCapacity);
+		while (regionCapacity < commands.size())
+		{
+			regionCapacity *= 2;
+		}
+		Create(regionCapacity);
+	}
+	if (NULL == m_pMemory)
+	{
+		return(0);
+	}
+
+	m_currentRegion = 1 - m_currentRegion;
+	COMMAND_REGION& region = m_regions[m_currentRegion];
+	WaitForRegion(region);
+
+	memcpy(m_pMemory + region.offset, commands.data(), commands.size() * sizeof(DRAW_COMMAND));
+
+	return(region.offset);
+}
+
+/***********************************************************
+ *  FenceRegion()
+ *
+ *  This method is used for fencing the current region after
+ *  the draws of a frame, replacing the fence of an earlier
+ *  frame that read the same commands.
+ ***********************************************************/
+void IndirectCommandBuffer::FenceRegion()
+{
+	if (NULL == m_pMemory)
+	{
+		return;
+	}
+
+	COMMAND_REGION& region = m_regions[m_currentRegion];
+	if (region.fence != 0)
+	{
+		glDeleteSync(region.fence);
+	}
+	region.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
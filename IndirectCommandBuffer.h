@@ -0,0 +1,73 @@
+///////////////////////////////////////////////////////////////////////////////
+// indirectcommandbuffer.h
+// ============
+// hold the draw commands read by multi-draw-indirect calls
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GpuResource.h"
+
+#include <GL/glew.h>
+
+#include <cstddef>
+#include <vector>
+
+/***********************************************************
+ *  IndirectCommandBuffer
+ *
+ *  This class owns a persistently mapped buffer of indexed
+ *  draw commands. The buffer is split into two regions that
+ *  are written in turn, and a region is only written again
+ *  once the GPU has finished every draw that read it.
+ ***********************************************************/
+class IndirectCommandBuffer
+{
+public:
+	// constructor
+	IndirectCommandBuffer();
+	// destructor
+	~IndirectCommandBuffer();
+
+	// layout of one indexed indirect draw, as read by the GPU
+	struct DRAW_COMMAND
+	{
+		GLuint count;
+		GLuint instanceCount;
+		GLuint firstIndex;
+		GLint baseVertex;
+		GLuint baseInstance;
+	};
+
+	// copy the commands into the next region, returning the
+	// byte offset of the first command in the buffer
+	size_t Write(const std::vector<DRAW_COMMAND>& commands);
+	// fence the current region after the draws that read it
+	void FenceRegion();
+	// free the buffer
+	void Destroy();
+
+	GLuint GetBufferID() const { return(m_buffer.GetID()); }
+
+private:
+	// one half of the buffer
+	struct COMMAND_REGION
+	{
+		size_t offset;
+		GLsync fence;
+	};
+
+	GpuBuffer m_buffer;
+	unsigned char* m_pMemory;
+	// number of commands each region has room for
+	size_t m_regionCapacity;
+	COMMAND_REGION m_regions[2];
+	int m_currentRegion;
+
+	// create the buffer with room for the passed in number of
+	// commands in each region
+	void Create(size_t regionCapacity);
+	// block until the GPU has finished reading a region
+	void WaitForRegion(COMMAND_REGION& region);
+};
@@ -0,0 +1,395 @@
+///////////////////////////////////////////////////////////////////////////////
+// instancedmeshes.cpp
+// ============
+// draw many copies of the basic 3D shapes with instanced draw calls
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "InstancedMeshes.h"
+
+#include <glm/gtc/packing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+/***********************************************************
+ *  InstancedMeshes()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+InstancedMeshes::InstancedMeshes()
+{
+	for (int i = 0; i < MESH_COUNT; i++)
+	{
+		for (int lod = 0; lod < PrimitiveGeometry::LOD_COUNT; lod++)
+		{
+			m_ranges[i][lod].baseVertex = 0;
+			m_ranges[i][lod].vertexCount = 0;
+			m_ranges[i][lod].firstIndex = 0;
+			m_ranges[i][lod].indexCount = 0;
+		}
+	}
+	m_instanceCapacity = 0;
+	m_vertexFormat = VERTEX_FORMAT_PACKED;
+	m_bLoaded = false;
+}
+
+/***********************************************************
+ *  ~InstancedMeshes()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+InstancedMeshes::~InstancedMeshes()
+{
+	DestroyMeshes();
+}
+
+/***********************************************************
+ *  GetVertexSize()
+ *
+ *  This method is used for getting the bytes of one shape
+ *  vertex in the passed in layout.
+ ***********************************************************/
+int InstancedMeshes::GetVertexSize(VERTEX_FORMAT format)
+{
+	switch (format)
+	{
+	case VERTEX_FORMAT_PACKED:
+		return((int)sizeof(PACKED_VERTEX));
+	case VERTEX_FORMAT_PACKED_HALF:
+		return((int)sizeof(HALF_PACKED_VERTEX));
+	default:
+		return((int)sizeof(PrimitiveGeometry::VERTEX));
+	}
+}
+
+/***********************************************************
+ *  LoadMeshes()
+ *
+ *  This method is used for creating the instance buffer and
+ *  adding every tessellation level of the basic shapes to
+ *  the arena in the vertex layout, with its triangles in
+ *  vertex cache order. The per-vertex attributes are read
+ *  from the arena buffers and the per-instance attributes
+ *  from the shared instance buffer.
+ ***********************************************************/
+void InstancedMeshes::LoadMeshes()
+{
+	if (m_bLoaded == true)
+	{
+		return;
+	}
+
+	// the instance buffer has to exist before the vertex
+	// arrays can reference it
+	m_instanceBuffer.Create(GpuResourceTracker::RESOURCE_INSTANCE_BUFFER);
+	glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer.GetID());
+	glBufferData(GL_ARRAY_BUFFER, 0, NULL, GL_DYNAMIC_DRAW);
+	m_instanceCapacity = 0;
+
+	// per-vertex position, normal and texture coordinate
+	const GeometryArena::VERTEX_ATTRIBUTE floatAttributes[] =
+	{
+		{ 0, 3, GL_FLOAT, false, false, offsetof(PrimitiveGeometry::VERTEX, position) },
+		{ 1, 3, GL_FLOAT, false, false, offsetof(PrimitiveGeometry::VERTEX, normal) },
+		{ 2, 2, GL_FLOAT, false, false, offsetof(PrimitiveGeometry::VERTEX, textureCoordinate) },
+	};
+	const GeometryArena::VERTEX_ATTRIBUTE packedAttributes[] =
+	{
+		{ 0, 3, GL_FLOAT, false, false, offsetof(PACKED_VERTEX, position) },
+		{ 1, 4, GL_INT_2_10_10_10_REV, false, true, offsetof(PACKED_VERTEX, normal) },
+		{ 2, 2, GL_HALF_FLOAT, false, false, offsetof(PACKED_VERTEX, textureCoordinate) },
+	};
+	const GeometryArena::VERTEX_ATTRIBUTE halfAttributes[] =
+	{
+		{ 0, 3, GL_HALF_FLOAT, false, false, offsetof(HALF_PACKED_VERTEX, position) },
+		{ 1, 4, GL_INT_2_10_10_10_REV, false, true, offsetof(HALF_PACKED_VERTEX, normal) },
+		{ 2, 2, GL_HALF_FLOAT, false, false, offsetof(HALF_PACKED_VERTEX, textureCoordinate) },
+	};
+	const GeometryArena::VERTEX_ATTRIBUTE* pAttributes = floatAttributes;
+	if (m_vertexFormat == VERTEX_FORMAT_PACKED)
+	{
+		pAttributes = packedAttributes;
+	}
+	else if (m_vertexFormat == VERTEX_FORMAT_PACKED_HALF)
+	{
+		pAttributes = halfAttributes;
+	}
+	m_arena.Create(GetVertexSize(m_vertexFormat), pAttributes, 3);
+
+	PrimitiveGeometry::MESH_DATA data;
+	for (int i = 0; i < MESH_COUNT; i++)
+	{
+		for (int lod = 0; lod < PrimitiveGeometry::GetLodCount((MESH_TYPE)i); lod++)
+		{
+			PrimitiveGeometry::BuildMesh((MESH_TYPE)i, lod, data);
+			PrimitiveGeometry::OptimizeVertexCache(data);
+			m_ranges[i][lod] = AddMesh(data);
+		}
+	}
+
+	m_arena.Bind();
+	SetInstanceAttributes(m_instanceBuffer.GetID());
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	m_bLoaded = true;
+}
+
+/***********************************************************
+ *  AddMesh()
+ *
+ *  This method is used for adding one shape level to the
+ *  arena, packing its vertices into the vertex layout first.
+ *  The normal keeps a 0 in its two bit part, which the
+ *  shader does not read.
+ ***********************************************************/
+GeometryArena::ARENA_RANGE InstancedMeshes::AddMesh(const PrimitiveGeometry::MESH_DATA& data)
+{
+	if (m_vertexFormat == VERTEX_FORMAT_PACKED)
+	{
+		std::vector<PACKED_VERTEX> vertices(data.vertices.size());
+		for (int i = 0; i < data.vertices.size(); i++)
+		{
+			const PrimitiveGeometry::VERTEX& source = data.vertices[i];
+			vertices[i].position = source.position;
+			vertices[i].normal = glm::packSnorm3x10_1x2(glm::vec4(source.normal, 0.0f));
+			vertices[i].textureCoordinate = glm::packHalf2x16(source.textureCoordinate);
+		}
+		return(m_arena.Add(vertices.data(), (GLuint)vertices.size(), data.indices.data(), (GLuint)data.indices.size()));
+	}
+
+	if (m_vertexFormat == VERTEX_FORMAT_PACKED_HALF)
+	{
+		std::vector<HALF_PACKED_VERTEX> vertices(data.vertices.size());
+		for (int i = 0; i < data.vertices.size(); i++)
+		{
+			const PrimitiveGeometry::VERTEX& source = data.vertices[i];
+			vertices[i].position = glm::packHalf4x16(glm::vec4(source.position, 1.0f));
+			vertices[i].normal = glm::packSnorm3x10_1x2(glm::vec4(source.normal, 0.0f));
+			vertices[i].textureCoordinate = glm::packHalf2x16(source.textureCoordinate);
+		}
+		return(m_arena.Add(vertices.data(), (GLuint)vertices.size(), data.indices.data(), (GLuint)data.indices.size()));
+	}
+
+	return(m_arena.Add(data.vertices.data(), (GLuint)data.vertices.size(), data.indices.data(), (GLuint)data.indices.size()));
+}
+
+/***********************************************************
+ *  SetInstanceAttributes()
+ *
+ *  This method is used for reading the per-instance
+ *  attributes of the bound vertex array from the passed in
+ *  buffer, one instance per step of the divisor.
+ ***********************************************************/
+void InstancedMeshes::SetInstanceAttributes(GLuint instanceBuffer)
+{
+	const GLsizei instanceStride = sizeof(INSTANCE_DATA);
+
+	// per-instance model matrix, one column per attribute
+	glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+	for (int column = 0; column < 4; column++)
+	{
+		GLuint location = 3 + column;
+		glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, instanceStride,
+			(void*)(offsetof(INSTANCE_DATA, model) + column * sizeof(glm::vec4)));
+		glEnableVertexAttribArray(location);
+		glVertexAttribDivisor(location, 1);
+	}
+
+	// per-instance color, UV scale, material and texture
+	glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, instanceStride, (void*)offsetof(INSTANCE_DATA, color));
+	glEnableVertexAttribArray(7);
+	glVertexAttribDivisor(7, 1);
+	glVertexAttribPointer(8, 2, GL_FLOAT, GL_FALSE, instanceStride, (void*)offsetof(INSTANCE_DATA, uvScale));
+	glEnableVertexAttribArray(8);
+	glVertexAttribDivisor(8, 1);
+	glVertexAttribIPointer(9, 2, GL_INT, instanceStride, (void*)offsetof(INSTANCE_DATA, materialIndex));
+	glEnableVertexAttribArray(9);
+	glVertexAttribDivisor(9, 1);
+}
+
+/***********************************************************
+ *  DestroyMeshes()
+ *
+ *  This method is used for freeing the arena of the shapes
+ *  and the instance buffer.
+ ***********************************************************/
+void InstancedMeshes::DestroyMeshes()
+{
+	if (m_bLoaded == false)
+	{
+		return;
+	}
+
+	m_arena.Destroy();
+	m_instanceBuffer.Destroy();
+	m_instanceCapacity = 0;
+	m_bLoaded = false;
+}
+
+/***********************************************************
+ *  UploadInstances()
+ *
+ *  This method is used for copying the per-instance values
+ *  into the instance buffer. The buffer only grows, so the
+ *  same storage is reused while the instance count is stable,
+ *  and only the values from the first instance on are sent.
+ ***********************************************************/
+void InstancedMeshes::UploadInstances(const std::vector<INSTANCE_DATA>& instances, int firstInstance)
+{
+	if ((m_bLoaded == false) || (firstInstance < 0) || (firstInstance >= instances.size()))
+	{
+		return;
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer.GetID());
+	if (instances.size() > m_instanceCapacity)
+	{
+		m_instanceCapacity = instances.size();
+		glBufferData(GL_ARRAY_BUFFER, m_instanceCapacity * sizeof(INSTANCE_DATA), instances.data(), GL_DYNAMIC_DRAW);
+		m_instanceBuffer.SetSize(m_instanceCapacity * sizeof(INSTANCE_DATA));
+	}
+	else
+	{
+		glBufferSubData(GL_ARRAY_BUFFER,
+			firstInstance * sizeof(INSTANCE_DATA),
+			(instances.size() - firstInstance) * sizeof(INSTANCE_DATA),
+			instances.data() + firstInstance);
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+/***********************************************************
+ *  BeginDraw()
+ *
+ *  This method is used for binding the vertex array of the
+ *  arena once before a series of DrawInstances() and
+ *  DrawIndirect() calls.
+ ***********************************************************/
+void InstancedMeshes::BeginDraw()
+{
+	if (m_bLoaded == true)
+	{
+		m_arena.Bind();
+	}
+}
+
+/***********************************************************
+ *  EndDraw()
+ *
+ *  This method is used for unbinding the vertex array of the
+ *  arena once the instances are drawn.
+ ***********************************************************/
+void InstancedMeshes::EndDraw()
+{
+	glBindVertexArray(0);
+}
+
+/***********************************************************
+ *  DrawInstances()
+ *
+ *  This method is used for drawing a run of instances of the
+ *  passed in mesh with a single draw call, from its range of
+ *  the arena. Levels past the last one of the shape draw its
+ *  coarsest level. BeginDraw() has to be called first.
+ ***********************************************************/
+void InstancedMeshes::DrawInstances(MESH_TYPE mesh, int lodLevel, int firstInstance, int instanceCount)
+{
+	if ((m_bLoaded == false) || (mesh < 0) || (mesh >= MESH_COUNT) || (instanceCount <= 0))
+	{
+		return;
+	}
+	lodLevel = std::max(0, std::min(lodLevel, PrimitiveGeometry::GetLodCount(mesh) - 1));
+
+	const GeometryArena::ARENA_RANGE& range = m_ranges[mesh][lodLevel];
+	glDrawElementsInstancedBaseVertexBaseInstance(
+		GL_TRIANGLES,
+		range.indexCount,
+		GL_UNSIGNED_INT,
+		GeometryArena::GetIndexOffset(range),
+		instanceCount,
+		range.baseVertex,
+		(GLuint)firstInstance);
+}
+
+/***********************************************************
+ *  GetDrawCommand()
+ *
+ *  This method is used for filling an indirect command that
+ *  draws a run of instances of the passed in mesh. The first
+ *  index and base vertex pick its range of the arena, and
+ *  the base instance offsets the per-instance attributes the
+ *  same way as the first instance of DrawInstances().
+ ***********************************************************/
+void InstancedMeshes::GetDrawCommand(MESH_TYPE mesh, int lodLevel, int firstInstance, int instanceCount,
+	IndirectCommandBuffer::DRAW_COMMAND& command) const
+{
+	command.count = 0;
+	command.instanceCount = 0;
+	command.firstIndex = 0;
+	command.baseVertex = 0;
+	command.baseInstance = 0;
+
+	if ((mesh < 0) || (mesh >= MESH_COUNT) || (instanceCount <= 0))
+	{
+		return;
+	}
+	lodLevel = std::max(0, std::min(lodLevel, PrimitiveGeometry::GetLodCount(mesh) - 1));
+
+	command.count = m_ranges[mesh][lodLevel].indexCount;
+	command.instanceCount = (GLuint)instanceCount;
+	command.firstIndex = m_ranges[mesh][lodLevel].firstIndex;
+	command.baseVertex = m_ranges[mesh][lodLevel].baseVertex;
+	command.baseInstance = (GLuint)firstInstance;
+}
+
+/***********************************************************
+ *  DrawIndirect()
+ *
+ *  This method is used for drawing the passed in range of
+ *  commands from the indirect buffer. BeginDraw() has to be
+ *  called first.
+ ***********************************************************/
+void InstancedMeshes::DrawIndirect(GLuint commandBuffer, size_t commandOffset, int commandCount)
+{
+	if ((m_bLoaded == false) || (commandBuffer == 0) || (commandCount <= 0))
+	{
+		return;
+	}
+
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+	glMultiDrawElementsIndirect(
+		GL_TRIANGLES,
+		GL_UNSIGNED_INT,
+		(void*)commandOffset,
+		commandCount,
+		0);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+/***********************************************************
+ *  SetIndirectInstanceBuffer()
+ *
+ *  This method is used for reading the per-instance values
+ *  from another buffer with the same layout, such as the
+ *  instances compacted by a cull pass. All the shapes share
+ *  the vertex array, so this holds for DrawInstances() too
+ *  until the instance buffer is set back with 0.
+ ***********************************************************/
+void InstancedMeshes::SetIndirectInstanceBuffer(GLuint instanceBuffer)
+{
+	if (m_bLoaded == false)
+	{
+		return;
+	}
+
+	if (instanceBuffer == 0)
+	{
+		instanceBuffer = m_instanceBuffer.GetID();
+	}
+
+	m_arena.Bind();
+	SetInstanceAttributes(instanceBuffer);
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
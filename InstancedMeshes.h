@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+// instancedmeshes.h
+// ============
+// draw many copies of the basic 3D shapes with instanced draw calls
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GeometryArena.h"
+#include "GpuResource.h"
+#include "IndirectCommandBuffer.h"
+#include "PrimitiveGeometry.h"
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+#include <vector>
+
+/***********************************************************
+ *  InstancedMeshes
+ *
+ *  This class keeps every tessellation level of the basic
+ *  shapes as a range of one geometry arena, along with a
+ *  shared buffer of per-instance values. A run of instances
+ *  in that buffer is drawn with a single instanced draw
+ *  call, and as all the shapes share one vertex array, runs
+ *  of different shapes are drawn without binding anything in
+ *  between or together with multi-draw-indirect. The shape
+ *  vertices can be packed into a smaller layout to save
+ *  memory bandwidth.
+ ***********************************************************/
+class InstancedMeshes
+{
+public:
+	// constructor
+	InstancedMeshes();
+	// destructor
+	~InstancedMeshes();
+
+	// per-instance values - matches the shader attribute
+	// locations 3 to 6 = model matrix, 7 = color, 8 = UV
+	// scale and 9 = material index and texture array layer
+	struct INSTANCE_DATA
+	{
+		glm::mat4 model;
+		glm::vec4 color;
+		glm::vec2 uvScale;
+		int32_t materialIndex;
+		int32_t textureLayer;
+	};
+
+	// layouts the shape vertices are stored in on the GPU
+	enum VERTEX_FORMAT
+	{
+		// 32 bytes of float position, normal and texture
+		// coordinate
+		VERTEX_FORMAT_FLOAT = 0,
+		// 20 bytes of float position, 10_10_10_2 normal and
+		// half float texture coordinate
+		VERTEX_FORMAT_PACKED,
+		// 16 bytes, the same with a half float position
+		VERTEX_FORMAT_PACKED_HALF
+	};
+
+	// packed vertex layouts - the normal is a signed
+	// normalized 2_10_10_10 value and the texture coordinate
+	// two half floats, so the shader reads the same values
+	struct PACKED_VERTEX
+	{
+		glm::vec3 position;
+		uint32_t normal;
+		uint32_t textureCoordinate;
+	};
+	struct HALF_PACKED_VERTEX
+	{
+		// three half floats and one of padding
+		uint64_t position;
+		uint32_t normal;
+		uint32_t textureCoordinate;
+	};
+
+	// set the layout of the shape vertices, used from the
+	// next LoadMeshes() on
+	void SetVertexFormat(VERTEX_FORMAT format) { m_vertexFormat = format; }
+	VERTEX_FORMAT GetVertexFormat() const { return(m_vertexFormat); }
+	// get the bytes of one vertex of the passed in layout
+	static int GetVertexSize(VERTEX_FORMAT format);
+
+	// create the GPU meshes for all levels of the basic shapes
+	void LoadMeshes();
+	// free the GPU meshes and the instance buffer
+	void DestroyMeshes();
+	// true once the GPU meshes have been created
+	bool IsLoaded() const { return(m_bLoaded); }
+
+	// copy the per-instance values from the passed in first
+	// instance onwards into the instance buffer
+	void UploadInstances(const std::vector<INSTANCE_DATA>& instances, int firstInstance);
+	// bind the vertex array of the shapes before drawing any
+	// instances, and unbind it once they are drawn
+	void BeginDraw();
+	void EndDraw();
+	// draw a run of instances from the instance buffer
+	void DrawInstances(MESH_TYPE mesh, int lodLevel, int firstInstance, int instanceCount);
+
+	// fill an indirect command that draws a run of instances
+	// of the passed in mesh level
+	void GetDrawCommand(MESH_TYPE mesh, int lodLevel, int firstInstance, int instanceCount,
+		IndirectCommandBuffer::DRAW_COMMAND& command) const;
+	// draw the commands at the passed in byte offset of the
+	// indirect buffer with a single multi-draw call
+	void DrawIndirect(GLuint commandBuffer, size_t commandOffset, int commandCount);
+	// read the per-instance values of the draws from the
+	// passed in buffer, or from the instance buffer for 0
+	void SetIndirectInstanceBuffer(GLuint instanceBuffer);
+	// get the buffer holding the uploaded per-instance values
+	GLuint GetInstanceBufferID() const { return(m_instanceBuffer.GetID()); }
+
+private:
+	// every shape level in one pair of buffers, and where
+	// each of them sits inside it
+	GeometryArena m_arena;
+	GeometryArena::ARENA_RANGE m_ranges[MESH_COUNT][PrimitiveGeometry::LOD_COUNT];
+	// buffer holding the per-instance values
+	GpuBuffer m_instanceBuffer;
+	// number of instances the buffer has room for
+	size_t m_instanceCapacity;
+	VERTEX_FORMAT m_vertexFormat;
+	bool m_bLoaded;
+
+	// add one shape level to the arena in the vertex layout
+	GeometryArena::ARENA_RANGE AddMesh(const PrimitiveGeometry::MESH_DATA& data);
+
+	// point the per-instance attributes of the bound vertex
+	// array at the passed in buffer
+	void SetInstanceAttributes(GLuint instanceBuffer);
+};
@@ -0,0 +1,231 @@
+///////////////////////////////////////////////////////////////////////////////
+// jobsystem.cpp
+// ============
+// split loops over the render list across worker threads
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "JobSystem.h"
+
+#include <algorithm>
+
+// declaration of the global variables
+namespace
+{
+	// chunks queued for every thread, so threads that finish
+	// early have something left to steal
+	const int g_ChunksPerThread = 4;
+}
+
+/***********************************************************
+ *  JobSystem()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+JobSystem::JobSystem()
+{
+	m_queuedCount = 0;
+	m_bStopWorkers = false;
+
+	// the calling thread always has a queue, so loops still
+	// run before and after the workers exist
+	m_queues.push_back(std::unique_ptr<JOB_QUEUE>(new JOB_QUEUE()));
+}
+
+/***********************************************************
+ *  ~JobSystem()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+JobSystem::~JobSystem()
+{
+	Shutdown();
+}
+
+/***********************************************************
+ *  Initialize()
+ *
+ *  This method is used for starting the worker threads, each
+ *  with a queue of its own.
+ ***********************************************************/
+void JobSystem::Initialize(int workerCount)
+{
+	Shutdown();
+
+	if (workerCount < 0)
+	{
+		workerCount = std::max((int)std::thread::hardware_concurrency() - 1, 1);
+	}
+
+	m_bStopWorkers = false;
+	for (int i = 0; i < workerCount; i++)
+	{
+		m_queues.push_back(std::unique_ptr<JOB_QUEUE>(new JOB_QUEUE()));
+	}
+	for (int i = 0; i < workerCount; i++)
+	{
+		m_workers.push_back(std::thread(&JobSystem::WorkerLoop, this, i + 1));
+	}
+}
+
+/***********************************************************
+ *  Shutdown()
+ *
+ *  This method is used for stopping the worker threads. No
+ *  loop is running at this point, so the queues are empty.
+ ***********************************************************/
+void JobSystem::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_wakeMutex);
+		m_bStopWorkers = true;
+	}
+	m_jobReady.notify_all();
+	for (int i = 0; i < m_workers.size(); i++)
+	{
+		m_workers[i].join();
+	}
+	m_workers.clear();
+	m_queues.resize(1);
+}
+
+/***********************************************************
+ *  ParallelFor()
+ *
+ *  This method is used for running the passed in function
+ *  over the items [0, count). The items are cut into chunks
+ *  that are dealt out over the queues of all threads, and the
+ *  calling thread keeps running and stealing chunks until the
+ *  last one has finished.
+ ***********************************************************/
+void JobSystem::ParallelFor(int count, int grainSize, const JOB_FUNCTION& function)
+{
+	if (count <= 0)
+	{
+		return;
+	}
+
+	int threadCount = GetThreadCount();
+	int chunkSize = std::max(grainSize, (count + threadCount * g_ChunksPerThread - 1) / (threadCount * g_ChunksPerThread));
+	chunkSize = std::max(chunkSize, 1);
+	int chunkCount = (count + chunkSize - 1) / chunkSize;
+
+	// a loop that fits in one chunk is not worth handing out
+	if ((chunkCount == 1) || (threadCount == 1))
+	{
+		function(0, count, 0);
+		return;
+	}
+
+	std::atomic<int> pendingCount(chunkCount);
+	for (int chunk = 0; chunk < chunkCount; chunk++)
+	{
+		JOB job;
+		job.pFunction = &function;
+		job.first = chunk * chunkSize;
+		job.last = std::min(job.first + chunkSize, count);
+		job.pPendingCount = &pendingCount;
+
+		JOB_QUEUE& queue = *m_queues[chunk % threadCount];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.jobs.push_back(job);
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_wakeMutex);
+		m_queuedCount += chunkCount;
+	}
+	m_jobReady.notify_all();
+
+	while (pendingCount.load() > 0)
+	{
+		JOB job;
+		if (TakeJob(0, job) == true)
+		{
+			RunJob(job, 0);
+		}
+		else
+		{
+			// the last chunks are still running on the workers
+			std::this_thread::yield();
+		}
+	}
+}
+
+/***********************************************************
+ *  TakeJob()
+ *
+ *  This method is used for getting the next job for a thread.
+ *  The newest job of its own queue is taken first, as its
+ *  items are the most likely to still be in the cache, then
+ *  the oldest job of the other queues in turn.
+ ***********************************************************/
+bool JobSystem::TakeJob(int threadIndex, JOB& job)
+{
+	{
+		JOB_QUEUE& queue = *m_queues[threadIndex];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.jobs.empty() == false)
+		{
+			job = queue.jobs.back();
+			queue.jobs.pop_back();
+			m_queuedCount--;
+			return(true);
+		}
+	}
+
+	int threadCount = GetThreadCount();
+	for (int offset = 1; offset < threadCount; offset++)
+	{
+		JOB_QUEUE& queue = *m_queues[(threadIndex + offset) % threadCount];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.jobs.empty() == false)
+		{
+			job = queue.jobs.front();
+			queue.jobs.pop_front();
+			m_queuedCount--;
+			return(true);
+		}
+	}
+
+	return(false);
+}
+
+/***********************************************************
+ *  RunJob()
+ *
+ *  This method is used for running one chunk of a loop and
+ *  counting it as done.
+ ***********************************************************/
+void JobSystem::RunJob(const JOB& job, int threadIndex)
+{
+	(*job.pFunction)(job.first, job.last, threadIndex);
+	job.pPendingCount->fetch_sub(1);
+}
+
+/***********************************************************
+ *  WorkerLoop()
+ *
+ *  This method is the main function of the worker threads.
+ *  It runs and steals jobs while any are queued, and sleeps
+ *  until more are queued or the job system is shut down.
+ ***********************************************************/
+void JobSystem::WorkerLoop(int threadIndex)
+{
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_wakeMutex);
+			m_jobReady.wait(lock, [this]() { return((m_bStopWorkers == true) || (m_queuedCount.load() > 0)); });
+			if (m_bStopWorkers == true)
+			{
+				return;
+			}
+		}
+
+		JOB job;
+		while (TakeJob(threadIndex, job) == true)
+		{
+			RunJob(job, threadIndex);
+		}
+	}
+}
@@ -0,0 +1,93 @@
+///////////////////////////////////////////////////////////////////////////////
+// jobsystem.h
+// ============
+// split loops over the render list across worker threads
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/***********************************************************
+ *  JobSystem
+ *
+ *  This class keeps a pool of worker threads, each with a
+ *  queue of jobs of its own. A parallel loop is cut into
+ *  chunks that are spread over the queues, and a thread that
+ *  runs out of work steals chunks from the other queues. The
+ *  calling thread works on the loop as well until every
+ *  chunk is done. Each chunk is told which thread runs it, so
+ *  a stage can write to per-thread buffers without locks and
+ *  merge them afterwards.
+ ***********************************************************/
+class JobSystem
+{
+public:
+	// constructor
+	JobSystem();
+	// destructor
+	~JobSystem();
+
+	// function run for the items [first, last) of a loop on
+	// the thread with the passed in index
+	typedef std::function<void(int first, int last, int threadIndex)> JOB_FUNCTION;
+
+	// start the passed in number of worker threads, or one
+	// less than the number of cores when negative - with 0
+	// every loop runs on the calling thread
+	void Initialize(int workerCount);
+	// stop the worker threads
+	void Shutdown();
+
+	// get the number of threads that run jobs, the calling
+	// thread included, so per-thread buffers can be sized
+	int GetThreadCount() const { return((int)m_queues.size()); }
+
+	// run the function over [0, count) in chunks of at least
+	// grainSize items and return once all of them are done -
+	// only called from the thread that owns the job system
+	void ParallelFor(int count, int grainSize, const JOB_FUNCTION& function);
+
+private:
+	// one chunk of a parallel loop
+	struct JOB
+	{
+		const JOB_FUNCTION* pFunction;
+		int first;
+		int last;
+		// chunks of the loop that have not finished yet
+		std::atomic<int>* pPendingCount;
+	};
+
+	// jobs waiting on one thread, taken from the back by the
+	// owner and from the front by threads stealing them
+	struct JOB_QUEUE
+	{
+		std::mutex mutex;
+		std::deque<JOB> jobs;
+	};
+
+	// queue 0 belongs to the calling thread
+	std::vector<std::unique_ptr<JOB_QUEUE>> m_queues;
+	std::vector<std::thread> m_workers;
+	// wakes the workers when jobs are queued
+	std::mutex m_wakeMutex;
+	std::condition_variable m_jobReady;
+	std::atomic<int> m_queuedCount;
+	bool m_bStopWorkers;
+
+	// main function of the worker threads
+	void WorkerLoop(int threadIndex);
+	// take a job from the own queue, or steal one from another
+	bool TakeJob(int threadIndex, JOB& job);
+	// run a job and mark its chunk as done
+	void RunJob(const JOB& job, int threadIndex);
+};
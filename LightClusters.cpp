@@ -0,0 +1,281 @@
+///////////////////////////////////////////////////////////////////////////////
+// lightclusters.cpp
+// ============
+// assign the scene light sources to the view space clusters of the frame
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "LightClusters.h"
+#include "ComputeShader.h"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// declaration of the global variables
+namespace
+{
+	// invocations in one work group, each building one cluster
+	// and loading one light into shared memory per round
+	const GLuint g_ClusterGroupSize = 128;
+	// nearest depth the exponential slices start at, so a near
+	// plane at or behind the camera still slices evenly
+	const float g_MinSliceDepth = 0.1f;
+	// lights the buffer starts out with room for
+	const size_t g_InitialLightCapacity = 64;
+}
+
+/***********************************************************
+ *  LightClusters()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+LightClusters::LightClusters()
+{
+	m_program = 0;
+	m_lightCapacity = 0;
+	m_firstDirtyLight = 0;
+	m_lastDirtyLight = -1;
+	m_view = glm::mat4(1.0f);
+	m_projection = glm::mat4(1.0f);
+	m_bClustersValid = false;
+	m_sliceScaleBias = glm::vec2(0.0f, 0.0f);
+	m_updateCount = 0;
+}
+
+/***********************************************************
+ *  ~LightClusters()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+LightClusters::~LightClusters()
+{
+	Destroy();
+}
+
+/***********************************************************
+ *  Initialize()
+ *
+ *  This method is used for loading the cluster program and
+ *  creating the light and cluster buffers. The cluster
+ *  buffer has a fixed size, a light count and a full light
+ *  list for every cluster.
+ ***********************************************************/
+bool LightClusters::Initialize(const char* shaderPath)
+{
+	Destroy();
+
+	m_program = ComputeShader::LoadProgram(shaderPath);
+	if (m_program == 0)
+	{
+		return(false);
+	}
+
+	size_t clusterBytes = (size_t)GRID_X * GRID_Y * GRID_Z * (MAX_CLUSTER_LIGHTS + 1) * sizeof(GLuint);
+	m_clusterBuffer.Create(GpuResourceTracker::RESOURCE_STORAGE_BUFFER);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_clusterBuffer.GetID());
+	glBufferData(GL_SHADER_STORAGE_BUFFER, clusterBytes, NULL, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+	m_clusterBuffer.SetSize(clusterBytes);
+
+	m_lightBuffer.Create(GpuResourceTracker::RESOURCE_STORAGE_BUFFER);
+	m_lightCapacity = 0;
+	m_firstDirtyLight = 0;
+	m_lastDirtyLight = (int)m_lights.size() - 1;
+	m_bClustersValid = false;
+
+	return(true);
+}
+
+/***********************************************************
+ *  Destroy()
+ *
+ *  This method is used for freeing the cluster program and
+ *  the buffers. The lights are kept, so they are uploaded
+ *  again by the next Initialize().
+ ***********************************************************/
+void LightClusters::Destroy()
+{
+	if (m_program != 0)
+	{
+		glDeleteProgram(m_program);
+		m_program = 0;
+	}
+
+	m_lightBuffer.Destroy();
+	m_lightCapacity = 0;
+	m_clusterBuffer.Destroy();
+	m_bClustersValid = false;
+}
+
+/***********************************************************
+ *  SetLight()
+ *
+ *  This method is used for changing the light at the passed
+ *  in index, or adding it when the index is the light count.
+ *  The change is uploaded by the next Update().
+ ***********************************************************/
+void LightClusters::SetLight(int lightIndex, const LIGHT_DATA& light)
+{
+	if ((lightIndex < 0) || (lightIndex > m_lights.size()))
+	{
+		return;
+	}
+
+	if (lightIndex == m_lights.size())
+	{
+		m_lights.push_back(light);
+	}
+	else
+	{
+		m_lights[lightIndex] = light;
+	}
+
+	if (m_lastDirtyLight < m_firstDirtyLight)
+	{
+		m_firstDirtyLight = lightIndex;
+		m_lastDirtyLight = lightIndex;
+	}
+	else
+	{
+		m_firstDirtyLight = std::min(m_firstDirtyLight, lightIndex);
+		m_lastDirtyLight = std::max(m_lastDirtyLight, lightIndex);
+	}
+	m_bClustersValid = false;
+}
+
+/***********************************************************
+ *  ClearLights()
+ *
+ *  This method is used for removing every light. The light
+ *  buffer keeps its size, so adding the lights again only
+ *  uploads them.
+ ***********************************************************/
+void LightClusters::ClearLights()
+{
+	m_lights.clear();
+	m_firstDirtyLight = 0;
+	m_lastDirtyLight = -1;
+	m_bClustersValid = false;
+}
+
+/***********************************************************
+ *  UploadLights()
+ *
+ *  This method is used for copying the lights changed since
+ *  the last upload into the light buffer. A buffer that is
+ *  too small is grown to twice its size and filled again.
+ ***********************************************************/
+void LightClusters::UploadLights()
+{
+	if (m_lastDirtyLight < m_firstDirtyLight)
+	{
+		return;
+	}
+
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_lightBuffer.GetID());
+	if (m_lights.size() > m_lightCapacity)
+	{
+		m_lightCapacity = std::max(std::max(m_lights.size(), m_lightCapacity * 2), g_InitialLightCapacity);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, m_lightCapacity * sizeof(LIGHT_DATA), NULL, GL_DYNAMIC_DRAW);
+		m_lightBuffer.SetSize(m_lightCapacity * sizeof(LIGHT_DATA));
+		m_firstDirtyLight = 0;
+		m_lastDirtyLight = (int)m_lights.size() - 1;
+	}
+	glBufferSubData(
+		GL_SHADER_STORAGE_BUFFER,
+		m_firstDirtyLight * sizeof(LIGHT_DATA),
+		(m_lastDirtyLight - m_firstDirtyLight + 1) * sizeof(LIGHT_DATA),
+		&m_lights[m_firstDirtyLight]);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+	m_firstDirtyLight = 0;
+	m_lastDirtyLight = -1;
+}
+
+/***********************************************************
+ *  Update()
+ *
+ *  This method is used for running the cluster pass for the
+ *  passed in view. The depth range is read back from the
+ *  projection, and the slices between its planes grow
+ *  exponentially, so near clusters stay small on screen and
+ *  in depth alike. Nothing is done when neither the view nor
+ *  a light has changed since the last pass.
+ ***********************************************************/
+void LightClusters::Update(const glm::mat4& view, const glm::mat4& projection)
+{
+	if ((m_program == 0) || (m_lights.size() == 0))
+	{
+		return;
+	}
+
+	if ((m_bClustersValid == true) &&
+		(memcmp(&view, &m_view, sizeof(glm::mat4)) == 0) &&
+		(memcmp(&projection, &m_projection, sizeof(glm::mat4)) == 0))
+	{
+		return;
+	}
+
+	UploadLights();
+
+	// the near and far plane of a perspective or an
+	// orthographic projection
+	float viewNear = 0.0f;
+	float viewFar = 0.0f;
+	if (projection[3][3] == 0.0f)
+	{
+		viewNear = projection[3][2] / (projection[2][2] - 1.0f);
+		viewFar = projection[3][2] / (projection[2][2] + 1.0f);
+	}
+	else
+	{
+		viewNear = (projection[3][2] + 1.0f) / projection[2][2];
+		viewFar = (projection[3][2] - 1.0f) / projection[2][2];
+	}
+	float sliceNear = std::max(viewNear, g_MinSliceDepth);
+	float sliceFar = std::max(viewFar, sliceNear * 2.0f);
+
+	// slice = log(depth) * scale - bias, which the fragment
+	// shader uses to find its cluster
+	float logRange = std::log(sliceFar / sliceNear);
+	m_sliceScaleBias = glm::vec2(GRID_Z / logRange, GRID_Z * std::log(sliceNear) / logRange);
+
+	GLint previousProgram = 0;
+	glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+
+	glm::mat4 inverseProjection = glm::inverse(projection);
+	glUseProgram(m_program);
+	glUniformMatrix4fv(glGetUniformLocation(m_program, "view"), 1, GL_FALSE, glm::value_ptr(view));
+	glUniformMatrix4fv(glGetUniformLocation(m_program, "inverseProjection"), 1, GL_FALSE, glm::value_ptr(inverseProjection));
+	glUniform1i(glGetUniformLocation(m_program, "lightCount"), (GLint)m_lights.size());
+	glUniform2f(glGetUniformLocation(m_program, "sliceRange"), sliceNear, sliceFar);
+	glUniform2f(glGetUniformLocation(m_program, "viewRange"), viewNear, viewFar);
+
+	Bind();
+	GLuint clusterCount = GRID_X * GRID_Y * GRID_Z;
+	glDispatchCompute((clusterCount + g_ClusterGroupSize - 1) / g_ClusterGroupSize, 1, 1);
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+	// the scene shader is current again for the draws
+	glUseProgram(previousProgram);
+
+	m_view = view;
+	m_projection = projection;
+	m_bClustersValid = true;
+	m_updateCount++;
+}
+
+/***********************************************************
+ *  Bind()
+ *
+ *  This method is used for binding the light and cluster
+ *  buffers to the binding points the shaders read them from.
+ ***********************************************************/
+void LightClusters::Bind() const
+{
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, LIGHT_BINDING, m_lightBuffer.GetID());
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CLUSTER_BINDING, m_clusterBuffer.GetID());
+}
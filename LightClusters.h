@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////
+// lightclusters.h
+// ============
+// assign the scene light sources to the view space clusters of the frame
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GpuResource.h"
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+#include <vector>
+
+/***********************************************************
+ *  LightClusters
+ *
+ *  This class keeps every light source of the scene in a
+ *  storage buffer and splits the view frustum into a grid of
+ *  clusters, screen tiles cut into exponential depth slices.
+ *  A compute pass lists the lights whose range reaches each
+ *  cluster, so a fragment only evaluates the lights of its
+ *  own cluster instead of every light of the scene.
+ ***********************************************************/
+class LightClusters
+{
+public:
+	// constructor
+	LightClusters();
+	// destructor
+	~LightClusters();
+
+	// one light source as the shaders read it - the layout is
+	// the same in the std140 light block and the std430 light
+	// buffer
+	struct LIGHT_DATA
+	{
+		// xyz = position, w = focal strength
+		glm::vec4 positionFocal;
+		glm::vec4 ambientColor;
+		// xyz = diffuse color, w = range, 0 for no falloff
+		glm::vec4 diffuseColorRange;
+		// xyz = specular color, w = specular intensity
+		glm::vec4 specularColorIntensity;
+	};
+
+	// size of the cluster grid and of the light list of one
+	// cluster - these must match lightClusterShader.glsl and
+	// fragmentShader.glsl
+	static const int GRID_X = 16;
+	static const int GRID_Y = 9;
+	static const int GRID_Z = 24;
+	static const int MAX_CLUSTER_LIGHTS = 64;
+	// storage buffer binding points read by the scene shader
+	static const GLuint LIGHT_BINDING = 4;
+	static const GLuint CLUSTER_BINDING = 5;
+
+	// load the compute program and create the buffers
+	bool Initialize(const char* shaderPath);
+	// free the program and the buffers
+	void Destroy();
+	// true once the compute program has been loaded
+	bool IsReady() const { return(m_program != 0); }
+
+	// set the values of the light at the passed in index,
+	// adding it when it is the next one
+	void SetLight(int lightIndex, const LIGHT_DATA& light);
+	// remove every light, keeping the buffer for the next ones
+	void ClearLights();
+	int GetLightCount() const { return((int)m_lights.size()); }
+
+	// list the lights of every cluster for the passed in view,
+	// when the view or a light has changed
+	void Update(const glm::mat4& view, const glm::mat4& projection);
+	// bind the light and cluster buffers to their binding points
+	void Bind() const;
+	// scale and bias turning the log of a view depth into the
+	// depth slice of a cluster
+	glm::vec2 GetSliceScaleBias() const { return(m_sliceScaleBias); }
+	// number of times the clusters were built
+	int GetUpdateCount() const { return(m_updateCount); }
+
+private:
+	GLuint m_program;
+	// light sources, on the CPU and in the storage buffer
+	std::vector<LIGHT_DATA> m_lights;
+	GpuBuffer m_lightBuffer;
+	size_t m_lightCapacity;
+	// first and last light changed since the last upload
+	int m_firstDirtyLight;
+	int m_lastDirtyLight;
+	// light count and indices of every cluster
+	GpuBuffer m_clusterBuffer;
+	// view the clusters were built for, and whether they exist
+	glm::mat4 m_view;
+	glm::mat4 m_projection;
+	bool m_bClustersValid;
+	glm::vec2 m_sliceScaleBias;
+	int m_updateCount;
+
+	// copy the changed lights into the storage buffer
+	void UploadLights();
+};
@@ -1,177 +1,995 @@
-#include <iostream>         // error handling and output
-#include <cstdlib>          // EXIT_FAILURE
-
-#include <GL/glew.h>        // GLEW library
-#include "GLFW/glfw3.h"     // GLFW library
-
-// GLM Math Header inclusions
-#include <glm/glm.hpp>
-#include <glm/gtx/transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
-
-#include "SceneManager.h"
-#include "ViewManager.h"
-#include "ShapeMeshes.h"
-#include "ShaderManager.h"
-
-// Namespace for declaring global variables
-namespace
-{
-	// Macro for window title
-	const char* const WINDOW_TITLE = "7-1 FinalProject and Milestones"; 
-
-	// Main GLFW window
-	GLFWwindow* g_Window = nullptr;
-
-	// scene manager object for managing the 3D scene prepare and render
-	SceneManager* g_SceneManager = nullptr;
-	// shader manager object for dynamic interaction with the shader code
-	ShaderManager* g_ShaderManager = nullptr;
-	// view manager object for managing the 3D view setup and projection to 2D
-	ViewManager* g_ViewManager = nullptr;
-}
-
-// Function declarations - all functions that are called manually
-// need to be pre-declared at the beginning of the source code.
-bool InitializeGLFW();
-bool InitializeGLEW();
-
-
-/***********************************************************
- *  main(int, char*)
- *
- *  This function gets called after the application has been
- *  launched.
- ***********************************************************/
-int main(int argc, char* argv[])
-{
-	// if GLFW fails initialization, then terminate the application
-	if (InitializeGLFW() == false)
-	{
-		return(EXIT_FAILURE);
-	}
-
-	// try to create a new shader manager object
-	g_ShaderManager = new ShaderManager();
-	// try to create a new view manager object
-	g_ViewManager = new ViewManager(
-		g_ShaderManager);
-
-	// try to create the main display window
-	g_Window = g_ViewManager->CreateDisplayWindow(WINDOW_TITLE);
-
-	// if GLEW fails initialization, then terminate the application
-	if (InitializeGLEW() == false)
-	{
-		return(EXIT_FAILURE);
-	}
-
-	// load the shader code from the external GLSL files
-	g_ShaderManager->LoadShaders(
-		"../../Utilities/shaders/vertexShader.glsl",
-		"../../Utilities/shaders/fragmentShader.glsl");
-	g_ShaderManager->use();
-
-	// try to create a new scene manager object and prepare the 3D scene
-	g_SceneManager = new SceneManager(g_ShaderManager);
-	g_SceneManager->PrepareScene();
-
-	// loop will keep running until the application is closed 
-	// or until an error has occurred
-	while (!glfwWindowShouldClose(g_Window))
-	{
-		// Enable z-depth
-		glEnable(GL_DEPTH_TEST);
-
-		// Clear the frame and z buffers
-		glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-		// convert from 3D object space to 2D view
-		g_ViewManager->PrepareSceneView();
-
-		// refresh the 3D scene
-		g_SceneManager->RenderScene();
-
-
-		// Flips the the back buffer with the front buffer every frame.
-		glfwSwapBuffers(g_Window);
-
-		// query the latest GLFW events
-		glfwPollEvents();
-	}
-
-	// clear the allocated manager objects from memory
-	if (NULL != g_SceneManager)
-	{
-		delete g_SceneManager;
-		g_SceneManager = NULL;
-	}
-	if (NULL != g_ViewManager)
-	{
-		delete g_ViewManager;
-		g_ViewManager = NULL;
-	}
-	if (NULL != g_ShaderManager)
-	{
-		delete g_ShaderManager;
-		g_ShaderManager = NULL;
-	}
-
-	// Terminates the program successfully
-	exit(EXIT_SUCCESS); 
-}
-
-/***********************************************************
- *	InitializeGLFW()
- * 
- *  This function is used to initialize the GLFW library.   
- ***********************************************************/
-bool InitializeGLFW()
-{
-	// GLFW: initialize and configure library
-	// --------------------------------------
-	glfwInit();
-
-#ifdef __APPLE__
-	// set the version of OpenGL and profile to use
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-#else
-	// set the version of OpenGL and profile to use
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
-	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-#endif
-	// GLFW: end -------------------------------
-
-	return(true);
-}
-
-/***********************************************************
- *	InitializeGLEW()
- *
- *  This function is used to initialize the GLEW library.
- ***********************************************************/
-bool InitializeGLEW()
-{
-	// GLEW: initialize
-	// -----------------------------------------
-	GLenum GLEWInitResult = GLEW_OK;
-
-	// try to initialize the GLEW library
-	GLEWInitResult = glewInit();
-	if (GLEW_OK != GLEWInitResult)
-	{
-		std::cerr << glewGetErrorString(GLEWInitResult) << std::endl;
-		return false;
-	}
-	// GLEW: end -------------------------------
-
-	// Displays a successful OpenGL initialization message
-	std::cout << "INFO: OpenGL Successfully Initialized\n";
-	std::cout << "INFO: OpenGL Version: " << glGetString(GL_VERSION) << "\n" << std::endl;
-
-	return(true);
-}
\ No newline at end of file
+#include <iostream>         // error handling and output
+#include <cstdlib>          // EXIT_FAILURE
+#include <cstring>          // strcmp
+#include <algorithm>        // std::max
+#include <iomanip>          // std::setprecision
+#include <string>
+#include <vector>
+
+#include <GL/glew.h>        // GLEW library
+#include "GLFW/glfw3.h"     // GLFW library
+
+// GLM Math Header inclusions
+#include <glm/glm.hpp>
+#include <glm/gtx/transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "CameraPath.h"
+#include "FileWatcher.h"
+#include "FrameProfiler.h"
+#include "FramePacer.h"
+#include "GpuResource.h"
+#include "SceneFile.h"
+#include "SceneManager.h"
+#include "SnapshotRenderer.h"
+#include "ViewManager.h"
+#include "ShapeMeshes.h"
+#include "ShaderManager.h"
+
+// Namespace for declaring global variables
+namespace
+{
+	// Macro for window title
+	const char* const WINDOW_TITLE = "7-1 FinalProject and Milestones"; 
+
+	// Main GLFW window
+	GLFWwindow* g_Window = nullptr;
+
+	// scene manager object for managing the 3D scene prepare and render
+	SceneManager* g_SceneManager = nullptr;
+	// shader manager object for dynamic interaction with the shader code
+	ShaderManager* g_ShaderManager = nullptr;
+	// view manager object for managing the 3D view setup and projection to 2D
+	ViewManager* g_ViewManager = nullptr;
+	// profiler object for measuring the frame timings
+	FrameProfiler* g_FrameProfiler = nullptr;
+
+	// seconds between refreshes of the profiler summary in the title
+	const double TITLE_REFRESH_SECONDS = 0.5;
+
+	// frames drawn on demand after the last change, so what
+	// settles over a few frames, like the occlusion culling of
+	// the new view, is shown before the loop goes to sleep
+	const int IDLE_SETTLE_FRAMES = 2;
+	// longest sleep between two checks of the watched files
+	const double HOT_RELOAD_WAIT_SECONDS = 0.5;
+
+	// height of the floor plan camera of the split view, and
+	// half the floor length it shows from bottom to top
+	const float FLOOR_PLAN_HEIGHT = 40.0f;
+	const float FLOOR_PLAN_SIZE = 12.0f;
+
+	// background of the snapshot images, the same as the window
+	const glm::vec4 SNAPSHOT_CLEAR_COLOR = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+	// times a snapshot is drawn - the first pass works out the
+	// texture levels its view needs, the next one has the
+	// streamer load them, and the last one is written out
+	const int SNAPSHOT_PASSES = 3;
+
+	// sources of the scene shader program
+	const char* const VERTEX_SHADER_FILE = "shaders/vertexShader.glsl";
+	const char* const FRAGMENT_SHADER_FILE = "shaders/fragmentShader.glsl";
+
+	// settings read from the command line
+	struct APP_OPTIONS
+	{
+		// render a fixed camera flight in a hidden window and
+		// print the frame statistics, instead of running
+		// interactively
+		bool bBenchmark;
+		// number of measured benchmark frames
+		int benchmarkFrames;
+		// number of frames rendered before measuring starts
+		int warmupFrames;
+		// number of copies of the dumbbell rack in the scene
+		int rackCount;
+		// skip the objects outside the view frustum
+		bool bFrustumCulling;
+		// bake the objects that never move into merged batches
+		bool bStaticBatching;
+		// submit the batches with multi-draw-indirect
+		bool bIndirectDraw;
+		// cull the indirect draws in a compute pass
+		bool bGpuCulling;
+		// draw the depth of the opaque objects before shading them
+		bool bDepthPrepass;
+		// layout the shape vertices are stored in on the GPU
+		InstancedMeshes::VERTEX_FORMAT vertexFormat;
+		// shadow the lights with cached shadow maps
+		bool bShadows;
+		// let the moving objects cast shadows, with a second set
+		// of maps they are drawn into every frame
+		bool bMovingShadows;
+		// evaluate only the lights of each fragment's cluster
+		bool bClusteredLighting;
+		// ceiling fixture lights added to the scene
+		int ceilingLights;
+		// worker threads building the draw list, -1 for one per
+		// spare core and 0 for none
+		int workerThreads;
+		// CSV file that every frame is written to, if not empty
+		std::string csvFilename;
+		// load every scene texture into the texture cache and
+		// exit, so later runs start from compressed images
+		bool bBuildTextureCache;
+		// megabytes the scene textures may use, 0 for no limit
+		int textureBudgetMB;
+		// scene file loaded instead of the built in scene, if
+		// not empty
+		std::string sceneFilename;
+		// text scene file compiled into the binary scene file
+		// before exiting, if not empty
+		std::string buildSceneInput;
+		std::string buildSceneOutput;
+		// pick up edits to the shader sources and the scene
+		// file while running interactively
+		bool bHotReload;
+		// buffer swaps to wait for, 0 for none and -1 for
+		// adaptive vsync, which tears rather than waits when a
+		// frame is late
+		int swapInterval;
+		// highest frame rate while running interactively, 0
+		// for no cap
+		double frameRateCap;
+		// fixed steps per second of the camera on its own
+		// thread, 0 to move it once per frame
+		double simulationRate;
+		// only draw a frame when the view or the scene has
+		// changed, and sleep in between
+		bool bOnDemand;
+		// draw the interactive camera on the left half of the
+		// window and a floor plan from above on the right half
+		bool bSplitView;
+		// list of snapshot images rendered offscreen and written
+		// to files before exiting, if not empty
+		std::string snapshotListFilename;
+		// size and samples per pixel of the snapshot images
+		int snapshotWidth;
+		int snapshotHeight;
+		int snapshotSamples;
+	};
+}
+
+// Function declarations - all functions that are called manually
+// need to be pre-declared at the beginning of the source code.
+bool InitializeGLFW();
+bool InitializeGLEW();
+bool ParseCommandLine(int argc, char* argv[], APP_OPTIONS& options);
+void RenderFrame();
+bool ReloadShaders();
+void ApplySwapInterval(int swapInterval);
+void RunBenchmark(const APP_OPTIONS& options);
+void RunSnapshots(const APP_OPTIONS& options);
+
+
+/***********************************************************
+ *  main(int, char*)
+ *
+ *  This function gets called after the application has been
+ *  launched.
+ ***********************************************************/
+int main(int argc, char* argv[])
+{
+	APP_OPTIONS options;
+	if (ParseCommandLine(argc, argv, options) == false)
+	{
+		return(EXIT_FAILURE);
+	}
+
+	// compiling a scene file needs no window or GL context
+	if (options.buildSceneInput.empty() == false)
+	{
+		if (SceneFile::Build(options.buildSceneInput, options.buildSceneOutput) == false)
+		{
+			return(EXIT_FAILURE);
+		}
+		std::cout << "Compiled " << options.buildSceneInput << " into " << options.buildSceneOutput << std::endl;
+		return(EXIT_SUCCESS);
+	}
+
+	// if GLFW fails initialization, then terminate the application
+	if (InitializeGLFW() == false)
+	{
+		return(EXIT_FAILURE);
+	}
+
+	// the benchmark and the snapshots render into a window
+	// that is never shown
+	if ((options.bBenchmark == true) || (options.bBuildTextureCache == true) ||
+		(options.snapshotListFilename.empty() == false))
+	{
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+	}
+
+	// try to create a new shader manager object
+	g_ShaderManager = new ShaderManager();
+	// try to create a new view manager object
+	g_ViewManager = new ViewManager(
+		g_ShaderManager);
+
+	// try to create the main display window
+	g_Window = g_ViewManager->CreateDisplayWindow(WINDOW_TITLE);
+
+	if (options.bSplitView == true)
+	{
+		// the floor plan looks straight down, with the far end
+		// of the gym at the top
+		ViewManager::VIEWPORT_RECT cameraViewport = { 0.0f, 0.0f, 0.5f, 1.0f };
+		ViewManager::VIEWPORT_RECT floorPlanViewport = { 0.5f, 0.0f, 0.5f, 1.0f };
+		g_ViewManager->SetMainViewport(cameraViewport);
+		g_ViewManager->AddFixedCamera(
+			glm::vec3(0.0f, FLOOR_PLAN_HEIGHT, 0.0f),
+			glm::vec3(0.0f, 0.0f, 0.0f),
+			glm::vec3(0.0f, 0.0f, -1.0f),
+			FLOOR_PLAN_SIZE,
+			floorPlanViewport);
+	}
+
+	// if GLEW fails initialization, then terminate the application
+	if (InitializeGLEW() == false)
+	{
+		return(EXIT_FAILURE);
+	}
+
+	// load the shader code from the external GLSL files
+	g_ShaderManager->LoadShaders(
+		VERTEX_SHADER_FILE,
+		FRAGMENT_SHADER_FILE);
+	g_ShaderManager->use();
+
+	// try to create a new scene manager object and prepare the 3D scene
+	g_SceneManager = new SceneManager(g_ShaderManager);
+	g_SceneManager->SetRackCount(options.rackCount);
+	g_SceneManager->SetFrustumCulling(options.bFrustumCulling);
+	g_SceneManager->SetStaticBatching(options.bStaticBatching);
+	g_SceneManager->SetGpuCulling(options.bGpuCulling);
+	g_SceneManager->SetDepthPrepass(options.bDepthPrepass);
+	g_SceneManager->SetVertexFormat(options.vertexFormat);
+	g_SceneManager->SetShadows(options.bShadows);
+	g_SceneManager->SetMovingShadows(options.bMovingShadows);
+	g_SceneManager->SetClusteredLighting(options.bClusteredLighting);
+	g_SceneManager->SetCeilingLightCount(options.ceilingLights);
+	g_SceneManager->SetWorkerThreadCount(options.workerThreads);
+	if (options.sceneFilename.empty() == false)
+	{
+		g_SceneManager->SetSceneFile(options.sceneFilename);
+	}
+	if (options.textureBudgetMB > 0)
+	{
+		g_SceneManager->SetTextureBudget((size_t)options.textureBudgetMB * 1024 * 1024);
+	}
+	g_SceneManager->PrepareScene();
+	if ((options.bIndirectDraw == false) &&
+		(g_SceneManager->GetRenderPath() == SceneManager::RENDER_PATH_INDIRECT))
+	{
+		g_SceneManager->SetRenderPath(SceneManager::RENDER_PATH_INSTANCED);
+	}
+
+	// create the profiler, optionally writing every frame to
+	// the CSV file passed with --profile-csv <filename>
+	g_FrameProfiler = new FrameProfiler();
+	g_FrameProfiler->Initialize();
+	if (options.csvFilename.empty() == false)
+	{
+		g_FrameProfiler->OpenCSV(options.csvFilename);
+	}
+
+	if (options.bBuildTextureCache == true)
+	{
+		g_SceneManager->WaitForTextures();
+		std::cout << "Texture cache is up to date" << std::endl;
+	}
+	else if (options.bBenchmark == true)
+	{
+		RunBenchmark(options);
+	}
+	else if (options.snapshotListFilename.empty() == false)
+	{
+		RunSnapshots(options);
+	}
+
+	double lastTitleRefresh = glfwGetTime();
+
+	// watch the shader sources and the scene file, so that
+	// edits show up without restarting
+	FileWatcher fileWatcher;
+	int sceneFileID = -1;
+	std::vector<int> changedFiles;
+	if (options.bHotReload == true)
+	{
+		fileWatcher.Watch(VERTEX_SHADER_FILE);
+		fileWatcher.Watch(FRAGMENT_SHADER_FILE);
+		if (options.sceneFilename.empty() == false)
+		{
+			sceneFileID = fileWatcher.Watch(options.sceneFilename);
+		}
+	}
+
+	// pace the interactive frames, and move the camera on its
+	// own thread when asked to
+	FramePacer framePacer;
+	framePacer.SetFrameRateCap(options.frameRateCap);
+	if ((options.bBenchmark == false) && (options.bBuildTextureCache == false) &&
+		(options.snapshotListFilename.empty() == true))
+	{
+		ApplySwapInterval(options.swapInterval);
+		if (options.simulationRate > 0.0)
+		{
+			g_ViewManager->StartSimulationThread(options.simulationRate);
+		}
+	}
+
+	int settleFrames = IDLE_SETTLE_FRAMES;
+
+	// loop will keep running until the application is closed 
+	// or until an error has occurred
+	while ((options.bBenchmark == false) && (options.bBuildTextureCache == false) &&
+		(options.snapshotListFilename.empty() == true) && !glfwWindowShouldClose(g_Window))
+	{
+		// on demand, a frame is only drawn for a change and the
+		// few frames after it, otherwise the window keeps
+		// showing the frame that was presented last
+		bool bChanged = (g_ViewManager->IsViewDirty() == true) || (g_SceneManager->NeedsRedraw() == true);
+		bool bDrawFrame = (options.bOnDemand == false) || (bChanged == true) || (settleFrames > 0);
+		if (bDrawFrame == true)
+		{
+			settleFrames = (bChanged == true) ? IDLE_SETTLE_FRAMES : settleFrames - 1;
+			RenderFrame();
+
+			// show the rolling frame statistics in the window title
+			if (glfwGetTime() - lastTitleRefresh >= TITLE_REFRESH_SECONDS)
+			{
+				std::string title = std::string(WINDOW_TITLE) + " | " + g_FrameProfiler->GetSummary();
+				glfwSetWindowTitle(g_Window, title.c_str());
+				lastTitleRefresh = glfwGetTime();
+			}
+		}
+
+		// rebuild what the edited files affect
+		if ((options.bHotReload == true) && (fileWatcher.Poll(changedFiles) == true))
+		{
+			bool bShadersChanged = false;
+			for (int i = 0; i < changedFiles.size(); i++)
+			{
+				if (changedFiles[i] == sceneFileID)
+				{
+					g_SceneManager->ReloadSceneFile();
+				}
+				else
+				{
+					bShadersChanged = true;
+				}
+			}
+			if (bShadersChanged == true)
+			{
+				ReloadShaders();
+			}
+		}
+
+		// wait out the frame cap, then query the latest GLFW
+		// events right before they are used - with nothing to
+		// draw, sleep until there is input, waking up in time
+		// for the next check of the watched files
+		if (bDrawFrame == true)
+		{
+			framePacer.WaitForNextFrame();
+			glfwPollEvents();
+		}
+		else if (options.bHotReload == true)
+		{
+			glfwWaitEventsTimeout(HOT_RELOAD_WAIT_SECONDS);
+		}
+		else
+		{
+			glfwWaitEvents();
+		}
+	}
+	g_ViewManager->StopSimulationThread();
+
+	// clear the allocated manager objects from memory
+	if (NULL != g_FrameProfiler)
+	{
+		delete g_FrameProfiler;
+		g_FrameProfiler = NULL;
+	}
+	if (NULL != g_SceneManager)
+	{
+		delete g_SceneManager;
+		g_SceneManager = NULL;
+	}
+	if (NULL != g_ViewManager)
+	{
+		delete g_ViewManager;
+		g_ViewManager = NULL;
+	}
+	if (NULL != g_ShaderManager)
+	{
+		delete g_ShaderManager;
+		g_ShaderManager = NULL;
+	}
+
+	// everything created through the tracked GPU resource classes
+	// should be freed by now, so anything left is a leak
+	if (GpuResourceTracker::GetTotalCount() > 0)
+	{
+		std::cout << "GPU resources still alive at exit:" << std::endl
+			<< GpuResourceTracker::GetReport();
+	}
+
+	// Terminates the program successfully
+	exit(EXIT_SUCCESS); 
+}
+
+/***********************************************************
+ *	InitializeGLFW()
+ * 
+ *  This function is used to initialize the GLFW library.   
+ ***********************************************************/
+bool InitializeGLFW()
+{
+	// GLFW: initialize and configure library
+	// --------------------------------------
+	glfwInit();
+
+	// set the version of OpenGL and profile to use - the
+	// shaders are written for OpenGL 4.4, which is the oldest
+	// context the drivers are asked for, so macOS and its 4.1
+	// contexts are not supported
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 4);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	// GLFW: end -------------------------------
+
+	return(true);
+}
+
+/***********************************************************
+ *	InitializeGLEW()
+ *
+ *  This function is used to initialize the GLEW library.
+ ***********************************************************/
+bool InitializeGLEW()
+{
+	// GLEW: initialize
+	// -----------------------------------------
+	GLenum GLEWInitResult = GLEW_OK;
+
+	// try to initialize the GLEW library
+	GLEWInitResult = glewInit();
+	if (GLEW_OK != GLEWInitResult)
+	{
+		std::cerr << glewGetErrorString(GLEWInitResult) << std::endl;
+		return false;
+	}
+	// GLEW: end -------------------------------
+
+	// the shaders, storage buffers and persistent mappings
+	// are all core in OpenGL 4.4, so there is no fallback
+	// for older contexts
+	if (GLEW_VERSION_4_4 == GL_FALSE)
+	{
+		std::cerr << "OpenGL 4.4 is required, the context is: " << glGetString(GL_VERSION) << std::endl;
+		return false;
+	}
+
+	// Displays a successful OpenGL initialization message
+	std::cout << "INFO: OpenGL Successfully Initialized\n";
+	std::cout << "INFO: OpenGL Version: " << glGetString(GL_VERSION) << "\n" << std::endl;
+
+	return(true);
+}
+
+/***********************************************************
+ *	ParseCommandLine()
+ *
+ *  This function is used to read the settings from the
+ *  command line arguments:
+ *    --benchmark          run the headless benchmark
+ *    --frames <N>         number of measured benchmark frames
+ *    --warmup <N>         number of frames before measuring
+ *    --racks <K>          copies of the dumbbell rack
+ *    --no-cull            draw objects outside the view too
+ *    --no-static-batch    draw every object on its own
+ *    --no-indirect        one draw call per instanced batch
+ *    --no-gpu-cull        cull the objects on the CPU instead
+ *    --depth-prepass      draw the opaque depth before shading
+ *    --vertex-format <F>  float, packed or half shape vertices
+ *    --no-shadows         light the scene without shadow maps
+ *    --no-moving-shadows  only the objects that never move cast shadows
+ *    --no-clustered-lights loop over every light per fragment
+ *    --lights <N>         ceiling fixture lights to add
+ *    --threads <N>        worker threads building the draw list
+ *    --profile-csv <file> write every frame to a CSV file
+ *    --build-texture-cache compress the scene textures and exit
+ *    --texture-budget <MB> GPU memory limit for the textures
+ *    --scene <file>       load the scene from a scene file
+ *    --build-scene <text> <binary> compile a scene file and exit
+ *    --no-hot-reload      ignore edits to the shaders and scene file
+ *    --swap-interval <N>  swaps per frame, 0 off, -1 adaptive vsync
+ *    --fps-cap <N>        highest frame rate, 0 for no cap
+ *    --fixed-step <N>     move the camera N times a second on its own thread
+ *    --on-demand          only draw when the view or the scene changes
+ *    --split-view         show a floor plan next to the camera view
+ *    --snapshots <file>   render the images of a snapshot list and exit
+ *    --snapshot-size <W> <H> pixel size of the snapshot images
+ *    --snapshot-samples <N> samples per pixel of the snapshot images
+ ***********************************************************/
+bool ParseCommandLine(int argc, char* argv[], APP_OPTIONS& options)
+{
+	options.bBenchmark = false;
+	options.benchmarkFrames = 1000;
+	options.warmupFrames = 60;
+	options.rackCount = 1;
+	options.bFrustumCulling = true;
+	options.bStaticBatching = true;
+	options.bIndirectDraw = true;
+	options.bGpuCulling = true;
+	options.bDepthPrepass = false;
+	options.vertexFormat = InstancedMeshes::VERTEX_FORMAT_PACKED;
+	options.bShadows = true;
+	options.bMovingShadows = true;
+	options.bClusteredLighting = true;
+	options.ceilingLights = 0;
+	options.workerThreads = -1;
+	options.csvFilename.clear();
+	options.bBuildTextureCache = false;
+	options.textureBudgetMB = 0;
+	options.sceneFilename.clear();
+	options.buildSceneInput.clear();
+	options.buildSceneOutput.clear();
+	options.bHotReload = true;
+	options.swapInterval = 1;
+	options.frameRateCap = 0.0;
+	options.simulationRate = 0.0;
+	options.bOnDemand = false;
+	options.bSplitView = false;
+	options.snapshotListFilename.clear();
+	options.snapshotWidth = 1920;
+	options.snapshotHeight = 1080;
+	options.snapshotSamples = 8;
+
+	for (int i = 1; i < argc; i++)
+	{
+		bool bHasValue = (i + 1 < argc);
+
+		if (strcmp(argv[i], "--benchmark") == 0)
+		{
+			options.bBenchmark = true;
+		}
+		else if ((strcmp(argv[i], "--frames") == 0) && bHasValue)
+		{
+			options.benchmarkFrames = std::max(atoi(argv[++i]), 1);
+		}
+		else if ((strcmp(argv[i], "--warmup") == 0) && bHasValue)
+		{
+			options.warmupFrames = std::max(atoi(argv[++i]), 0);
+		}
+		else if ((strcmp(argv[i], "--racks") == 0) && bHasValue)
+		{
+			options.rackCount = std::max(atoi(argv[++i]), 1);
+		}
+		else if (strcmp(argv[i], "--no-cull") == 0)
+		{
+			options.bFrustumCulling = false;
+		}
+		else if (strcmp(argv[i], "--no-static-batch") == 0)
+		{
+			options.bStaticBatching = false;
+		}
+		else if (strcmp(argv[i], "--no-indirect") == 0)
+		{
+			options.bIndirectDraw = false;
+		}
+		else if (strcmp(argv[i], "--no-gpu-cull") == 0)
+		{
+			options.bGpuCulling = false;
+		}
+		else if (strcmp(argv[i], "--depth-prepass") == 0)
+		{
+			options.bDepthPrepass = true;
+		}
+		else if ((strcmp(argv[i], "--vertex-format") == 0) && bHasValue)
+		{
+			i++;
+			if (strcmp(argv[i], "float") == 0)
+			{
+				options.vertexFormat = InstancedMeshes::VERTEX_FORMAT_FLOAT;
+			}
+			else if (strcmp(argv[i], "packed") == 0)
+			{
+				options.vertexFormat = InstancedMeshes::VERTEX_FORMAT_PACKED;
+			}
+			else if (strcmp(argv[i], "half") == 0)
+			{
+				options.vertexFormat = InstancedMeshes::VERTEX_FORMAT_PACKED_HALF;
+			}
+			else
+			{
+				std::cerr << "Unknown vertex format: " << argv[i] << std::endl;
+				return(false);
+			}
+		}
+		else if (strcmp(argv[i], "--no-shadows") == 0)
+		{
+			options.bShadows = false;
+		}
+		else if (strcmp(argv[i], "--no-moving-shadows") == 0)
+		{
+			options.bMovingShadows = false;
+		}
+		else if (strcmp(argv[i], "--no-clustered-lights") == 0)
+		{
+			options.bClusteredLighting = false;
+		}
+		else if ((strcmp(argv[i], "--lights") == 0) && bHasValue)
+		{
+			options.ceilingLights = std::max(atoi(argv[++i]), 0);
+		}
+		else if ((strcmp(argv[i], "--threads") == 0) && bHasValue)
+		{
+			options.workerThreads = std::max(atoi(argv[++i]), 0);
+		}
+		else if ((strcmp(argv[i], "--profile-csv") == 0) && bHasValue)
+		{
+			options.csvFilename = argv[++i];
+		}
+		else if (strcmp(argv[i], "--build-texture-cache") == 0)
+		{
+			options.bBuildTextureCache = true;
+		}
+		else if ((strcmp(argv[i], "--texture-budget") == 0) && bHasValue)
+		{
+			options.textureBudgetMB = std::max(atoi(argv[++i]), 0);
+		}
+		else if ((strcmp(argv[i], "--scene") == 0) && bHasValue)
+		{
+			options.sceneFilename = argv[++i];
+		}
+		else if ((strcmp(argv[i], "--build-scene") == 0) && (i + 2 < argc))
+		{
+			options.buildSceneInput = argv[++i];
+			options.buildSceneOutput = argv[++i];
+		}
+		else if (strcmp(argv[i], "--no-hot-reload") == 0)
+		{
+			options.bHotReload = false;
+		}
+		else if ((strcmp(argv[i], "--swap-interval") == 0) && bHasValue)
+		{
+			options.swapInterval = std::max(atoi(argv[++i]), -1);
+		}
+		else if ((strcmp(argv[i], "--fps-cap") == 0) && bHasValue)
+		{
+			options.frameRateCap = std::max(atof(argv[++i]), 0.0);
+		}
+		else if ((strcmp(argv[i], "--fixed-step") == 0) && bHasValue)
+		{
+			options.simulationRate = std::max(atof(argv[++i]), 0.0);
+		}
+		else if (strcmp(argv[i], "--on-demand") == 0)
+		{
+			options.bOnDemand = true;
+		}
+		else if (strcmp(argv[i], "--split-view") == 0)
+		{
+			options.bSplitView = true;
+		}
+		else if ((strcmp(argv[i], "--snapshots") == 0) && bHasValue)
+		{
+			options.snapshotListFilename = argv[++i];
+		}
+		else if ((strcmp(argv[i], "--snapshot-size") == 0) && (i + 2 < argc))
+		{
+			options.snapshotWidth = std::max(atoi(argv[++i]), 1);
+			options.snapshotHeight = std::max(atoi(argv[++i]), 1);
+		}
+		else if ((strcmp(argv[i], "--snapshot-samples") == 0) && bHasValue)
+		{
+			options.snapshotSamples = std::max(atoi(argv[++i]), 1);
+		}
+		else
+		{
+			std::cerr << "Unknown or incomplete argument: " << argv[i] << std::endl;
+			std::cerr << "Usage: " << argv[0]
+				<< " [--benchmark] [--frames N] [--warmup N] [--racks K] [--no-cull] [--no-static-batch] [--no-indirect] [--no-gpu-cull] [--depth-prepass] [--vertex-format float|packed|half] [--no-shadows] [--no-moving-shadows] [--no-clustered-lights] [--lights N] [--threads N] [--profile-csv file] [--build-texture-cache] [--texture-budget MB] [--scene file] [--build-scene text binary] [--no-hot-reload] [--swap-interval N] [--fps-cap N] [--fixed-step N] [--on-demand] [--split-view] [--snapshots file] [--snapshot-size W H] [--snapshot-samples N]" << std::endl;
+			return(false);
+		}
+	}
+
+	return(true);
+}
+
+/***********************************************************
+ *	ReloadShaders()
+ *
+ *  This function is used to build the scene shader program
+ *  again from its edited sources. The new program only
+ *  replaces the running one once it has linked, so a source
+ *  with an error keeps the scene drawing with the old one.
+ ***********************************************************/
+bool ReloadShaders()
+{
+	GLuint previousProgram = g_ShaderManager->m_programID;
+	g_ShaderManager->LoadShaders(
+		VERTEX_SHADER_FILE,
+		FRAGMENT_SHADER_FILE);
+	GLuint program = g_ShaderManager->m_programID;
+
+	GLint linkStatus = GL_FALSE;
+	if ((program != 0) && (program != previousProgram))
+	{
+		glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+	}
+	if (linkStatus != GL_TRUE)
+	{
+		if ((program != 0) && (program != previousProgram))
+		{
+			glDeleteProgram(program);
+		}
+		g_ShaderManager->m_programID = previousProgram;
+		g_ShaderManager->use();
+		std::cout << "Shaders failed to build, keeping the previous program" << std::endl;
+		return(false);
+	}
+
+	glDeleteProgram(previousProgram);
+	g_ShaderManager->use();
+	g_SceneManager->RefreshShaderProgram();
+	std::cout << "Shaders reloaded" << std::endl;
+
+	return(true);
+}
+
+/***********************************************************
+ *	RenderFrame()
+ *
+ *  This function is used to render and present one frame of
+ *  the 3D scene, recording its timings with the profiler.
+ ***********************************************************/
+void RenderFrame()
+{
+	g_FrameProfiler->BeginFrame();
+
+	// Enable z-depth
+	glEnable(GL_DEPTH_TEST);
+
+	// Clear the frame and z buffers
+	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	// convert from 3D object space to 2D view
+	g_FrameProfiler->BeginSection(FrameProfiler::SECTION_PREPARE_VIEW);
+	g_ViewManager->PrepareSceneView();
+	if (g_ViewManager->GetCameraViewCount() > 1)
+	{
+		// every camera is drawn from the same draw list
+		std::vector<SceneManager::SCENE_VIEW> sceneViews(g_ViewManager->GetCameraViewCount());
+		for (int i = 0; i < sceneViews.size(); i++)
+		{
+			const ViewManager::CAMERA_VIEW& cameraView = g_ViewManager->GetCameraView(i);
+			sceneViews[i].view = cameraView.view;
+			sceneViews[i].projection = cameraView.projection;
+			sceneViews[i].viewPosition = cameraView.viewPosition;
+			sceneViews[i].viewportX = cameraView.viewportX;
+			sceneViews[i].viewportY = cameraView.viewportY;
+			sceneViews[i].viewportWidth = cameraView.viewportWidth;
+			sceneViews[i].viewportHeight = cameraView.viewportHeight;
+		}
+		g_SceneManager->SetSceneViews(sceneViews);
+	}
+	else
+	{
+		g_SceneManager->SetSceneView(
+			g_ViewManager->GetViewMatrix(),
+			g_ViewManager->GetProjectionMatrix(),
+			g_ViewManager->GetViewPosition());
+	}
+	g_FrameProfiler->EndSection(FrameProfiler::SECTION_PREPARE_VIEW);
+
+	// refresh the 3D scene
+	g_FrameProfiler->BeginSection(FrameProfiler::SECTION_RENDER_SCENE);
+	g_FrameProfiler->BeginGPUTimer();
+	g_SceneManager->RenderScene();
+	g_FrameProfiler->EndGPUTimer();
+	g_FrameProfiler->EndSection(FrameProfiler::SECTION_RENDER_SCENE);
+
+	g_FrameProfiler->SetCounter(FrameProfiler::COUNTER_DRAW_CALLS, g_SceneManager->GetDrawCallCount());
+	g_FrameProfiler->SetCounter(FrameProfiler::COUNTER_UNIFORM_UPLOADS, g_SceneManager->GetUniformUploadCount());
+	g_FrameProfiler->SetCounter(FrameProfiler::COUNTER_TEXTURE_BINDS, g_SceneManager->GetTextureBindCount());
+	g_FrameProfiler->SetCounter(FrameProfiler::COUNTER_VISIBLE_ITEMS, g_SceneManager->GetVisibleItemCount());
+	g_FrameProfiler->SetCounter(FrameProfiler::COUNTER_CULLED_ITEMS, g_SceneManager->GetCulledItemCount());
+
+	// Flips the the back buffer with the front buffer every frame.
+	g_FrameProfiler->BeginSection(FrameProfiler::SECTION_SWAP_BUFFERS);
+	glfwSwapBuffers(g_Window);
+	g_FrameProfiler->EndSection(FrameProfiler::SECTION_SWAP_BUFFERS);
+
+	g_FrameProfiler->EndFrame();
+}
+
+/***********************************************************
+ *	ApplySwapInterval()
+ *
+ *  This function is used to set how many display refreshes
+ *  each buffer swap waits for. Adaptive vsync (-1) needs the
+ *  swap control tear extension, and falls back to regular
+ *  vsync without it.
+ ***********************************************************/
+void ApplySwapInterval(int swapInterval)
+{
+	if ((swapInterval < 0) &&
+		(glfwExtensionSupported("WGL_EXT_swap_control_tear") == GLFW_FALSE) &&
+		(glfwExtensionSupported("GLX_EXT_swap_control_tear") == GLFW_FALSE))
+	{
+		std::cout << "Adaptive vsync is not supported, using vsync instead" << std::endl;
+		swapInterval = 1;
+	}
+
+	glfwSwapInterval(swapInterval);
+}
+
+/***********************************************************
+ *	RunBenchmark()
+ *
+ *  This function is used to replay the default camera flight
+ *  with vsync off and print the frame statistics. The flight
+ *  runs once over the measured frames, so every run renders
+ *  the same views in the same order.
+ ***********************************************************/
+void RunBenchmark(const APP_OPTIONS& options)
+{
+	CameraPath path = CameraPath::CreateDefaultPath();
+
+	// every run measures the final textures, not the placeholders
+	g_SceneManager->WaitForTextures();
+
+	// present frames as fast as they are rendered
+	glfwSwapInterval(0);
+	g_ViewManager->SetScriptedCamera(true);
+
+	// the warm-up frames fly the same path, so the shader and
+	// driver caches are filled before measuring starts
+	for (int frame = 0; frame < options.warmupFrames; frame++)
+	{
+		CameraPath::CAMERA_KEY pose = path.Sample((float)frame / (float)options.warmupFrames);
+		g_ViewManager->SetCameraPose(pose.position, pose.target);
+		RenderFrame();
+		glfwPollEvents();
+	}
+
+	// wait for the warm-up frames, then keep every measured frame
+	glFinish();
+	g_FrameProfiler->SetHistorySize(options.benchmarkFrames);
+
+	for (int frame = 0; frame < options.benchmarkFrames; frame++)
+	{
+		CameraPath::CAMERA_KEY pose = path.Sample((float)frame / (float)options.benchmarkFrames);
+		g_ViewManager->SetCameraPose(pose.position, pose.target);
+		RenderFrame();
+		glfwPollEvents();
+	}
+	glFinish();
+
+	FrameProfiler::METRIC_STATS frame = g_FrameProfiler->GetFrameStats();
+	FrameProfiler::METRIC_STATS gpu = g_FrameProfiler->GetGPUStats();
+	FrameProfiler::METRIC_STATS draws = g_FrameProfiler->GetCounterStats(FrameProfiler::COUNTER_DRAW_CALLS);
+
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "BENCHMARK: " << options.benchmarkFrames << " frames, "
+		<< options.rackCount << " racks, "
+		<< g_SceneManager->GetRenderItemCount() << " render items" << std::endl;
+	std::cout << "BENCHMARK: frame ms  min " << frame.minimum
+		<< "  mean " << frame.average
+		<< "  p50 " << frame.median
+		<< "  p99 " << frame.p99
+		<< "  max " << frame.maximum << std::endl;
+	std::cout << "BENCHMARK: gpu ms    min " << gpu.minimum
+		<< "  mean " << gpu.average
+		<< "  p50 " << gpu.median
+		<< "  p99 " << gpu.p99
+		<< "  max " << gpu.maximum << std::endl;
+	for (int section = 0; section < FrameProfiler::SECTION_COUNT; section++)
+	{
+		FrameProfiler::METRIC_STATS stats = g_FrameProfiler->GetSectionStats((FrameProfiler::PROFILE_SECTION)section);
+		std::cout << "BENCHMARK: " << FrameProfiler::GetSectionName((FrameProfiler::PROFILE_SECTION)section)
+			<< " ms  mean " << stats.average
+			<< "  p99 " << stats.p99 << std::endl;
+	}
+	FrameProfiler::METRIC_STATS visible = g_FrameProfiler->GetCounterStats(FrameProfiler::COUNTER_VISIBLE_ITEMS);
+	FrameProfiler::METRIC_STATS culled = g_FrameProfiler->GetCounterStats(FrameProfiler::COUNTER_CULLED_ITEMS);
+	std::cout << std::setprecision(1);
+	std::cout << "BENCHMARK: draw calls per frame " << draws.average
+		<< "  static batches " << g_SceneManager->GetStaticBatchCount()
+		<< "  indirect " << ((g_SceneManager->GetRenderPath() == SceneManager::RENDER_PATH_INDIRECT) ? "yes" : "no")
+		<< "  gpu cull " << (g_SceneManager->GetGpuCulling() ? "yes" : "no")
+		<< "  depth pre-pass " << (g_SceneManager->GetDepthPrepass() ? "yes" : "no") << std::endl;
+	std::cout << "BENCHMARK: shadows " << (g_SceneManager->GetShadows() ? "yes" : "no")
+		<< "  moving " << (g_SceneManager->GetMovingShadows() ? "yes" : "no")
+		<< "  static shadow map renders " << g_SceneManager->GetShadowMapRenderCount() << std::endl;
+	std::cout << "BENCHMARK: lights " << g_SceneManager->GetLightSourceCount()
+		<< "  clustered " << (g_SceneManager->GetClusteredLighting() ? "yes" : "no")
+		<< "  cluster builds " << g_SceneManager->GetLightClusterUpdateCount() << std::endl;
+	std::cout << "BENCHMARK: visible items per frame " << visible.average
+		<< "  culled " << culled.average << std::endl;
+	std::cout << "BENCHMARK: texture memory " << (g_SceneManager->GetResidentTextureBytes() / (1024.0 * 1024.0)) << " MB"
+		<< "  evictions " << g_SceneManager->GetTextureEvictionCount() << std::endl;
+	std::cout << "BENCHMARK: GPU memory " << (GpuResourceTracker::GetTotalBytes() / (1024.0 * 1024.0)) << " MB" << std::endl
+		<< GpuResourceTracker::GetReport();
+}
+
+/***********************************************************
+ *	RunSnapshots()
+ *
+ *  This function is used to render every image of the
+ *  snapshot list into the offscreen framebuffer and write
+ *  them to files. The readback and the file writing of an
+ *  image overlap the drawing of the next ones. Every image
+ *  is drawn SNAPSHOT_PASSES times. The streamer follows the
+ *  texture demand of the frame before, so the first pass
+ *  works out the levels the view needs, the second queues
+ *  their loads, which are waited for, and the third draws
+ *  with them. The view and its demand stay the same between
+ *  the passes, so nothing is left to load after the second.
+ *  The GPU culling is turned off, as the occlusion test
+ *  needs the depth of an earlier frame from nearly the same
+ *  view.
+ ***********************************************************/
+void RunSnapshots(const APP_OPTIONS& options)
+{
+	std::vector<SnapshotRenderer::SNAPSHOT_JOB> jobs;
+	if (SnapshotRenderer::LoadJobList(options.snapshotListFilename, jobs) == false)
+	{
+		return;
+	}
+
+	SnapshotRenderer renderer;
+	if (renderer.Create(options.snapshotWidth, options.snapshotHeight, options.snapshotSamples, -1) == false)
+	{
+		std::cout << "Could not create the snapshot framebuffer" << std::endl;
+		return;
+	}
+
+	g_SceneManager->SetGpuCulling(false);
+	g_SceneManager->WaitForTextures();
+
+	float aspect = (float)options.snapshotWidth / (float)options.snapshotHeight;
+	std::string sceneFilename = options.sceneFilename;
+	for (int i = 0; i < jobs.size(); i++)
+	{
+		const SnapshotRenderer::SNAPSHOT_JOB& job = jobs[i];
+		if ((job.sceneFilename.empty() == false) && (job.sceneFilename != sceneFilename))
+		{
+			g_SceneManager->SetSceneFile(job.sceneFilename);
+			if (g_SceneManager->ReloadSceneFile() == false)
+			{
+				std::cout << "Skipping snapshot " << job.imageFilename << std::endl;
+				continue;
+			}
+			sceneFilename = job.sceneFilename;
+		}
+
+		glm::mat4 view = glm::lookAt(job.position, job.target, glm::vec3(0.0f, 1.0f, 0.0f));
+		glm::mat4 projection = glm::perspective(glm::radians(job.fieldOfView), aspect, 0.1f, 100.0f);
+
+		for (int pass = 0; pass < SNAPSHOT_PASSES; pass++)
+		{
+			renderer.BeginImage(SNAPSHOT_CLEAR_COLOR);
+			g_ShaderManager->setMat4Value("view", view);
+			g_ShaderManager->setMat4Value("projection", projection);
+			g_ShaderManager->setVec3Value("viewPosition", job.position);
+			g_SceneManager->SetSceneView(view, projection, job.position);
+			g_SceneManager->RenderScene();
+
+			if (pass + 1 < SNAPSHOT_PASSES)
+			{
+				g_SceneManager->WaitForTextures();
+			}
+		}
+		renderer.EndImage(job.imageFilename);
+	}
+
+	int writtenCount = renderer.Finish();
+	std::cout << "Wrote " << writtenCount << " of " << jobs.size() << " snapshots at "
+		<< renderer.GetWidth() << "x" << renderer.GetHeight() << std::endl;
+	renderer.Destroy();
+}
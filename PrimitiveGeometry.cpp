@@ -0,0 +1,688 @@
+///////////////////////////////////////////////////////////////////////////////
+// primitivegeometry.cpp
+// ============
+// generate the vertex data of the basic 3D shapes
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "PrimitiveGeometry.h"
+
+#include <algorithm>
+#include <cmath>
+
+// declaration of global variables
+namespace
+{
+	const float g_Pi = 3.14159265358979f;
+
+	// radii of the torus ring and of its tube
+	const float g_TorusMainRadius = 1.0f;
+	const float g_TorusTubeRadius = 0.1f;
+
+	// each tessellation level divides the segments of the
+	// default tessellation by this much
+	const int g_LodDivisors[PrimitiveGeometry::LOD_COUNT] = { 1, 2, 4 };
+
+	// number of transformed vertices the cache optimization
+	// expects the GPU to keep
+	const int g_VertexCacheSize = 32;
+}
+
+/***********************************************************
+ *  BuildMesh()
+ *
+ *  This method is used for generating the mesh data for the
+ *  passed in shape type, at the default tessellation.
+ ***********************************************************/
+void PrimitiveGeometry::BuildMesh(MESH_TYPE mesh, MESH_DATA& data)
+{
+	BuildMesh(mesh, 0, data);
+}
+
+/***********************************************************
+ *  BuildMesh()
+ *
+ *  This method is used for generating the mesh data for the
+ *  passed in shape type, with the segments of the default
+ *  tessellation divided down for the coarser levels.
+ ***********************************************************/
+void PrimitiveGeometry::BuildMesh(MESH_TYPE mesh, int lodLevel, MESH_DATA& data)
+{
+	lodLevel = std::max(0, std::min(lodLevel, GetLodCount(mesh) - 1));
+	int divisor = g_LodDivisors[lodLevel];
+
+	switch (mesh)
+	{
+	case MESH_BOX:
+		BuildBox(data);
+		break;
+	case MESH_CONE:
+		BuildCone(data, std::max(36 / divisor, 3));
+		break;
+	case MESH_CYLINDER:
+		BuildCylinder(data, std::max(36 / divisor, 3));
+		break;
+	case MESH_PLANE:
+		BuildPlane(data);
+		break;
+	case MESH_SPHERE:
+		BuildSphere(data, std::max(30 / divisor, 4), std::max(30 / divisor, 4));
+		break;
+	case MESH_TAPERED_CYLINDER:
+		BuildTaperedCylinder(data, std::max(36 / divisor, 3));
+		break;
+	case MESH_TORUS:
+		BuildTorus(data, std::max(40 / divisor, 3), std::max(20 / divisor, 3));
+		break;
+	default:
+		data.vertices.clear();
+		data.indices.clear();
+		break;
+	}
+}
+
+/***********************************************************
+ *  GetLodCount()
+ *
+ *  This method is used for getting how many tessellation
+ *  levels the passed in shape type has. The box and plane
+ *  are flat, so they only have the one.
+ ***********************************************************/
+int PrimitiveGeometry::GetLodCount(MESH_TYPE mesh)
+{
+	if ((mesh == MESH_BOX) || (mesh == MESH_PLANE))
+	{
+		return(1);
+	}
+
+	return(LOD_COUNT);
+}
+
+/***********************************************************
+ *  GetLocalBounds()
+ *
+ *  This method is used for getting the object space bounding
+ *  box of the passed in shape type, before any scale,
+ *  rotation or translation is applied.
+ ***********************************************************/
+void PrimitiveGeometry::GetLocalBounds(MESH_TYPE mesh, glm::vec3& boundsMin, glm::vec3& boundsMax)
+{
+	switch (mesh)
+	{
+	case MESH_BOX:
+		boundsMin = glm::vec3(-0.5f, -0.5f, -0.5f);
+		boundsMax = glm::vec3(0.5f, 0.5f, 0.5f);
+		break;
+	case MESH_PLANE:
+		boundsMin = glm::vec3(-1.0f, 0.0f, -1.0f);
+		boundsMax = glm::vec3(1.0f, 0.0f, 1.0f);
+		break;
+	case MESH_CONE:
+	case MESH_CYLINDER:
+	case MESH_TAPERED_CYLINDER:
+		boundsMin = glm::vec3(-1.0f, 0.0f, -1.0f);
+		boundsMax = glm::vec3(1.0f, 1.0f, 1.0f);
+		break;
+	case MESH_SPHERE:
+		boundsMin = glm::vec3(-1.0f, -1.0f, -1.0f);
+		boundsMax = glm::vec3(1.0f, 1.0f, 1.0f);
+		break;
+	case MESH_TORUS:
+	{
+		float outerRadius = g_TorusMainRadius + g_TorusTubeRadius;
+		boundsMin = glm::vec3(-outerRadius, -outerRadius, -g_TorusTubeRadius);
+		boundsMax = glm::vec3(outerRadius, outerRadius, g_TorusTubeRadius);
+		break;
+	}
+	default:
+		boundsMin = glm::vec3(0.0f, 0.0f, 0.0f);
+		boundsMax = glm::vec3(0.0f, 0.0f, 0.0f);
+		break;
+	}
+}
+
+/***********************************************************
+ *  OptimizeVertexCache()
+ *
+ *  This method is used for reordering the triangles of a
+ *  mesh so that they reuse the vertices the GPU has just
+ *  transformed, and then the vertices into the order they
+ *  are first used in. Each step emits the triangle with the
+ *  best score, where vertices score higher the more recently
+ *  they were used and the fewer triangles they have left,
+ *  following Forsyth's linear speed vertex cache
+ *  optimization. The shape of the mesh is not changed.
+ ***********************************************************/
+void PrimitiveGeometry::OptimizeVertexCache(MESH_DATA& data)
+{
+	const int vertexCount = (int)data.vertices.size();
+	const int triangleCount = (int)(data.indices.size() / 3);
+	if (triangleCount == 0)
+	{
+		return;
+	}
+
+	// triangles using each vertex, as one flat list with
+	// the first entry of every vertex
+	std::vector<int> remaining(vertexCount, 0);
+	for (int i = 0; i < triangleCount * 3; i++)
+	{
+		remaining[data.indices[i]]++;
+	}
+	std::vector<int> firstEntry(vertexCount + 1, 0);
+	for (int i = 0; i < vertexCount; i++)
+	{
+		firstEntry[i + 1] = firstEntry[i] + remaining[i];
+	}
+	std::vector<int> triangleList(triangleCount * 3);
+	std::vector<int> fill(firstEntry.begin(), firstEntry.end() - 1);
+	for (int i = 0; i < triangleCount * 3; i++)
+	{
+		triangleList[fill[data.indices[i]]++] = i / 3;
+	}
+
+	std::vector<int> cachePosition(vertexCount, -1);
+	std::vector<float> vertexScore(vertexCount);
+	for (int i = 0; i < vertexCount; i++)
+	{
+		vertexScore[i] = GetVertexCacheScore(cachePosition[i], remaining[i]);
+	}
+	std::vector<float> triangleScore(triangleCount);
+	for (int i = 0; i < triangleCount; i++)
+	{
+		triangleScore[i] = vertexScore[data.indices[i * 3]] +
+			vertexScore[data.indices[i * 3 + 1]] +
+			vertexScore[data.indices[i * 3 + 2]];
+	}
+
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<uint32_t> indices;
+	indices.reserve(data.indices.size());
+	// most recently used vertex first, with room for the
+	// three vertices of the next triangle
+	std::vector<int> cache;
+	cache.reserve(g_VertexCacheSize + 3);
+	std::vector<int> newCache;
+	newCache.reserve(g_VertexCacheSize + 3);
+
+	int bestTriangle = -1;
+	for (int emitCount = 0; emitCount < triangleCount; emitCount++)
+	{
+		// with no triangle next to the cached vertices left,
+		// start again from the best one of the whole mesh
+		if (bestTriangle < 0)
+		{
+			float bestScore = -1.0f;
+			for (int i = 0; i < triangleCount; i++)
+			{
+				if ((emitted[i] == false) && (triangleScore[i] > bestScore))
+				{
+					bestScore = triangleScore[i];
+					bestTriangle = i;
+				}
+			}
+		}
+
+		emitted[bestTriangle] = true;
+		newCache.clear();
+		for (int corner = 0; corner < 3; corner++)
+		{
+			int vertex = (int)data.indices[bestTriangle * 3 + corner];
+			indices.push_back((uint32_t)vertex);
+			newCache.push_back(vertex);
+
+			// the triangle no longer counts for its vertices
+			remaining[vertex]--;
+			int* pFirst = &triangleList[firstEntry[vertex]];
+			int* pLast = pFirst + remaining[vertex];
+			std::iter_swap(std::find(pFirst, pLast + 1, bestTriangle), pLast);
+		}
+		for (int i = 0; i < cache.size(); i++)
+		{
+			if (std::find(newCache.begin(), newCache.begin() + 3, cache[i]) == newCache.begin() + 3)
+			{
+				newCache.push_back(cache[i]);
+			}
+		}
+		cache.swap(newCache);
+
+		// vertices pushed out of the cache lose their place,
+		// then the cached ones are scored again along with the
+		// triangles they are still part of
+		for (int i = g_VertexCacheSize; i < cache.size(); i++)
+		{
+			cachePosition[cache[i]] = -1;
+			vertexScore[cache[i]] = GetVertexCacheScore(-1, remaining[cache[i]]);
+		}
+		cache.resize(std::min((int)cache.size(), g_VertexCacheSize));
+		for (int i = 0; i < cache.size(); i++)
+		{
+			cachePosition[cache[i]] = i;
+			vertexScore[cache[i]] = GetVertexCacheScore(i, remaining[cache[i]]);
+		}
+
+		bestTriangle = -1;
+		float bestScore = -1.0f;
+		for (int i = 0; i < cache.size(); i++)
+		{
+			int vertex = cache[i];
+			for (int entry = firstEntry[vertex]; entry < firstEntry[vertex] + remaining[vertex]; entry++)
+			{
+				int triangle = triangleList[entry];
+				triangleScore[triangle] = vertexScore[data.indices[triangle * 3]] +
+					vertexScore[data.indices[triangle * 3 + 1]] +
+					vertexScore[data.indices[triangle * 3 + 2]];
+				if (triangleScore[triangle] > bestScore)
+				{
+					bestScore = triangleScore[triangle];
+					bestTriangle = triangle;
+				}
+			}
+		}
+	}
+
+	// number the vertices in the order the triangles first
+	// use them, so they are also fetched in order
+	std::vector<uint32_t> remap(vertexCount, 0xFFFFFFFF);
+	std::vector<VERTEX> vertices;
+	vertices.reserve(vertexCount);
+	for (int i = 0; i < indices.size(); i++)
+	{
+		if (remap[indices[i]] == 0xFFFFFFFF)
+		{
+			remap[indices[i]] = (uint32_t)vertices.size();
+			vertices.push_back(data.vertices[indices[i]]);
+		}
+		indices[i] = remap[indices[i]];
+	}
+
+	data.vertices.swap(vertices);
+	data.indices.swap(indices);
+}
+
+/***********************************************************
+ *  GetVertexCacheScore()
+ *
+ *  This method is used for scoring a vertex from its place
+ *  in the simulated cache, -1 when it is not cached, and the
+ *  number of triangles still to be emitted that use it.
+ ***********************************************************/
+float PrimitiveGeometry::GetVertexCacheScore(int cachePosition, int remainingTriangles)
+{
+	if (remainingTriangles == 0)
+	{
+		return(-1.0f);
+	}
+
+	float score = 0.0f;
+	if (cachePosition >= 3)
+	{
+		float scale = 1.0f / (float)(g_VertexCacheSize - 3);
+		score = std::pow(1.0f - (float)(cachePosition - 3) * scale, 1.5f);
+	}
+	else if (cachePosition >= 0)
+	{
+		// the vertices of the triangle just emitted score the
+		// same, so it does not matter which one is reused
+		score = 0.75f;
+	}
+
+	// vertices with few triangles left are finished off first
+	score += 2.0f * std::pow((float)remainingTriangles, -0.5f);
+
+	return(score);
+}
+
+/***********************************************************
+ *  BuildBox()
+ *
+ *  This method is used for generating a 1x1x1 box centered
+ *  on the origin, with four vertices per face so that each
+ *  face has its own normal and texture coordinates.
+ ***********************************************************/
+void PrimitiveGeometry::BuildBox(MESH_DATA& data)
+{
+	// face normal, then the face U and V axes with U x V = normal
+	const glm::vec3 faces[6][3] = {
+		{ glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f) },
+		{ glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f) },
+		{ glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f) },
+		{ glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f) },
+		{ glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f) },
+		{ glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f) }
+	};
+	const glm::vec2 corners[4] = {
+		glm::vec2(0.0f, 0.0f), glm::vec2(1.0f, 0.0f), glm::vec2(1.0f, 1.0f), glm::vec2(0.0f, 1.0f)
+	};
+
+	data.vertices.clear();
+	data.indices.clear();
+
+	for (int face = 0; face < 6; face++)
+	{
+		uint32_t firstVertex = (uint32_t)data.vertices.size();
+
+		for (int corner = 0; corner < 4; corner++)
+		{
+			VERTEX vertex;
+			vertex.position = (faces[face][0] +
+				faces[face][1] * (corners[corner].x * 2.0f - 1.0f) +
+				faces[face][2] * (corners[corner].y * 2.0f - 1.0f)) * 0.5f;
+			vertex.normal = faces[face][0];
+			vertex.textureCoordinate = corners[corner];
+			data.vertices.push_back(vertex);
+		}
+
+		data.indices.push_back(firstVertex + 0);
+		data.indices.push_back(firstVertex + 1);
+		data.indices.push_back(firstVertex + 2);
+		data.indices.push_back(firstVertex + 0);
+		data.indices.push_back(firstVertex + 2);
+		data.indices.push_back(firstVertex + 3);
+	}
+}
+
+/***********************************************************
+ *  BuildPlane()
+ *
+ *  This method is used for generating a 2x2 plane in the XZ
+ *  plane facing up, centered on the origin.
+ ***********************************************************/
+void PrimitiveGeometry::BuildPlane(MESH_DATA& data)
+{
+	const glm::vec3 positions[4] = {
+		glm::vec3(-1.0f, 0.0f, 1.0f), glm::vec3(1.0f, 0.0f, 1.0f),
+		glm::vec3(1.0f, 0.0f, -1.0f), glm::vec3(-1.0f, 0.0f, -1.0f)
+	};
+	const glm::vec2 textureCoordinates[4] = {
+		glm::vec2(0.0f, 0.0f), glm::vec2(1.0f, 0.0f), glm::vec2(1.0f, 1.0f), glm::vec2(0.0f, 1.0f)
+	};
+
+	data.vertices.clear();
+	data.indices.clear();
+
+	for (int i = 0; i < 4; i++)
+	{
+		VERTEX vertex;
+		vertex.position = positions[i];
+		vertex.normal = glm::vec3(0.0f, 1.0f, 0.0f);
+		vertex.textureCoordinate = textureCoordinates[i];
+		data.vertices.push_back(vertex);
+	}
+
+	const uint32_t indices[6] = { 0, 1, 2, 0, 2, 3 };
+	data.indices.assign(indices, indices + 6);
+}
+
+/***********************************************************
+ *  BuildCylinder()
+ *
+ *  This method is used for generating a capped cylinder with
+ *  a radius of 1 from y = 0 to y = 1.
+ ***********************************************************/
+void PrimitiveGeometry::BuildCylinder(MESH_DATA& data, int slices)
+{
+	BuildRevolvedShape(data, slices, 1.0f, 1.0f);
+}
+
+/***********************************************************
+ *  BuildCone()
+ *
+ *  This method is used for generating a cone with a base
+ *  radius of 1 at y = 0 and its tip at y = 1.
+ ***********************************************************/
+void PrimitiveGeometry::BuildCone(MESH_DATA& data, int slices)
+{
+	BuildRevolvedShape(data, slices, 1.0f, 0.0f);
+}
+
+/***********************************************************
+ *  BuildTaperedCylinder()
+ *
+ *  This method is used for generating a capped cylinder with
+ *  a radius of 1 at y = 0, narrowing to 0.5 at y = 1.
+ ***********************************************************/
+void PrimitiveGeometry::BuildTaperedCylinder(MESH_DATA& data, int slices)
+{
+	BuildRevolvedShape(data, slices, 1.0f, 0.5f);
+}
+
+/***********************************************************
+ *  BuildRevolvedShape()
+ *
+ *  This method is used for generating the sides of a shape
+ *  with a circular cross section that changes linearly from
+ *  the bottom radius at y = 0 to the top radius at y = 1,
+ *  along with the caps at both ends.
+ ***********************************************************/
+void PrimitiveGeometry::BuildRevolvedShape(
+	MESH_DATA& data,
+	int slices,
+	float bottomRadius,
+	float topRadius)
+{
+	data.vertices.clear();
+	data.indices.clear();
+
+	if (slices < 3)
+	{
+		slices = 3;
+	}
+
+	// the side normals tilt up when the shape narrows
+	const float normalY = bottomRadius - topRadius;
+
+	// one pair of bottom and top vertices per slice, with the
+	// first pair repeated at the end for the texture seam
+	for (int i = 0; i <= slices; i++)
+	{
+		float angle = 2.0f * g_Pi * (float)i / (float)slices;
+		float c = std::cos(angle);
+		float s = std::sin(angle);
+		glm::vec3 normal = glm::normalize(glm::vec3(c, normalY, s));
+		float u = (float)i / (float)slices;
+
+		VERTEX bottom;
+		bottom.position = glm::vec3(c * bottomRadius, 0.0f, s * bottomRadius);
+		bottom.normal = normal;
+		bottom.textureCoordinate = glm::vec2(u, 0.0f);
+		data.vertices.push_back(bottom);
+
+		VERTEX top;
+		top.position = glm::vec3(c * topRadius, 1.0f, s * topRadius);
+		top.normal = normal;
+		top.textureCoordinate = glm::vec2(u, 1.0f);
+		data.vertices.push_back(top);
+	}
+
+	for (int i = 0; i < slices; i++)
+	{
+		uint32_t bottom0 = (uint32_t)(i * 2);
+		uint32_t top0 = bottom0 + 1;
+		uint32_t bottom1 = bottom0 + 2;
+		uint32_t top1 = bottom0 + 3;
+
+		data.indices.push_back(bottom0);
+		data.indices.push_back(top0);
+		data.indices.push_back(bottom1);
+		data.indices.push_back(bottom1);
+		data.indices.push_back(top0);
+		data.indices.push_back(top1);
+	}
+
+	AddCap(data, slices, bottomRadius, 0.0f, false);
+	if (topRadius > 0.0f)
+	{
+		AddCap(data, slices, topRadius, 1.0f, true);
+	}
+}
+
+/***********************************************************
+ *  AddCap()
+ *
+ *  This method is used for adding a flat disc of the passed
+ *  in radius at the height y, as a fan around its center.
+ ***********************************************************/
+void PrimitiveGeometry::AddCap(
+	MESH_DATA& data,
+	int slices,
+	float radius,
+	float y,
+	bool bFacingUp)
+{
+	const glm::vec3 normal(0.0f, bFacingUp ? 1.0f : -1.0f, 0.0f);
+	uint32_t center = (uint32_t)data.vertices.size();
+
+	VERTEX vertex;
+	vertex.position = glm::vec3(0.0f, y, 0.0f);
+	vertex.normal = normal;
+	vertex.textureCoordinate = glm::vec2(0.5f, 0.5f);
+	data.vertices.push_back(vertex);
+
+	for (int i = 0; i <= slices; i++)
+	{
+		float angle = 2.0f * g_Pi * (float)i / (float)slices;
+		float c = std::cos(angle);
+		float s = std::sin(angle);
+
+		vertex.position = glm::vec3(c * radius, y, s * radius);
+		vertex.textureCoordinate = glm::vec2(0.5f + 0.5f * c, 0.5f + 0.5f * s);
+		data.vertices.push_back(vertex);
+	}
+
+	for (int i = 0; i < slices; i++)
+	{
+		uint32_t rim0 = center + 1 + i;
+		uint32_t rim1 = rim0 + 1;
+
+		// wind the triangles counter clockwise seen from outside
+		data.indices.push_back(center);
+		data.indices.push_back(bFacingUp ? rim1 : rim0);
+		data.indices.push_back(bFacingUp ? rim0 : rim1);
+	}
+}
+
+/***********************************************************
+ *  BuildSphere()
+ *
+ *  This method is used for generating a sphere with a radius
+ *  of 1 centered on the origin, from stacks of latitude and
+ *  slices of longitude.
+ ***********************************************************/
+void PrimitiveGeometry::BuildSphere(MESH_DATA& data, int stacks, int slices)
+{
+	data.vertices.clear();
+	data.indices.clear();
+
+	if (stacks < 2)
+	{
+		stacks = 2;
+	}
+	if (slices < 3)
+	{
+		slices = 3;
+	}
+
+	for (int stack = 0; stack <= stacks; stack++)
+	{
+		// from the top pole down to the bottom pole
+		float polar = g_Pi * (float)stack / (float)stacks;
+		float ringRadius = std::sin(polar);
+		float y = std::cos(polar);
+
+		for (int slice = 0; slice <= slices; slice++)
+		{
+			float angle = 2.0f * g_Pi * (float)slice / (float)slices;
+
+			VERTEX vertex;
+			vertex.position = glm::vec3(ringRadius * std::cos(angle), y, ringRadius * std::sin(angle));
+			vertex.normal = vertex.position;
+			vertex.textureCoordinate = glm::vec2(
+				(float)slice / (float)slices,
+				1.0f - (float)stack / (float)stacks);
+			data.vertices.push_back(vertex);
+		}
+	}
+
+	const uint32_t ringSize = (uint32_t)(slices + 1);
+	for (int stack = 0; stack < stacks; stack++)
+	{
+		for (int slice = 0; slice < slices; slice++)
+		{
+			uint32_t top0 = (uint32_t)stack * ringSize + (uint32_t)slice;
+			uint32_t top1 = top0 + 1;
+			uint32_t bottom0 = top0 + ringSize;
+			uint32_t bottom1 = bottom0 + 1;
+
+			data.indices.push_back(bottom0);
+			data.indices.push_back(top0);
+			data.indices.push_back(bottom1);
+			data.indices.push_back(bottom1);
+			data.indices.push_back(top0);
+			data.indices.push_back(top1);
+		}
+	}
+}
+
+/***********************************************************
+ *  BuildTorus()
+ *
+ *  This method is used for generating a torus lying in the
+ *  XY plane, centered on the origin.
+ ***********************************************************/
+void PrimitiveGeometry::BuildTorus(MESH_DATA& data, int mainSegments, int tubeSegments)
+{
+	data.vertices.clear();
+	data.indices.clear();
+
+	if (mainSegments < 3)
+	{
+		mainSegments = 3;
+	}
+	if (tubeSegments < 3)
+	{
+		tubeSegments = 3;
+	}
+
+	for (int i = 0; i <= mainSegments; i++)
+	{
+		float mainAngle = 2.0f * g_Pi * (float)i / (float)mainSegments;
+		float cu = std::cos(mainAngle);
+		float su = std::sin(mainAngle);
+
+		for (int j = 0; j <= tubeSegments; j++)
+		{
+			float tubeAngle = 2.0f * g_Pi * (float)j / (float)tubeSegments;
+			float cv = std::cos(tubeAngle);
+			float sv = std::sin(tubeAngle);
+
+			VERTEX vertex;
+			vertex.normal = glm::vec3(cv * cu, cv * su, sv);
+			vertex.position = glm::vec3(g_TorusMainRadius * cu, g_TorusMainRadius * su, 0.0f) +
+				vertex.normal * g_TorusTubeRadius;
+			vertex.textureCoordinate = glm::vec2(
+				(float)i / (float)mainSegments,
+				(float)j / (float)tubeSegments);
+			data.vertices.push_back(vertex);
+		}
+	}
+
+	const uint32_t ringSize = (uint32_t)(tubeSegments + 1);
+	for (int i = 0; i < mainSegments; i++)
+	{
+		for (int j = 0; j < tubeSegments; j++)
+		{
+			uint32_t v00 = (uint32_t)i * ringSize + (uint32_t)j;
+			uint32_t v10 = v00 + ringSize;
+			uint32_t v01 = v00 + 1;
+			uint32_t v11 = v10 + 1;
+
+			data.indices.push_back(v00);
+			data.indices.push_back(v10);
+			data.indices.push_back(v01);
+			data.indices.push_back(v10);
+			data.indices.push_back(v11);
+			data.indices.push_back(v01);
+		}
+	}
+}
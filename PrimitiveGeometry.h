@@ -0,0 +1,100 @@
+///////////////////////////////////////////////////////////////////////////////
+// primitivegeometry.h
+// ============
+// generate the vertex data of the basic 3D shapes
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// basic shape meshes that can be recorded into the render list
+enum MESH_TYPE
+{
+	MESH_BOX = 0,
+	MESH_CONE,
+	MESH_CYLINDER,
+	MESH_PLANE,
+	MESH_SPHERE,
+	MESH_TAPERED_CYLINDER,
+	MESH_TORUS,
+	MESH_COUNT
+};
+
+/***********************************************************
+ *  PrimitiveGeometry
+ *
+ *  This class generates indexed vertex data for the basic
+ *  3D shapes, using the same unit dimensions as ShapeMeshes:
+ *  a 1x1x1 box and a 2x2 plane centered on the origin, a
+ *  cylinder, cone and tapered cylinder with a radius of 1
+ *  from y = 0 to y = 1, a sphere with a radius of 1 and a
+ *  torus in the XY plane with a main radius of 1.
+ ***********************************************************/
+class PrimitiveGeometry
+{
+public:
+	// vertex layout - matches the shader attribute locations
+	// 0 = position, 1 = normal and 2 = texture coordinate
+	struct VERTEX
+	{
+		glm::vec3 position;
+		glm::vec3 normal;
+		glm::vec2 textureCoordinate;
+	};
+
+	// indexed triangle list of one mesh
+	struct MESH_DATA
+	{
+		std::vector<VERTEX> vertices;
+		std::vector<uint32_t> indices;
+	};
+
+	// number of tessellation levels of the curved shapes,
+	// level 0 being the finest
+	static const int LOD_COUNT = 3;
+
+	// generate the mesh data for the passed in shape type
+	static void BuildMesh(MESH_TYPE mesh, MESH_DATA& data);
+	// generate the mesh data for a tessellation level of the
+	// passed in shape type
+	static void BuildMesh(MESH_TYPE mesh, int lodLevel, MESH_DATA& data);
+	// get the number of tessellation levels of a shape type,
+	// which is 1 for the flat shapes
+	static int GetLodCount(MESH_TYPE mesh);
+	// get the object space bounding box of a shape type
+	static void GetLocalBounds(MESH_TYPE mesh, glm::vec3& boundsMin, glm::vec3& boundsMax);
+	// reorder the triangles and vertices of a mesh for the
+	// GPU vertex cache
+	static void OptimizeVertexCache(MESH_DATA& data);
+
+	static void BuildBox(MESH_DATA& data);
+	static void BuildPlane(MESH_DATA& data);
+	static void BuildCylinder(MESH_DATA& data, int slices = 36);
+	static void BuildCone(MESH_DATA& data, int slices = 36);
+	static void BuildTaperedCylinder(MESH_DATA& data, int slices = 36);
+	static void BuildSphere(MESH_DATA& data, int stacks = 30, int slices = 30);
+	static void BuildTorus(MESH_DATA& data, int mainSegments = 40, int tubeSegments = 20);
+
+private:
+	// score of a vertex for the next triangle to be emitted
+	static float GetVertexCacheScore(int cachePosition, int remainingTriangles);
+	// sides and caps of a shape with a circular cross section,
+	// with the passed in radius at y = 0 and y = 1
+	static void BuildRevolvedShape(
+		MESH_DATA& data,
+		int slices,
+		float bottomRadius,
+		float topRadius);
+	// flat disc of the passed in radius at the height y
+	static void AddCap(
+		MESH_DATA& data,
+		int slices,
+		float radius,
+		float y,
+		bool bFacingUp);
+};
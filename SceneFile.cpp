@@ -0,0 +1,975 @@
+///////////////////////////////////////////////////////////////////////////////
+// scenefile.cpp
+// ============
+// read the text form of a scene file and compile it into a packed binary
+// that is used in place once it has been mapped into memory
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "SceneFile.h"
+#include "PrimitiveGeometry.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+
+// declaration of the global variables
+namespace
+{
+	// names of the meshes in the text form, in MESH_TYPE order
+	const char* g_MeshNames[MESH_COUNT] =
+	{
+		"box",
+		"cone",
+		"cylinder",
+		"plane",
+		"sphere",
+		"tapered_cylinder",
+		"torus"
+	};
+
+	// everything read from the text form so far
+	struct COMPILE_STATE
+	{
+		std::string filename;
+		int line;
+		std::vector<SceneFile::SCENE_TEXTURE> textures;
+		std::vector<SceneFile::SCENE_MATERIAL> materials;
+		std::vector<SceneFile::SCENE_LIGHT> lights;
+		std::vector<SceneFile::SCENE_OBJECT> objects;
+		std::vector<SceneFile::SCENE_RACK> racks;
+		std::string strings;
+		// indices of the texture and material tags
+		std::map<std::string, uint32_t> textureTags;
+		std::map<std::string, uint32_t> materialTags;
+		// rack the objects are added to, or -1
+		int openRack;
+		// path from the directory of the binary form to the one
+		// of the text form, put in front of relative image files
+		std::string textureDirectory;
+	};
+
+	/***********************************************************
+	 *  IsAbsolutePath()
+	 *
+	 *  This function checks whether a file name starts at the
+	 *  root of a file system or a drive letter, rather than at
+	 *  the directory it is read from.
+	 ***********************************************************/
+	bool IsAbsolutePath(const std::string& path)
+	{
+		return((path.empty() == false) &&
+			((path[0] == '/') || (path[0] == '\\') || ((path.size() > 1) && (path[1] == ':'))));
+	}
+
+	/***********************************************************
+	 *  GetDirectory()
+	 *
+	 *  This function gets the directory part of a file name up
+	 *  to and including its last separator, or an empty string
+	 *  for a file in the current directory.
+	 ***********************************************************/
+	std::string GetDirectory(const std::string& filename)
+	{
+		size_t separator = filename.find_last_of("/\\");
+		if (separator == std::string::npos)
+		{
+			return(std::string());
+		}
+
+		return(filename.substr(0, separator + 1));
+	}
+
+	/***********************************************************
+	 *  SplitPath()
+	 *
+	 *  This function splits a directory into its names, leaving
+	 *  out the empty ones and the ones naming the same directory.
+	 ***********************************************************/
+	void SplitPath(const std::string& path, std::vector<std::string>& names)
+	{
+		names.clear();
+
+		size_t start = 0;
+		while (start <= path.size())
+		{
+			size_t end = path.find_first_of("/\\", start);
+			if (end == std::string::npos)
+			{
+				end = path.size();
+			}
+			std::string name = path.substr(start, end - start);
+			if ((name.empty() == false) && (name != "."))
+			{
+				names.push_back(name);
+			}
+			start = end + 1;
+		}
+	}
+
+	/***********************************************************
+	 *  GetRelativeDirectory()
+	 *
+	 *  This function gets the path leading from one directory to
+	 *  another, where both are absolute or both are relative to
+	 *  the current directory. An absolute destination is used as
+	 *  it is, and false is returned when no path can be worked
+	 *  out without knowing the current directory.
+	 ***********************************************************/
+	bool GetRelativeDirectory(const std::string& fromDirectory, const std::string& toDirectory, std::string& path)
+	{
+		path.clear();
+		if (fromDirectory == toDirectory)
+		{
+			return(true);
+		}
+		if (IsAbsolutePath(toDirectory) == true)
+		{
+			path = toDirectory;
+			return(true);
+		}
+		if (IsAbsolutePath(fromDirectory) == true)
+		{
+			return(false);
+		}
+
+		std::vector<std::string> fromNames;
+		std::vector<std::string> toNames;
+		SplitPath(fromDirectory, fromNames);
+		SplitPath(toDirectory, toNames);
+
+		size_t common = 0;
+		while ((common < fromNames.size()) && (common < toNames.size()) && (fromNames[common] == toNames[common]))
+		{
+			common++;
+		}
+		for (size_t i = common; i < fromNames.size(); i++)
+		{
+			// the name of the parent directory is not known
+			if (fromNames[i] == "..")
+			{
+				return(false);
+			}
+			path.append("../");
+		}
+		for (size_t i = common; i < toNames.size(); i++)
+		{
+			path.append(toNames[i]);
+			path.push_back('/');
+		}
+
+		return(true);
+	}
+
+	/***********************************************************
+	 *  ReportError()
+	 *
+	 *  This function prints an error at the current line of the
+	 *  text form, and returns false for the caller to pass on.
+	 ***********************************************************/
+	bool ReportError(const COMPILE_STATE& state, const std::string& message)
+	{
+		std::cout << state.filename << "(" << state.line << "): " << message << std::endl;
+		return(false);
+	}
+
+	/***********************************************************
+	 *  AddString()
+	 *
+	 *  This function appends a null terminated string to the
+	 *  string table, returning its offset.
+	 ***********************************************************/
+	uint32_t AddString(COMPILE_STATE& state, const std::string& text)
+	{
+		uint32_t offset = (uint32_t)state.strings.size();
+		state.strings.append(text);
+		state.strings.push_back('\0');
+		return(offset);
+	}
+
+	/***********************************************************
+	 *  SplitLine()
+	 *
+	 *  This function splits a line of the text form into its
+	 *  words. Quotes keep the spaces of a file name in one word
+	 *  and a # outside of quotes starts a comment.
+	 ***********************************************************/
+	bool SplitLine(const std::string& line, std::vector<std::string>& tokens)
+	{
+		tokens.clear();
+
+		size_t i = 0;
+		while (i < line.size())
+		{
+			char c = line[i];
+			if ((c == ' ') || (c == '\t') || (c == '\r'))
+			{
+				i++;
+			}
+			else if (c == '#')
+			{
+				break;
+			}
+			else if (c == '"')
+			{
+				size_t close = line.find('"', i + 1);
+				if (close == std::string::npos)
+				{
+					return(false);
+				}
+				tokens.push_back(line.substr(i + 1, close - i - 1));
+				i = close + 1;
+			}
+			else
+			{
+				size_t end = line.find_first_of(" \t\r#\"", i);
+				if (end == std::string::npos)
+				{
+					end = line.size();
+				}
+				tokens.push_back(line.substr(i, end - i));
+				i = end;
+			}
+		}
+
+		return(true);
+	}
+
+	/***********************************************************
+	 *  ReadValues()
+	 *
+	 *  This function reads the numbers following the keyword at
+	 *  the passed in word, leaving the index at the last one.
+	 ***********************************************************/
+	bool ReadValues(
+		const COMPILE_STATE& state,
+		const std::vector<std::string>& tokens,
+		size_t& index,
+		int count,
+		float* pValues)
+	{
+		if (index + count >= tokens.size())
+		{
+			return(ReportError(state, "'" + tokens[index] + "' needs " + std::to_string(count) + " values"));
+		}
+
+		for (int i = 0; i < count; i++)
+		{
+			const char* pText = tokens[index + 1 + i].c_str();
+			char* pEnd = NULL;
+			pValues[i] = strtof(pText, &pEnd);
+			if ((pEnd == pText) || (*pEnd != '\0'))
+			{
+				return(ReportError(state, "'" + tokens[index + 1 + i] + "' is not a number"));
+			}
+		}
+		index += count;
+
+		return(true);
+	}
+
+	/***********************************************************
+	 *  ReadTexture()
+	 *
+	 *  This function reads a line of the form
+	 *    texture <tag> <filename>
+	 *  where a relative file name is relative to the text form.
+	 ***********************************************************/
+	bool ReadTexture(COMPILE_STATE& state, const std::vector<std::string>& tokens)
+	{
+		if (tokens.size() != 3)
+		{
+			return(ReportError(state, "expected: texture <tag> <filename>"));
+		}
+		if (state.textureTags.find(tokens[1]) != state.textureTags.end())
+		{
+			return(ReportError(state, "texture '" + tokens[1] + "' is defined twice"));
+		}
+
+		std::string filename = tokens[2];
+		if (IsAbsolutePath(filename) == false)
+		{
+			filename = state.textureDirectory + filename;
+		}
+
+		SceneFile::SCENE_TEXTURE texture;
+		texture.tag = AddString(state, tokens[1]);
+		texture.filename = AddString(state, filename);
+		state.textureTags[tokens[1]] = (uint32_t)state.textures.size();
+		state.textures.push_back(texture);
+
+		return(true);
+	}
+
+	/***********************************************************
+	 *  ReadMaterial()
+	 *
+	 *  This function reads a line of the form
+	 *    material <tag> [ambient r g b] [strength s]
+	 *      [diffuse r g b] [specular r g b] [shininess s]
+	 *      [transparent]
+	 ***********************************************************/
+	bool ReadMaterial(COMPILE_STATE& state, const std::vector<std::string>& tokens)
+	{
+		if (tokens.size() < 2)
+		{
+			return(ReportError(state, "expected: material <tag> ..."));
+		}
+		if (state.materialTags.find(tokens[1]) != state.materialTags.end())
+		{
+			return(ReportError(state, "material '" + tokens[1] + "' is defined twice"));
+		}
+
+		SceneFile::SCENE_MATERIAL material;
+		material.ambientColor = glm::vec3(0.0f, 0.0f, 0.0f);
+		material.ambientStrength = 0.0f;
+		material.diffuseColor = glm::vec3(0.0f, 0.0f, 0.0f);
+		material.shininess = 0.0f;
+		material.specularColor = glm::vec3(0.0f, 0.0f, 0.0f);
+		material.flags = 0;
+
+		bool bResult = true;
+		for (size_t i = 2; (i < tokens.size()) && (bResult == true); i++)
+		{
+			if (tokens[i] == "ambient")
+			{
+				bResult = ReadValues(state, tokens, i, 3, &material.ambientColor.x);
+			}
+			else if (tokens[i] == "strength")
+			{
+				bResult = ReadValues(state, tokens, i, 1, &material.ambientStrength);
+			}
+			else if (tokens[i] == "diffuse")
+			{
+				bResult = ReadValues(state, tokens, i, 3, &material.diffuseColor.x);
+			}
+			else if (tokens[i] == "specular")
+			{
+				bResult = ReadValues(state, tokens, i, 3, &material.specularColor.x);
+			}
+			else if (tokens[i] == "shininess")
+			{
+				bResult = ReadValues(state, tokens, i, 1, &material.shininess);
+			}
+			else if (tokens[i] == "transparent")
+			{
+				material.flags |= SceneFile::MATERIAL_TRANSPARENT;
+			}
+			else
+			{
+				bResult = ReportError(state, "unknown material value '" + tokens[i] + "'");
+			}
+		}
+		if (bResult == false)
+		{
+			return(false);
+		}
+
+		material.tag = AddString(state, tokens[1]);
+		state.materialTags[tokens[1]] = (uint32_t)state.materials.size();
+		state.materials.push_back(material);
+
+		return(true);
+	}
+
+	/***********************************************************
+	 *  ReadLight()
+	 *
+	 *  This function reads a line of the form
+	 *    light [position x y z] [ambient r g b]
+	 *      [diffuse r g b] [specular r g b] [focal f]
+	 *      [intensity i] [range r]
+	 ***********************************************************/
+	bool ReadLight(COMPILE_STATE& state, const std::vector<std::string>& tokens)
+	{
+		SceneFile::SCENE_LIGHT light;
+		light.position = glm::vec3(0.0f, 0.0f, 0.0f);
+		light.focalStrength = 0.0f;
+		light.ambientColor = glm::vec3(0.0f, 0.0f, 0.0f);
+		light.specularIntensity = 0.0f;
+		light.diffuseColor = glm::vec3(0.0f, 0.0f, 0.0f);
+		light.range = 0.0f;
+		light.specularColor = glm::vec3(0.0f, 0.0f, 0.0f);
+
+		bool bResult = true;
+		for (size_t i = 1; (i < tokens.size()) && (bResult == true); i++)
+		{
+			if (tokens[i] == "position")
+			{
+				bResult = ReadValues(state, tokens, i, 3, &light.position.x);
+			}
+			else if (tokens[i] == "ambient")
+			{
+				bResult = ReadValues(state, tokens, i, 3, &light.ambientColor.x);
+			}
+			else if (tokens[i] == "diffuse")
+			{
+				bResult = ReadValues(state, tokens, i, 3, &light.diffuseColor.x);
+			}
+			else if (tokens[i] == "specular")
+			{
+				bResult = ReadValues(state, tokens, i, 3, &light.specularColor.x);
+			}
+			else if (tokens[i] == "focal")
+			{
+				bResult = ReadValues(state, tokens, i, 1, &light.focalStrength);
+			}
+			else if (tokens[i] == "intensity")
+			{
+				bResult = ReadValues(state, tokens, i, 1, &light.specularIntensity);
+			}
+			else if (tokens[i] == "range")
+			{
+				bResult = ReadValues(state, tokens, i, 1, &light.range);
+			}
+			else
+			{
+				bResult = ReportError(state, "unknown light value '" + tokens[i] + "'");
+			}
+		}
+		if (bResult == false)
+		{
+			return(false);
+		}
+
+		state.lights.push_back(light);
+
+		return(true);
+	}
+
+	/***********************************************************
+	 *  ReadObject()
+	 *
+	 *  This function reads a line of the form
+	 *    object <mesh> [scale x y z] [rotation x y z]
+	 *      [position x y z] [color r g b a] [uv u v]
+	 *      [texture <tag>] [material <tag>] [moving]
+	 *  where the tags must have been defined above it.
+	 ***********************************************************/
+	bool ReadObject(COMPILE_STATE& state, const std::vector<std::string>& tokens)
+	{
+		if (tokens.size() < 2)
+		{
+			return(ReportError(state, "expected: object <mesh> ..."));
+		}
+
+		SceneFile::SCENE_OBJECT object;
+		object.mesh = MESH_COUNT;
+		for (int mesh = 0; mesh < MESH_COUNT; mesh++)
+		{
+			if (tokens[1] == g_MeshNames[mesh])
+			{
+				object.mesh = (uint32_t)mesh;
+			}
+		}
+		if (object.mesh == MESH_COUNT)
+		{
+			return(ReportError(state, "unknown mesh '" + tokens[1] + "'"));
+		}
+
+		object.scale = glm::vec3(1.0f, 1.0f, 1.0f);
+		object.rotationDegrees = glm::vec3(0.0f, 0.0f, 0.0f);
+		object.position = glm::vec3(0.0f, 0.0f, 0.0f);
+		object.color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+		object.uvScale = glm::vec2(1.0f, 1.0f);
+		object.texture = SceneFile::NO_INDEX;
+		object.material = SceneFile::NO_INDEX;
+		object.flags = 0;
+
+		bool bResult = true;
+		for (size_t i = 2; (i < tokens.size()) && (bResult == true); i++)
+		{
+			if (tokens[i] == "scale")
+			{
+				bResult = ReadValues(state, tokens, i, 3, &object.scale.x);
+			}
+			else if (tokens[i] == "rotation")
+			{
+				bResult = ReadValues(state, tokens, i, 3, &object.rotationDegrees.x);
+			}
+			else if (tokens[i] == "position")
+			{
+				bResult = ReadValues(state, tokens, i, 3, &object.position.x);
+			}
+			else if (tokens[i] == "color")
+			{
+				bResult = ReadValues(state, tokens, i, 4, &object.color.x);
+			}
+			else if (tokens[i] == "uv")
+			{
+				bResult = ReadValues(state, tokens, i, 2, &object.uvScale.x);
+			}
+			else if ((tokens[i] == "texture") || (tokens[i] == "material"))
+			{
+				bool bTexture = (tokens[i] == "texture");
+				const std::map<std::string, uint32_t>& tags = (bTexture == true) ? state.textureTags : state.materialTags;
+				if (i + 1 >= tokens.size())
+				{
+					bResult = ReportError(state, "'" + tokens[i] + "' needs a tag");
+					break;
+				}
+				std::map<std::string, uint32_t>::const_iterator found = tags.find(tokens[++i]);
+				if (found == tags.end())
+				{
+					bResult = ReportError(state, "'" + tokens[i] + "' has not been defined");
+				}
+				else if (bTexture == true)
+				{
+					object.texture = found->second;
+				}
+				else
+				{
+					object.material = found->second;
+				}
+			}
+			else if (tokens[i] == "moving")
+			{
+				object.flags |= SceneFile::OBJECT_MOVING;
+			}
+			else
+			{
+				bResult = ReportError(state, "unknown object value '" + tokens[i] + "'");
+			}
+		}
+		if (bResult == false)
+		{
+			return(false);
+		}
+
+		state.objects.push_back(object);
+		if (state.openRack >= 0)
+		{
+			state.racks[state.openRack].objectCount++;
+		}
+
+		return(true);
+	}
+
+	/***********************************************************
+	 *  ReadRack()
+	 *
+	 *  This function reads the line starting a rack,
+	 *    rack offset x y z
+	 *  whose objects follow up to a line holding only
+	 *    end
+	 ***********************************************************/
+	bool ReadRack(COMPILE_STATE& state, const std::vector<std::string>& tokens)
+	{
+		if (state.openRack >= 0)
+		{
+			return(ReportError(state, "racks can't be nested"));
+		}
+		if ((tokens.size() != 5) || (tokens[1] != "offset"))
+		{
+			return(ReportError(state, "expected: rack offset <x> <y> <z>"));
+		}
+
+		SceneFile::SCENE_RACK rack;
+		rack.firstObject = (uint32_t)state.objects.size();
+		rack.objectCount = 0;
+		size_t index = 1;
+		if (ReadValues(state, tokens, index, 3, &rack.offset.x) == false)
+		{
+			return(false);
+		}
+
+		state.openRack = (int)state.racks.size();
+		state.racks.push_back(rack);
+
+		return(true);
+	}
+
+	/***********************************************************
+	 *  AppendRecords()
+	 *
+	 *  This function appends a record array to a compiled scene
+	 *  and sets where it starts and how many records it holds.
+	 ***********************************************************/
+	template <typename T>
+	void AppendRecords(
+		std::vector<unsigned char>& binary,
+		const std::vector<T>& records,
+		uint32_t& offset,
+		uint32_t& count)
+	{
+		offset = (uint32_t)binary.size();
+		count = (uint32_t)records.size();
+		if (records.empty() == false)
+		{
+			const unsigned char* pFirst = (const unsigned char*)&records[0];
+			binary.insert(binary.end(), pFirst, pFirst + records.size() * sizeof(T));
+		}
+	}
+
+	/***********************************************************
+	 *  IsArrayInside()
+	 *
+	 *  This function checks that a record array lies inside a
+	 *  compiled scene of the passed in size.
+	 ***********************************************************/
+	bool IsArrayInside(uint32_t offset, uint32_t count, size_t recordSize, size_t size)
+	{
+		return(((offset % sizeof(uint32_t)) == 0) &&
+			((uint64_t)offset + (uint64_t)count * recordSize <= (uint64_t)size));
+	}
+
+	/***********************************************************
+	 *  HasDuplicateTags()
+	 *
+	 *  This function checks whether two records of a compiled
+	 *  scene share a tag, which the text form never allows as
+	 *  the tags are what the records are looked up by.
+	 ***********************************************************/
+	template <typename T>
+	bool HasDuplicateTags(const T* pRecords, uint32_t count, const char* pStrings)
+	{
+		std::set<std::string> tags;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (tags.insert(pStrings + pRecords[i].tag).second == false)
+			{
+				return(true);
+			}
+		}
+
+		return(false);
+	}
+}
+
+/***********************************************************
+ *  SceneFile()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+SceneFile::SceneFile()
+{
+	m_pHeader = NULL;
+	m_pTextures = NULL;
+	m_pMaterials = NULL;
+	m_pLights = NULL;
+	m_pObjects = NULL;
+	m_pRacks = NULL;
+	m_pStrings = NULL;
+}
+
+/***********************************************************
+ *  Compile()
+ *
+ *  This method is used for reading the text form of a scene
+ *  and packing it into the binary form: the header, the
+ *  texture, material, light, object and rack arrays, and the
+ *  string table. Every record is made of four byte values,
+ *  so the arrays need no padding between them. The values
+ *  are stored in the byte order of the compiling machine.
+ *  Relative image files are moved from the directory of the
+ *  text form to the one of the file the binary form is read
+ *  from, so that they keep pointing at the same images.
+ ***********************************************************/
+bool SceneFile::Compile(
+	const std::string& textFilename,
+	const std::string& binaryFilename,
+	std::vector<unsigned char>& binary)
+{
+	binary.clear();
+
+	std::ifstream file(textFilename.c_str());
+	if (file.is_open() == false)
+	{
+		std::cout << "Could not open scene file: " << textFilename << std::endl;
+		return(false);
+	}
+
+	COMPILE_STATE state;
+	state.filename = textFilename;
+	state.line = 0;
+	state.openRack = -1;
+	if (GetRelativeDirectory(GetDirectory(binaryFilename), GetDirectory(textFilename), state.textureDirectory) == false)
+	{
+		std::cout << "The image files of " << textFilename << " can't be found from the directory of " << binaryFilename << std::endl;
+		return(false);
+	}
+
+	bool bResult = true;
+	std::string line;
+	std::vector<std::string> tokens;
+	while ((bResult == true) && std::getline(file, line))
+	{
+		state.line++;
+		if (SplitLine(line, tokens) == false)
+		{
+			bResult = ReportError(state, "missing closing quote");
+		}
+		else if (tokens.empty() == true)
+		{
+			continue;
+		}
+		else if (tokens[0] == "texture")
+		{
+			bResult = ReadTexture(state, tokens);
+		}
+		else if (tokens[0] == "material")
+		{
+			bResult = ReadMaterial(state, tokens);
+		}
+		else if (tokens[0] == "light")
+		{
+			bResult = ReadLight(state, tokens);
+		}
+		else if (tokens[0] == "object")
+		{
+			bResult = ReadObject(state, tokens);
+		}
+		else if (tokens[0] == "rack")
+		{
+			bResult = ReadRack(state, tokens);
+		}
+		else if ((tokens[0] == "end") && (tokens.size() == 1) && (state.openRack >= 0))
+		{
+			state.openRack = -1;
+		}
+		else
+		{
+			bResult = ReportError(state, "unexpected '" + tokens[0] + "'");
+		}
+	}
+	if ((bResult == true) && (state.openRack >= 0))
+	{
+		bResult = ReportError(state, "rack is missing its end");
+	}
+	if (bResult == false)
+	{
+		return(false);
+	}
+
+	// the string table is never empty, so that its last
+	// byte always ends a string
+	if (state.strings.empty() == true)
+	{
+		state.strings.push_back('\0');
+	}
+
+	SCENE_HEADER header;
+	memset(&header, 0, sizeof(header));
+	header.magic = BINARY_MAGIC;
+	header.version = BINARY_VERSION;
+
+	binary.resize(sizeof(SCENE_HEADER));
+	AppendRecords(binary, state.textures, header.textureOffset, header.textureCount);
+	AppendRecords(binary, state.materials, header.materialOffset, header.materialCount);
+	AppendRecords(binary, state.lights, header.lightOffset, header.lightCount);
+	AppendRecords(binary, state.objects, header.objectOffset, header.objectCount);
+	AppendRecords(binary, state.racks, header.rackOffset, header.rackCount);
+	header.stringOffset = (uint32_t)binary.size();
+	header.stringSize = (uint32_t)state.strings.size();
+	binary.insert(binary.end(), state.strings.begin(), state.strings.end());
+	memcpy(&binary[0], &header, sizeof(header));
+
+	return(true);
+}
+
+/***********************************************************
+ *  Build()
+ *
+ *  This method is used for compiling the text form of a
+ *  scene and writing the binary form into a file, which is
+ *  the build step that lets the scene be opened without
+ *  being parsed.
+ ***********************************************************/
+bool SceneFile::Build(const std::string& textFilename, const std::string& binaryFilename)
+{
+	std::vector<unsigned char> binary;
+	if (Compile(textFilename, binaryFilename, binary) == false)
+	{
+		return(false);
+	}
+
+	FILE* pFile = fopen(binaryFilename.c_str(), "wb");
+	if (pFile == NULL)
+	{
+		std::cout << "Could not create compiled scene: " << binaryFilename << std::endl;
+		return(false);
+	}
+	size_t written = fwrite(&binary[0], 1, binary.size(), pFile);
+	bool bClosed = (fclose(pFile) == 0);
+	if ((written != binary.size()) || (bClosed == false))
+	{
+		std::cout << "Could not write compiled scene: " << binaryFilename << std::endl;
+		remove(binaryFilename.c_str());
+		return(false);
+	}
+
+	return(true);
+}
+
+/***********************************************************
+ *  Open()
+ *
+ *  This method is used for opening a scene file. A compiled
+ *  scene is mapped into memory and its records are used
+ *  where they lie, while a scene still in the text form is
+ *  compiled into memory first.
+ ***********************************************************/
+bool SceneFile::Open(const std::string& filename)
+{
+	Close();
+
+	if (m_mappedFile.Open(filename) == false)
+	{
+		std::cout << "Could not open scene file: " << filename << std::endl;
+		return(false);
+	}
+	m_directory = GetDirectory(filename);
+
+	uint32_t magic = 0;
+	if (m_mappedFile.GetSize() >= sizeof(magic))
+	{
+		memcpy(&magic, m_mappedFile.GetData(), sizeof(magic));
+	}
+	if (magic == BINARY_MAGIC)
+	{
+		if (Attach(m_mappedFile.GetData(), m_mappedFile.GetSize(), filename) == false)
+		{
+			Close();
+			return(false);
+		}
+		return(true);
+	}
+
+	m_mappedFile.Close();
+	if ((Compile(filename, filename, m_compiled) == false) ||
+		(Attach(&m_compiled[0], m_compiled.size(), filename) == false))
+	{
+		Close();
+		return(false);
+	}
+
+	return(true);
+}
+
+/***********************************************************
+ *  Close()
+ *
+ *  This method is used for unmapping the compiled scene. The
+ *  record pointers are no longer valid afterwards.
+ ***********************************************************/
+void SceneFile::Close()
+{
+	m_mappedFile.Close();
+	m_compiled.clear();
+	m_directory.clear();
+	m_pHeader = NULL;
+	m_pTextures = NULL;
+	m_pMaterials = NULL;
+	m_pLights = NULL;
+	m_pObjects = NULL;
+	m_pRacks = NULL;
+	m_pStrings = NULL;
+}
+
+/***********************************************************
+ *  GetFilePath()
+ *
+ *  This method is used for getting a file name of the string
+ *  table. A relative file name is relative to the scene file,
+ *  so it is put after the directory the file was opened from.
+ ***********************************************************/
+std::string SceneFile::GetFilePath(uint32_t offset) const
+{
+	std::string path = GetString(offset);
+	if (IsAbsolutePath(path) == false)
+	{
+		path = m_directory + path;
+	}
+
+	return(path);
+}
+
+/***********************************************************
+ *  Attach()
+ *
+ *  This method is used for checking that the header and the
+ *  records of a compiled scene stay inside it, that the
+ *  indices they hold are in range and that no two textures
+ *  or materials share a tag, before pointing the record
+ *  arrays into it. Nothing is copied.
+ ***********************************************************/
+bool SceneFile::Attach(const unsigned char* pData, size_t size, const std::string& filename)
+{
+	if (size < sizeof(SCENE_HEADER))
+	{
+		std::cout << "Compiled scene is truncated: " << filename << std::endl;
+		return(false);
+	}
+
+	const SCENE_HEADER* pHeader = (const SCENE_HEADER*)pData;
+	if ((pHeader->magic != BINARY_MAGIC) || (pHeader->version != BINARY_VERSION))
+	{
+		std::cout << "Compiled scene has an unknown version, build it again: " << filename << std::endl;
+		return(false);
+	}
+
+	if ((IsArrayInside(pHeader->textureOffset, pHeader->textureCount, sizeof(SCENE_TEXTURE), size) == false) ||
+		(IsArrayInside(pHeader->materialOffset, pHeader->materialCount, sizeof(SCENE_MATERIAL), size) == false) ||
+		(IsArrayInside(pHeader->lightOffset, pHeader->lightCount, sizeof(SCENE_LIGHT), size) == false) ||
+		(IsArrayInside(pHeader->objectOffset, pHeader->objectCount, sizeof(SCENE_OBJECT), size) == false) ||
+		(IsArrayInside(pHeader->rackOffset, pHeader->rackCount, sizeof(SCENE_RACK), size) == false) ||
+		((uint64_t)pHeader->stringOffset + pHeader->stringSize > size) ||
+		(pHeader->stringSize == 0) ||
+		(pData[pHeader->stringOffset + pHeader->stringSize - 1] != '\0'))
+	{
+		std::cout << "Compiled scene is damaged: " << filename << std::endl;
+		return(false);
+	}
+
+	const SCENE_TEXTURE* pTextures = (const SCENE_TEXTURE*)(pData + pHeader->textureOffset);
+	const SCENE_MATERIAL* pMaterials = (const SCENE_MATERIAL*)(pData + pHeader->materialOffset);
+	const SCENE_OBJECT* pObjects = (const SCENE_OBJECT*)(pData + pHeader->objectOffset);
+	const SCENE_RACK* pRacks = (const SCENE_RACK*)(pData + pHeader->rackOffset);
+
+	bool bValid = true;
+	for (uint32_t i = 0; i < pHeader->textureCount; i++)
+	{
+		bValid = bValid && (pTextures[i].tag < pHeader->stringSize) && (pTextures[i].filename < pHeader->stringSize);
+	}
+	for (uint32_t i = 0; i < pHeader->materialCount; i++)
+	{
+		bValid = bValid && (pMaterials[i].tag < pHeader->stringSize);
+	}
+	for (uint32_t i = 0; i < pHeader->objectCount; i++)
+	{
+		bValid = bValid && (pObjects[i].mesh < MESH_COUNT) &&
+			((pObjects[i].texture == NO_INDEX) || (pObjects[i].texture < pHeader->textureCount)) &&
+			((pObjects[i].material == NO_INDEX) || (pObjects[i].material < pHeader->materialCount));
+	}
+	for (uint32_t i = 0; i < pHeader->rackCount; i++)
+	{
+		bValid = bValid && ((uint64_t)pRacks[i].firstObject + pRacks[i].objectCount <= pHeader->objectCount);
+	}
+	if (bValid == false)
+	{
+		std::cout << "Compiled scene is damaged: " << filename << std::endl;
+		return(false);
+	}
+
+	const char* pStrings = (const char*)(pData + pHeader->stringOffset);
+	if ((HasDuplicateTags(pTextures, pHeader->textureCount, pStrings) == true) ||
+		(HasDuplicateTags(pMaterials, pHeader->materialCount, pStrings) == true))
+	{
+		std::cout << "Compiled scene defines a tag twice: " << filename << std::endl;
+		return(false);
+	}
+
+	m_pHeader = pHeader;
+	m_pTextures = pTextures;
+	m_pMaterials = pMaterials;
+	m_pLights = (const SCENE_LIGHT*)(pData + pHeader->lightOffset);
+	m_pObjects = pObjects;
+	m_pRacks = pRacks;
+	m_pStrings = pStrings;
+
+	return(true);
+}
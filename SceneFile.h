@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+// scenefile.h
+// ============
+// read the text form of a scene file and compile it into a packed binary
+// that is used in place once it has been mapped into memory
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "MappedFile.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/***********************************************************
+ *  SceneFile
+ *
+ *  This class holds the textures, materials, lights and
+ *  objects of a scene as flat arrays of fixed size records.
+ *  The text form is meant for editing and is compiled with
+ *  Compile() into the binary form, which Open() maps into
+ *  memory and reads in place, so loading a compiled scene
+ *  needs neither parsing nor an allocation per object.
+ ***********************************************************/
+class SceneFile
+{
+public:
+	// constructor
+	SceneFile();
+
+	// first bytes of a compiled scene, and the version of its
+	// record layout
+	static const uint32_t BINARY_MAGIC = 0x314E4353;
+	static const uint32_t BINARY_VERSION = 1;
+	// texture or material index of an object without one
+	static const uint32_t NO_INDEX = 0xFFFFFFFF;
+	// flags of a material and of an object
+	static const uint32_t MATERIAL_TRANSPARENT = 0x1;
+	static const uint32_t OBJECT_MOVING = 0x1;
+
+	// fixed size header at the start of every compiled scene,
+	// giving the byte offset and count of every record array
+	struct SCENE_HEADER
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t textureOffset;
+		uint32_t textureCount;
+		uint32_t materialOffset;
+		uint32_t materialCount;
+		uint32_t lightOffset;
+		uint32_t lightCount;
+		uint32_t objectOffset;
+		uint32_t objectCount;
+		uint32_t rackOffset;
+		uint32_t rackCount;
+		// null terminated strings the records point into
+		uint32_t stringOffset;
+		uint32_t stringSize;
+	};
+
+	// image file of a texture and the tag it is found by, as
+	// offsets into the string table - a relative image file is
+	// relative to the directory of the scene file
+	struct SCENE_TEXTURE
+	{
+		uint32_t tag;
+		uint32_t filename;
+	};
+
+	struct SCENE_MATERIAL
+	{
+		glm::vec3 ambientColor;
+		float ambientStrength;
+		glm::vec3 diffuseColor;
+		float shininess;
+		glm::vec3 specularColor;
+		uint32_t tag;
+		uint32_t flags;
+	};
+
+	struct SCENE_LIGHT
+	{
+		glm::vec3 position;
+		float focalStrength;
+		glm::vec3 ambientColor;
+		float specularIntensity;
+		glm::vec3 diffuseColor;
+		// distance the light reaches, 0 for no falloff
+		float range;
+		glm::vec3 specularColor;
+	};
+
+	// one recorded object, with the index of its texture and
+	// of its material in the arrays of this file
+	struct SCENE_OBJECT
+	{
+		uint32_t mesh;
+		glm::vec3 scale;
+		glm::vec3 rotationDegrees;
+		glm::vec3 position;
+		glm::vec4 color;
+		glm::vec2 uvScale;
+		uint32_t texture;
+		uint32_t material;
+		uint32_t flags;
+	};
+
+	// range of objects that is copied once for every extra
+	// rack of the scene, each copy moved by the offset from
+	// the one before it
+	struct SCENE_RACK
+	{
+		uint32_t firstObject;
+		uint32_t objectCount;
+		glm::vec3 offset;
+	};
+
+	// compile the text form of a scene into the binary form
+	// that is read from the passed in file, which relative
+	// image files are rewritten to be relative to
+	static bool Compile(
+		const std::string& textFilename,
+		const std::string& binaryFilename,
+		std::vector<unsigned char>& binary);
+	// compile the text form of a scene and write the binary
+	// form into a file
+	static bool Build(const std::string& textFilename, const std::string& binaryFilename);
+
+	// open a compiled scene, or compile a scene file that is
+	// still in the text form
+	bool Open(const std::string& filename);
+	void Close();
+	bool IsOpen() const { return(m_pHeader != NULL); }
+
+	int GetTextureCount() const { return((int)m_pHeader->textureCount); }
+	const SCENE_TEXTURE* GetTextures() const { return(m_pTextures); }
+	int GetMaterialCount() const { return((int)m_pHeader->materialCount); }
+	const SCENE_MATERIAL* GetMaterials() const { return(m_pMaterials); }
+	int GetLightCount() const { return((int)m_pHeader->lightCount); }
+	const SCENE_LIGHT* GetLights() const { return(m_pLights); }
+	int GetObjectCount() const { return((int)m_pHeader->objectCount); }
+	const SCENE_OBJECT* GetObjects() const { return(m_pObjects); }
+	int GetRackCount() const { return((int)m_pHeader->rackCount); }
+	const SCENE_RACK* GetRacks() const { return(m_pRacks); }
+	// get a string of the string table from its offset
+	const char* GetString(uint32_t offset) const { return(m_pStrings + offset); }
+	// get a file name of the string table from its offset,
+	// with a relative one resolved against the directory the
+	// scene file was opened from
+	std::string GetFilePath(uint32_t offset) const;
+
+private:
+	// compiled scenes can't be copied
+	SceneFile(const SceneFile&);
+	SceneFile& operator=(const SceneFile&);
+
+	// mapped compiled scene, or the scene compiled from text
+	MappedFile m_mappedFile;
+	std::vector<unsigned char> m_compiled;
+	// directory of the opened scene file, ending in a separator
+	std::string m_directory;
+	// record arrays inside the compiled scene
+	const SCENE_HEADER* m_pHeader;
+	const SCENE_TEXTURE* m_pTextures;
+	const SCENE_MATERIAL* m_pMaterials;
+	const SCENE_LIGHT* m_pLights;
+	const SCENE_OBJECT* m_pObjects;
+	const SCENE_RACK* m_pRacks;
+	const char* m_pStrings;
+
+	// check the header of a compiled scene and point the record
+	// arrays into it
+	bool Attach(const unsigned char* pData, size_t size, const std::string& filename);
+};
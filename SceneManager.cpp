@@ -1,3771 +1,6483 @@
-///////////////////////////////////////////////////////////////////////////////
-// shadermanager.cpp
-// ============
-// manage the loading and rendering of 3D scenes
-//
-//  AUTHOR: Brian Battersby - SNHU Instructor / Computer Science
-//	Created for CS-330-Computational Graphics and Visualization, Nov. 1st, 2023
-///////////////////////////////////////////////////////////////////////////////
-
-#include "SceneManager.h"
-
-#ifndef STB_IMAGE_IMPLEMENTATION
-#define STB_IMAGE_IMPLEMENTATION
-#include "stb_image.h"
-#endif
-
-#include <glm/gtx/transform.hpp>
-
-// declaration of global variables
-namespace
-{
-	const char* g_ModelName = "model";
-	const char* g_ColorValueName = "objectColor";
-	const char* g_TextureValueName = "objectTexture";
-	const char* g_UseTextureName = "bUseTexture";
-	const char* g_UseLightingName = "bUseLighting";
-}
-
-/***********************************************************
- *  SceneManager()
- *
- *  The constructor for the class
- ***********************************************************/
-SceneManager::SceneManager(ShaderManager* pShaderManager)
-{
-	m_pShaderManager = pShaderManager;
-	m_basicMeshes = new ShapeMeshes();
-}
-
-/***********************************************************
- *  ~SceneManager()
- *
- *  The destructor for the class
- ***********************************************************/
-SceneManager::~SceneManager()
-{
-	m_pShaderManager = NULL;
-	delete m_basicMeshes;
-	m_basicMeshes = NULL;
-}
-
-/***********************************************************
- *  CreateGLTexture()
- *
- *  This method is used for loading textures from image files,
- *  configuring the texture mapping parameters in OpenGL,
- *  generating the mipmaps, and loading the read texture into
- *  the next available texture slot in memory.
- ***********************************************************/
-bool SceneManager::CreateGLTexture(const char* filename, std::string tag)
-{
-	int width = 0;
-	int height = 0;
-	int colorChannels = 0;
-	GLuint textureID = 0;
-
-	// indicate to always flip images vertically when loaded
-	stbi_set_flip_vertically_on_load(true);
-
-	// try to parse the image data from the specified image file
-	unsigned char* image = stbi_load(
-		filename,
-		&width,
-		&height,
-		&colorChannels,
-		0);
-
-	// if the image was successfully read from the image file
-	if (image)
-	{
-		std::cout << "Successfully loaded image:" << filename << ", width:" << width << ", height:" << height << ", channels:" << colorChannels << std::endl;
-
-		glGenTextures(1, &textureID);
-		glBindTexture(GL_TEXTURE_2D, textureID);
-
-		// set the texture wrapping parameters
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-		// set texture filtering parameters
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-		// if the loaded image is in RGB format
-		if (colorChannels == 3)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, image);
-		// if the loaded image is in RGBA format - it supports transparency
-		else if (colorChannels == 4)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image);
-		else
-		{
-			std::cout << "Not implemented to handle image with " << colorChannels << " channels" << std::endl;
-			return false;
-		}
-
-		// generate the texture mipmaps for mapping textures to lower resolutions
-		glGenerateMipmap(GL_TEXTURE_2D);
-
-		// free the image data from local memory
-		stbi_image_free(image);
-		glBindTexture(GL_TEXTURE_2D, 0); // Unbind the texture
-
-		// register the loaded texture and associate it with the special tag string
-		m_textureIDs[m_loadedTextures].ID = textureID;
-		m_textureIDs[m_loadedTextures].tag = tag;
-		m_loadedTextures++;
-
-		return true;
-	}
-
-	std::cout << "Could not load image:" << filename << std::endl;
-
-	// Error loading the image
-	return false;
-}
-
-/***********************************************************
- *  BindGLTextures()
- *
- *  This method is used for binding the loaded textures to
- *  OpenGL texture memory slots.  There are up to 16 slots.
- ***********************************************************/
-void SceneManager::BindGLTextures()
-{
-	for (int i = 0; i < m_loadedTextures; i++)
-	{
-		// bind textures on corresponding texture units
-		glActiveTexture(GL_TEXTURE0 + i);
-		glBindTexture(GL_TEXTURE_2D, m_textureIDs[i].ID);
-	}
-}
-
-/***********************************************************
- *  DestroyGLTextures()
- *
- *  This method is used for freeing the memory in all the
- *  used texture memory slots.
- ***********************************************************/
-void SceneManager::DestroyGLTextures()
-{
-	for (int i = 0; i < m_loadedTextures; i++)
-	{
-		glGenTextures(1, &m_textureIDs[i].ID);
-	}
-}
-
-/***********************************************************
- *  FindTextureID()
- *
- *  This method is used for getting an ID for the previously
- *  loaded texture bitmap associated with the passed in tag.
- ***********************************************************/
-int SceneManager::FindTextureID(std::string tag)
-{
-	int textureID = -1;
-	int index = 0;
-	bool bFound = false;
-
-	while ((index < m_loadedTextures) && (bFound == false))
-	{
-		if (m_textureIDs[index].tag.compare(tag) == 0)
-		{
-			textureID = m_textureIDs[index].ID;
-			bFound = true;
-		}
-		else
-			index++;
-	}
-
-	return(textureID);
-}
-
-/***********************************************************
- *  FindTextureSlot()
- *
- *  This method is used for getting a slot index for the previously
- *  loaded texture bitmap associated with the passed in tag.
- ***********************************************************/
-int SceneManager::FindTextureSlot(std::string tag)
-{
-	int textureSlot = -1;
-	int index = 0;
-	bool bFound = false;
-
-	while ((index < m_loadedTextures) && (bFound == false))
-	{
-		if (m_textureIDs[index].tag.compare(tag) == 0)
-		{
-			textureSlot = index;
-			bFound = true;
-		}
-		else
-			index++;
-	}
-
-	return(textureSlot);
-}
-
-/***********************************************************
- *  FindMaterial()
- *
- *  This method is used for getting a material from the previously
- *  defined materials list that is associated with the passed in tag.
- ***********************************************************/
-bool SceneManager::FindMaterial(std::string tag, OBJECT_MATERIAL& material)
-{
-	if (m_objectMaterials.size() == 0)
-	{
-		return(false);
-	}
-
-	int index = 0;
-	bool bFound = false;
-	while ((index < m_objectMaterials.size()) && (bFound == false))
-	{
-		if (m_objectMaterials[index].tag.compare(tag) == 0)
-		{
-			bFound = true;
-			material.ambientColor = m_objectMaterials[index].ambientColor;
-			material.ambientStrength = m_objectMaterials[index].ambientStrength;
-			material.diffuseColor = m_objectMaterials[index].diffuseColor;
-			material.specularColor = m_objectMaterials[index].specularColor;
-			material.shininess = m_objectMaterials[index].shininess;
-		}
-		else
-		{
-			index++;
-		}
-	}
-
-	return(true);
-}
-
-/***********************************************************
- *  SetTransformations()
- *
- *  This method is used for setting the transform buffer
- *  using the passed in transformation values.
- ***********************************************************/
-void SceneManager::SetTransformations(
-	glm::vec3 scaleXYZ,
-	float XrotationDegrees,
-	float YrotationDegrees,
-	float ZrotationDegrees,
-	glm::vec3 positionXYZ)
-{
-	// variables for this method
-	glm::mat4 modelView;
-	glm::mat4 scale;
-	glm::mat4 rotationX;
-	glm::mat4 rotationY;
-	glm::mat4 rotationZ;
-	glm::mat4 translation;
-
-	// set the scale value in the transform buffer
-	scale = glm::scale(scaleXYZ);
-	// set the rotation values in the transform buffer
-	rotationX = glm::rotate(glm::radians(XrotationDegrees), glm::vec3(1.0f, 0.0f, 0.0f));
-	rotationY = glm::rotate(glm::radians(YrotationDegrees), glm::vec3(0.0f, 1.0f, 0.0f));
-	rotationZ = glm::rotate(glm::radians(ZrotationDegrees), glm::vec3(0.0f, 0.0f, 1.0f));
-	// set the translation value in the transform buffer
-	translation = glm::translate(positionXYZ);
-
-	modelView = translation * rotationX * rotationY * rotationZ * scale;
-
-	if (NULL != m_pShaderManager)
-	{
-		m_pShaderManager->setMat4Value(g_ModelName, modelView);
-	}
-}
-
-/***********************************************************
- *  SetShaderColor()
- *
- *  This method is used for setting the passed in color
- *  into the shader for the next draw command
- ***********************************************************/
-void SceneManager::SetShaderColor(
-	float redColorValue,
-	float greenColorValue,
-	float blueColorValue,
-	float alphaValue)
-{
-	// variables for this method
-	glm::vec4 currentColor;
-
-	currentColor.r = redColorValue;
-	currentColor.g = greenColorValue;
-	currentColor.b = blueColorValue;
-	currentColor.a = alphaValue;
-
-	if (NULL != m_pShaderManager)
-	{
-		m_pShaderManager->setIntValue(g_UseTextureName, false);
-		m_pShaderManager->setVec4Value(g_ColorValueName, currentColor);
-	}
-}
-
-/***********************************************************
- *  SetShaderTexture()
- *
- *  This method is used for setting the texture data
- *  associated with the passed in ID into the shader.
- ***********************************************************/
-void SceneManager::SetShaderTexture(
-	std::string textureTag)
-{
-	if (NULL != m_pShaderManager)
-	{
-		m_pShaderManager->setIntValue(g_UseTextureName, true);
-
-		int textureID = -1;
-		textureID = FindTextureSlot(textureTag);
-		m_pShaderManager->setSampler2DValue(g_TextureValueName, textureID);
-	}
-}
-
-/***********************************************************
- *  SetTextureUVScale()
- *
- *  This method is used for setting the texture UV scale
- *  values into the shader.
- ***********************************************************/
-void SceneManager::SetTextureUVScale(float u, float v)
-{
-	if (NULL != m_pShaderManager)
-	{
-		m_pShaderManager->setVec2Value("UVscale", glm::vec2(u, v));
-	}
-}
-
-/***********************************************************
- *  SetShaderMaterial()
- *
- *  This method is used for passing the material values
- *  into the shader.
- ***********************************************************/
-void SceneManager::SetShaderMaterial(
-	std::string materialTag)
-{
-	if (m_objectMaterials.size() > 0)
-	{
-		OBJECT_MATERIAL material;
-		bool bReturn = false;
-
-		bReturn = FindMaterial(materialTag, material);
-		if (bReturn == true)
-		{
-			m_pShaderManager->setVec3Value("material.ambientColor", material.ambientColor);
-			m_pShaderManager->setFloatValue("material.ambientStrength", material.ambientStrength);
-			m_pShaderManager->setVec3Value("material.diffuseColor", material.diffuseColor);
-			m_pShaderManager->setVec3Value("material.specularColor", material.specularColor);
-			m_pShaderManager->setFloatValue("material.shininess", material.shininess);
-		}
-	}
-}
-
-/**************************************************************/
-/*** STUDENTS CAN MODIFY the code in the methods BELOW for  ***/
-/*** preparing and rendering their own 3D replicated scenes.***/
-/*** Please refer to the code in the OpenGL sample project  ***/
-/*** for assistance.                                        ***/
-/**************************************************************/
-
-void SceneManager::LoadSceneTextures()
-{
-	/*** STUDENTS - add the code BELOW for loading the textures that ***/
-	/*** will be used for mapping to objects in the 3D scene. Up to  ***/
-	/*** 16 textures can be loaded per scene. Refer to the code in   ***/
-	/*** the OpenGL Sample for help.                                 ***/
-	bool bReturn = false;
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/d6z6f7n-d0432750-413e-43dd-9c71-94851bd5de38.jpg", "floor");
-
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/dark_brown_leather_texture__tileable___2048x2048__by_fabooguy_d7aect6-pre.jpg", "kickstand"
-	);
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/Beveled_top_edge_red_textured_cast_finish_dusty_grubby_rough_flecked_metal_sheet_surface_texture.jpg", "kickbag"
-	);
-
-	//Create dumbell_steel texture
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/dumbell_steel_texture.jpg", "dumbell_steel"
-	);
-	//Create dumbell_orange texture
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/orange_dumbell_texture.jpg", "dumbell_orange"
-	);
-
-	//Create dumbell_pink texture
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/pink_dumbell_texture.jpg", "dumbell_pink"
-	);
-
-	//Create dumbell_grey texture
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/grey_dumbell_texture.jpg", "dumbell_grey"
-	);
-
-
-	//Create wall texture
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/texture2.jpg", "wall"
-	);
-
-	//Create window texture
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/glass_window_texture.jpg", "window"
-	);
-
-	//Create window wall texture
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/window_wall_texture.jpg", "window_wall"
-	);
-
-	//Create tv texture
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/TV_Texture.jpg", "tv"
-	);
-
-	//Create dumbell_steel_white texture
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/dumbell_steel_white_texture.jpg", "dumbell_steel_white"
-	);
-
-	//Create doors texture
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/door_texture.jpg", "door"
-	);
-
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/double_door_texture.jpg", "double_doors"
-	);
-	//Create weight_mats texture
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/texture1.jpg", "weight_mats"
-	);
-	//Create wall_mat texture
-	bReturn = CreateGLTexture(
-		"C:/Users/coope/Downloads/wall_mat_texture.jpg", "wall_mat"
-	);
-
-	// after the texture image data is loaded into memory, the
-	// loaded textures need to be bound to texture slots - there
-	// are a total of 16 available slots for scene textures
-	BindGLTextures();
-}
-
-
-/*********************************************
-* DefineObjectMaterials()
-*
-This method is used to define the objects material
-for lighting, and how said objects texture would reflect
-or look when lit
-**********************************************/
-void SceneManager::DefineObjectMaterials()
-{
-	OBJECT_MATERIAL redKickMaterial;
-	redKickMaterial.ambientColor = glm::vec3(0.2f, 0.2f, 0.1f); //Low ambient color
-	redKickMaterial.ambientStrength = 0.4f; //low ambient strength
-	redKickMaterial.diffuseColor = glm::vec3(0.3f, 0.3f, 0.2f); //Low diffuse color
-	redKickMaterial.specularColor = glm::vec3(0.6f, 0.5f, 0.4f); //High specular color
-	redKickMaterial.shininess = 22.0; //Lower shininess
-	redKickMaterial.tag = "redKick";
-	m_objectMaterials.push_back(redKickMaterial);
-
-	OBJECT_MATERIAL KickStandMaterial;
-	KickStandMaterial.ambientColor = glm::vec3(0.2f, 0.2f, 0.1f); //Low ambient color
-	KickStandMaterial.ambientStrength = 0.4f; //low ambient strength
-	KickStandMaterial.diffuseColor = glm::vec3(0.3f, 0.3f, 0.2f); //Low diffuse color
-	KickStandMaterial.specularColor = glm::vec3(0.6f, 0.5f, 0.4f); //High specular color
-	KickStandMaterial.shininess = 22.0; //Lower shininess
-	KickStandMaterial.tag = "KickStand";
-	m_objectMaterials.push_back(KickStandMaterial);
-
-	OBJECT_MATERIAL MetalDumbbellMaterial;
-	MetalDumbbellMaterial.ambientColor = glm::vec3(0.1f, 0.1f, 0.1f); // Low ambient color
-	MetalDumbbellMaterial.ambientStrength = 0.2f; // Low ambient strength
-	MetalDumbbellMaterial.diffuseColor = glm::vec3(0.1f, 0.1f, 0.1f); // Low diffuse color
-	MetalDumbbellMaterial.specularColor = glm::vec3(0.5f, 0.5f, 0.5f); // High specular color
-	MetalDumbbellMaterial.shininess = 32.0; // Moderate shininess
-	MetalDumbbellMaterial.tag = "darkMetallicDumbbell";
-	m_objectMaterials.push_back(MetalDumbbellMaterial);
-
-	OBJECT_MATERIAL TVScreenMaterial;
-	TVScreenMaterial.ambientColor = glm::vec3(0.0f, 0.0f, 0.0f); // No ambient light contribution
-	TVScreenMaterial.ambientStrength = 0.0f; // Ambient strength set to 0
-	TVScreenMaterial.diffuseColor = glm::vec3(0.0f, 0.0f, 0.0f); // No diffuse reflection
-	TVScreenMaterial.specularColor = glm::vec3(0.0f, 0.0f, 0.0f); // No specular highlights
-	TVScreenMaterial.shininess = 0.0; // No shininess
-	TVScreenMaterial.tag = "blackTVScreen";
-	m_objectMaterials.push_back(TVScreenMaterial);
-
-	OBJECT_MATERIAL MirrorMaterial;
-	MirrorMaterial.ambientColor = glm::vec3(0.0f, 0.0f, 0.0f); // No ambient light contribution
-	MirrorMaterial.ambientStrength = 0.0f; // Ambient strength set to 0
-	MirrorMaterial.diffuseColor = glm::vec3(0.0f, 0.0f, 0.0f); // No diffuse reflection
-	MirrorMaterial.specularColor = glm::vec3(1.0f, 1.0f, 1.0f); // Full white specular reflection
-	MirrorMaterial.shininess = 100.0; // High shininess for sharp reflections
-	MirrorMaterial.tag = "glassMirror";
-	m_objectMaterials.push_back(MirrorMaterial);
-
-	OBJECT_MATERIAL WhiteWallMaterial;
-	WhiteWallMaterial.ambientColor = glm::vec3(0.8f, 0.8f, 0.8f); // Ambient color for soft ambient light
-	WhiteWallMaterial.ambientStrength = 0.2f; // Low ambient strength for subtle ambient light
-	WhiteWallMaterial.diffuseColor = glm::vec3(0.8f, 0.8f, 0.8f); // Diffuse color for light reflection
-	WhiteWallMaterial.specularColor = glm::vec3(0.0f, 0.0f, 0.0f); // No specular highlights
-	WhiteWallMaterial.shininess = 0.0; // No shininess
-	WhiteWallMaterial.tag = "whiteWall";
-	m_objectMaterials.push_back(WhiteWallMaterial);
-
-	OBJECT_MATERIAL WhiteHardwoodMaterial;
-	WhiteHardwoodMaterial.ambientColor = glm::vec3(0.4f, 0.4f, 0.4f); // Ambient color for soft ambient light
-	WhiteHardwoodMaterial.ambientStrength = 0.3f; // Low ambient strength for subtle ambient light
-	WhiteHardwoodMaterial.diffuseColor = glm::vec3(0.8f, 0.8f, 0.8f); // Diffuse color for light reflection
-	WhiteHardwoodMaterial.specularColor = glm::vec3(0.3f, 0.3f, 0.3f); // Specular color for sheen effect
-	WhiteHardwoodMaterial.shininess = 25.0; // Medium shininess for a slight reflective sheen
-	WhiteHardwoodMaterial.tag = "whiteHardwoodFloor";
-	m_objectMaterials.push_back(WhiteHardwoodMaterial);
-
-	OBJECT_MATERIAL RubberDumbbellMaterial;
-	RubberDumbbellMaterial.ambientColor = glm::vec3(0.1f, 0.1f, 0.1f); // Ambient color for soft ambient light
-	RubberDumbbellMaterial.ambientStrength = 0.2f; // Low ambient strength for subtle ambient light
-	RubberDumbbellMaterial.diffuseColor = glm::vec3(0.2f, 0.2f, 0.2f); // Diffuse color for light reflection
-	RubberDumbbellMaterial.specularColor = glm::vec3(0.0f, 0.0f, 0.0f); // No specular highlights
-	RubberDumbbellMaterial.shininess = 0.0; // No shininess
-	RubberDumbbellMaterial.tag = "rubberDumbbell";
-	m_objectMaterials.push_back(RubberDumbbellMaterial);
-
-	OBJECT_MATERIAL FloorMatMaterial;
-	FloorMatMaterial.ambientColor = glm::vec3(0.1f, 0.1f, 0.1f); // Ambient color for soft ambient light
-	FloorMatMaterial.ambientStrength = 0.2f; // Low ambient strength for subtle ambient light
-	FloorMatMaterial.diffuseColor = glm::vec3(0.3f, 0.3f, 0.3f); // Diffuse color for light reflection
-	FloorMatMaterial.specularColor = glm::vec3(0.0f, 0.0f, 0.0f); // No specular highlights
-	FloorMatMaterial.shininess = 0.0; // No shininess
-	FloorMatMaterial.tag = "floorMat";
-	m_objectMaterials.push_back(FloorMatMaterial);
-
-	OBJECT_MATERIAL WhiteDoorMaterial;
-	WhiteDoorMaterial.ambientColor = glm::vec3(0.2f, 0.2f, 0.2f); // Ambient color for soft ambient light
-	WhiteDoorMaterial.ambientStrength = 0.3f; // Low ambient strength for subtle ambient light
-	WhiteDoorMaterial.diffuseColor = glm::vec3(0.8f, 0.8f, 0.8f); // Diffuse color for light reflection
-	WhiteDoorMaterial.specularColor = glm::vec3(0.2f, 0.2f, 0.2f); // Specular color for slight sheen effect
-	WhiteDoorMaterial.shininess = 10.0; // Medium shininess for being slight reflective
-	WhiteDoorMaterial.tag = "whiteDoor";
-	m_objectMaterials.push_back(WhiteDoorMaterial);
-
-	OBJECT_MATERIAL WindowMaterial;
-	WindowMaterial.ambientColor = glm::vec3(0.2f, 0.2f, 0.2f); // Ambient color for soft ambient light
-	WindowMaterial.ambientStrength = 0.1f; // Low ambient strength for subtle ambient light
-	WindowMaterial.diffuseColor = glm::vec3(0.8f, 0.8f, 0.8f); // Diffuse color for light reflection
-	WindowMaterial.specularColor = glm::vec3(0.0f, 0.0f, 0.0f); // No specular highlights
-	WindowMaterial.shininess = 0.0; // No shininess
-	WindowMaterial.tag = "Window";
-	m_objectMaterials.push_back(WindowMaterial);
-}
-
-
-/*********************************************
-* SetupSceneLights()
-* 
-This method is used to setup the lights
-in the scene
-**********************************************/
-
-void SceneManager::SetupSceneLights()
-{
-
-
-	// Light 1
-	m_pShaderManager->setVec3Value("lightSources[0].position", -14.0f, 14.0f, 0.0f);
-	m_pShaderManager->setVec3Value("lightSources[0].ambientColor", 0.5f, 0.7f, 0.7f); 
-	m_pShaderManager->setVec3Value("lightSources[0].diffuseColor", 0.5f, 0.7f, 0.7f); 
-	m_pShaderManager->setVec3Value("lightSources[0].specularColor", 0.5f, 0.7f, 0.7f); 
-	m_pShaderManager->setFloatValue("lightSources[0].focalStrength", 18.0f);
-	m_pShaderManager->setFloatValue("lightSources[0].specularIntensity", 0.05f);
-
-	// Light 2
-	m_pShaderManager->setVec3Value("lightSources[1].position", 14.0f, 5.0f, 14.0f);
-	m_pShaderManager->setVec3Value("lightSources[1].ambientColor", 0.2f, 0.2f, 0.2f);
-	m_pShaderManager->setVec3Value("lightSources[1].diffuseColor", 0.2f, 0.2f, 0.2f);
-	m_pShaderManager->setVec3Value("lightSources[1].specularColor", 0.2f, 0.2f, 0.2f);
-	m_pShaderManager->setFloatValue("lightSources[1].focalStrength", 18.0f);
-	m_pShaderManager->setFloatValue("lightSources[1].specularIntensity", 0.05f);
-
-
-	// Adjusting for cool white lighting
-	const float coolWhiteIntensity = 0.8f; // Intensity for cool white lighting
-
-	// Adjusting light color temperature towards cooler end of the spectrum (blue-white)
-	const float coolWhiteR = 0.7f; // Red component
-	const float coolWhiteG = 0.75f; // Green component
-	const float coolWhiteB = 0.85f; // Blue component
-
-	// Applying cool white lighting to both light sources
-	m_pShaderManager->setVec3Value("lightSources[0].ambientColor", coolWhiteR, coolWhiteG, coolWhiteB);
-	m_pShaderManager->setVec3Value("lightSources[0].diffuseColor", coolWhiteR, coolWhiteG, coolWhiteB);
-	m_pShaderManager->setVec3Value("lightSources[0].specularColor", coolWhiteR, coolWhiteG, coolWhiteB);
-	m_pShaderManager->setFloatValue("lightSources[0].specularIntensity", coolWhiteIntensity);
-
-	m_pShaderManager->setVec3Value("lightSources[1].ambientColor", coolWhiteR, coolWhiteG, coolWhiteB);
-	m_pShaderManager->setVec3Value("lightSources[1].diffuseColor", coolWhiteR, coolWhiteG, coolWhiteB);
-	m_pShaderManager->setVec3Value("lightSources[1].specularColor", coolWhiteR, coolWhiteG, coolWhiteB);
-	m_pShaderManager->setFloatValue("lightSources[1].specularIntensity", coolWhiteIntensity);
-
-
-	m_pShaderManager->setBoolValue("bUseLighting", true);
-}
-/***********************************************************
- *  PrepareScene()
- *
- *  This method is used for preparing the 3D scene by loading
- *  the shapes, textures in memory to support the 3D scene
- *  rendering
- ***********************************************************/
-void SceneManager::PrepareScene()
-{
-	// load the textures for the 3D scene
-	LoadSceneTextures();
-	DefineObjectMaterials();
-	SetupSceneLights();
-	// only one instance of a particular mesh needs to be
-	// loaded in memory no matter how many times it is drawn
-	// in the rendered 3D scene
-
-	m_basicMeshes->LoadPlaneMesh();
-	m_basicMeshes->LoadTaperedCylinderMesh();
-	m_basicMeshes->LoadCylinderMesh();
-	m_basicMeshes->LoadConeMesh();
-	m_basicMeshes->LoadBoxMesh();
-	m_basicMeshes->LoadTorusMesh();
-	m_basicMeshes->LoadSphereMesh();
-}
-
-/***********************************************************
- *  RenderScene()
- *
- *  This method is used for rendering the 3D scene by
- *  transforming and drawing the basic 3D shapes
- ***********************************************************/
-void SceneManager::RenderScene()
-{
-	// declare the variables for the transformations
-	glm::vec3 scaleXYZ;
-	float XrotationDegrees = 0.0f;
-	float YrotationDegrees = 0.0f;
-	float ZrotationDegrees = 0.0f;
-	glm::vec3 positionXYZ;
-	SetTextureUVScale(2.0f, 2.0f);
-
-	/*** Set needed transformations before drawing the basic mesh.  ***/
-	/*** This same ordering of code should be used for transforming ***/
-	/*** and drawing all the basic 3D shapes.						***/
-	/******************************************************************/
-
-	//Floors, walls, and ceilings
-
-	//Ceiling
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(14.0f, 1.0f, 10.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(0.0f, 15.0f, 0.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0, 1, 1, 1);
-	SetShaderTexture("wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-	//Tilted Ceiling
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(14.0f, 1.0f, 6.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = -60.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(0.0f, 15.0f, -6.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0, 1, 0.5, 1);
-	SetShaderTexture("wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-	//Floor
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(14.0f, 1.0f, 10.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(0.0f, 0.0f, 0.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 1, 1, 1);
-	SetShaderTexture("floor");
-	SetShaderMaterial("whiteHardwoodFloor");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-
-	//Wall #1
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(8.0f, 0.0f, 14.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(0.0f, 7.5f, -10.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 1, 1, 1);
-	SetShaderTexture("wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-
-	//Wall #2
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(8.0f, 0.0f, 8.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-13.0f, 7.5f, -4.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 1, 1, 1);
-	SetShaderTexture("wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-
-//This is the little space between the 2 doors and wall
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(1.0f, 0.0f, 8.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-14.0f, 7.5f, 4.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 1, 1, 1);
-	SetShaderTexture("wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-	//Wall #3
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(8.0f, 0.0f, 8.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(13.0f, 7.5f, -4.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 1, 1, 1);
-	SetShaderTexture("wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-	//Slanted part of right wall
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(8.0f, 0.0f, 8.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = -50.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(13.0f, 7.5f, -1.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 1, 1, 1);
-	SetShaderTexture("wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-
-	//Wall #4
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(2.6f, 0.0f, 8.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(7.86f, 7.5f, 7.4f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 1, 1, 1);
-	SetShaderTexture("wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-
-	/********************************************
-	*****************Window**********************
-	*********************************************
-	*********************************************/
-
-	//Window Pane
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(4.0f, 0.0f, 4.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.99f, 7.5f, -2.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 0, 1, 1);
-	SetShaderTexture("window");
-	SetShaderMaterial("Window");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-
-
-	//Window Frame Bottom
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.2f, 0.2f, 8.2f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.8f, 3.5f, -2.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 0, 1, 1);
-	SetShaderTexture("window_wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	//Window Frame Top
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.2f, 0.2f, 8.2f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.8f, 11.5f, -2.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 0, 1, 1);
-	SetShaderTexture("window_wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	//Window Frame Middle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.2f, 0.2f, 8.2f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.8f, 7.5f, -2.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 0, 1, 1);
-	SetShaderTexture("window_wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	//Window Frame Left
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.2f, 0.2f, 8.2f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.8f, 7.5f, 2.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 0, 1, 1);
-	SetShaderTexture("window_wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	//Window Frame Right
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.2f, 0.2f, 8.2f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.8f, 7.5f, -6.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 0, 1, 1);
-	SetShaderTexture("window_wall");
-	SetShaderMaterial("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	/*******************************************
-	********************************************
-	********************************************/
-
-	//Closet Doors
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(6.0f, 0.0f, 6.5f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-14.0f, 6.5f, 4.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 1, 0, 1);
-	SetShaderTexture("double_doors");
-	SetShaderMaterial("whiteDoor");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-	//Small bit of wall above closet doors
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(6.0f, 0.0f, 2.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-14.0f, 14.8f, 4.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 1, 1, 1);
-	SetShaderTexture("wall");
-	SetShaderTexture("whiteWall");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-
-	//weight mats #1
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(1.2f, 1.0f, 2.8f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.7f, 0.1f, 7.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 0.4, 1, 1);
-	SetShaderTexture("weight_mats");
-	SetShaderMaterial("floorMat");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-
-
-	//weight mats #2
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(2.2f, 1.0f, 4.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.0f, 0.1f, -0.4f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 0.4, 1, 1);
-	SetShaderTexture("weight_mats");
-	SetShaderMaterial("floorMat");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-
-
-	//weight mats #3
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(2.2f, 1.0f, 10.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(2.0f, 0.1f, -7.6f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 0.4, 1, 1);
-	SetShaderTexture("weight_mats");
-	SetShaderMaterial("floorMat");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-	/****************************************************************/
-	/*** Set needed transformations before drawing the basic mesh.  ***/
-	/*** This same ordering of code should be used for transforming ***/
-	/*** and drawing all the basic 3D shapes.						***/
-	/******************************************************************/
-
-
-	/*******************************************************************/
-	/*This is for the kickboxing stand*/
-	/*******************************************************************/
-	//Base
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(2.0f, 2.0f, 1.5f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.0f, 0.0f, -7.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	//SetShaderColor(1, 0, 1, 1);
-	SetShaderTexture("kickstand");
-	SetShaderMaterial("KickStand");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawTaperedCylinderMesh();
-
-	
-	
-	//Cone
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.8f, 2.0f, 0.5f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.0f, 1.6f, -7.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(1, 0, 0, 1);
-	SetShaderTexture("kickstand");
-	SetShaderMaterial("KickStand");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawConeMesh();
-
-	
-	
-	//Cyllander for kickbox stand
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(1.0f, 5.0f, 1.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.0f, 2.6f, -7.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	//SetShaderColor(0, 1, 0, 1);
-	SetShaderTexture("kickbag");
-	SetShaderMaterial("redKick");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	/**********************************************
-	***********************************************
-	* This part is for one off things like the TV
-	* And mirrors
-	***********************************************/
-
-	//Mirror #1
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(7.0f, 1.0f, 4.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-1.0f, 5.0f, -9.8f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0, 1, 1, 1);
-	SetShaderTexture("window");
-	SetShaderMaterial("glassMirror");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-	//Mirror #2
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(3.2f, 1.0f, 4.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(12.9f, 5.0f, -4.6f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0, 1, 1, 1);
-	SetShaderTexture("window");
-	SetShaderMaterial("glassMirror");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawPlaneMesh();
-
-
-	//TV
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(5.0f, 3.3f, 0.2f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 10.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-10.6f, 8.5f, -8.5f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("tv");
-	SetShaderMaterial("blackTVScreen");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	//Wall Mat
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(2.5f, 10.0f, 0.2f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(7.8f, 6.0f, 7.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("wall_mat");
-	SetShaderMaterial("floorMat");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	/*************************************
-	* ************Corner Weights**********
-	* ************************************
-	* ************************************
-	* */
-	//Biggest Weight
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(1.0f, 1.0f, 1.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(11.0f, 0.2f, -6.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.7, 0.7, 0.7, 1);
-	SetShaderTexture("dumbell_steel_white");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawTorusMesh();
-
-
-	//Middle Weight
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.8f, 0.8f, 1.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(11.0f, 0.4f, -6.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.5, 0.5, 0.5, 1);
-	SetShaderTexture("dumbell_steel_white");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawTorusMesh();
-
-
-	//Smallest Weight
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.6f, 0.6f, 1.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(11.0f, 0.6f, -6.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.3, 0.3, 0.3, 1);
-	SetShaderTexture("dumbell_steel_white");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawTorusMesh();
-
-
-	//Middle part of Smallest Weight
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.3f, 1.0f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(11.0f, 0.6f, -6.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.3, 0.3, 0.3, 1);
-	SetShaderTexture("dumbell_steel_white");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawTorusMesh();
-
-
-
-	/*************************************
-	***************Kettlebells************************
-	**************************************
-	**************************************/
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.4f, 0.5f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.0f, 1.0f, -0.7f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawTorusMesh();
-
-
-	//Weight
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.5f, 0.5f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.0f, 0.4f, -0.7f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("kettlebell_blue");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawSphereMesh();
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.4f, 0.5f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.0f, 1.0f, -2.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawTorusMesh();
-
-
-	//Weight
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.5f, 0.5f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.0f, 0.4f, -2.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("kettlebell_blue");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawSphereMesh();
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.4f, 0.5f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.0f, 1.0f, -3.3f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawTorusMesh();
-
-
-	//Weight
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.5f, 0.5f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.0f, 0.4f, -3.3f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("kettlebell_blue");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawSphereMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.4f, 0.5f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.0f, 1.0f, -4.5f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawTorusMesh();
-
-
-	//Weight
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.5f, 0.5f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.0f, 0.4f, -4.5f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("kettlebell_blue");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawSphereMesh();
-
-	/*************************************
-	***************Dumbells************************
-	**************************************
-	**************************************/
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.3f, 0.4f, 7.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.3f, 0.4f, 7.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-13.3f, 0.4f, 7.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.3f, 0.4f, 7.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-13.3f, 0.4f, 7.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-	
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.3f, 0.4f, 9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.3f, 0.4f, 9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-13.3f, 0.4f, 9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.3f, 0.4f, 8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.3f, 0.4f, 8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-13.3f, 0.4f, 8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.3f, 0.4f, 6.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.3f, 0.4f, 6.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-13.3f, 0.4f, 6.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.3f, 0.4f, 3.8f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_orange");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.3f, 0.4f, 3.8f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_orange");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.2f, 0.4f, 3.8f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_orange");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.3f, 0.4f, 3.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_orange");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.3f, 0.4f, 3.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_orange");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.2f, 0.4f, 3.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_orange");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.3f, 0.4f, 2.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_pink");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.3f, 0.4f, 2.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_pink");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.2f, 0.4f, 2.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_pink");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 90.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.3f, 0.4f, 1.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_grey");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-11.3f, 0.4f, 1.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_grey");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 0.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-12.2f, 0.4f, 1.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_grey");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-6.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-6.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-6.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-5.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-5.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-5.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-4.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-4.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-4.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-3.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-3.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-3.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-2.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-2.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-2.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-1.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-1.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-1.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-0.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-0.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(-0.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(1.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(1.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(1.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(2.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(2.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(2.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(3.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(3.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(3.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(4.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(4.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(4.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(5.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(5.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(5.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(6.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(6.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(6.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_steel");
-	SetShaderMaterial("darkMetallicDumbbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(7.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_orange");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(7.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_orange");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(7.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_orange");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-
-	//Handle
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 90.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(8.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_orange");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawCylinderMesh();
-
-	//Weights
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(8.3f, 0.4f, -9.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_orange");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-
-
-	// set the XYZ scale for the mesh
-	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
-
-	// set the XYZ rotation for the mesh
-	XrotationDegrees = 0.0f;
-	YrotationDegrees = 90.0f;
-	ZrotationDegrees = 0.0f;
-
-	// set the XYZ position for the mesh
-	positionXYZ = glm::vec3(8.3f, 0.4f, -8.0f);
-
-	// set the transformations into memory to be used on the drawn meshes
-	SetTransformations(
-		scaleXYZ,
-		XrotationDegrees,
-		YrotationDegrees,
-		ZrotationDegrees,
-		positionXYZ);
-
-	SetShaderColor(0.2, 0.2, 0.2, 1);
-	SetShaderTexture("dumbell_orange");
-	SetShaderMaterial("rubberDumbell");
-
-	// draw the mesh with transformation values
-	m_basicMeshes->DrawBoxMesh();
-}
+///////////////////////////////////////////////////////////////////////////////
+// shadermanager.cpp
+// ============
+// manage the loading and rendering of 3D scenes
+//
+//  AUTHOR: Brian Battersby - SNHU Instructor / Computer Science
+//	Created for CS-330-Computational Graphics and Visualization, Nov. 1st, 2023
+///////////////////////////////////////////////////////////////////////////////
+
+#include "SceneManager.h"
+
+#include <glm/gtx/transform.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <set>
+#include <thread>
+
+// declaration of global variables
+namespace
+{
+	const char* g_ModelName = "model";
+	const char* g_ColorValueName = "objectColor";
+	const char* g_TextureValueName = "objectTexture";
+	const char* g_TextureLayerName = "textureLayer";
+	const char* g_UseTextureName = "bUseTexture";
+	const char* g_UseLightingName = "bUseLighting";
+	const char* g_UseInstancingName = "bUseInstancing";
+	const char* g_DepthOnlyName = "bDepthOnly";
+	const char* g_ViewName = "view";
+	const char* g_ProjectionName = "projection";
+	const char* g_ViewPositionName = "viewPosition";
+
+	// size of a shadow cube map face - 24 MB per light for the
+	// static maps and as much again for the per frame maps -
+	// and the texture unit the maps are sampled from, between
+	// the texture arrays and the depth pyramid
+	const int g_ShadowMapResolution = 1024;
+	const GLint g_ShadowTextureUnit = 30;
+
+	// pixel heights where the items switch to the next coarser
+	// tessellation level
+	const float g_LodPixelThresholds[PrimitiveGeometry::LOD_COUNT - 1] = { 160.0f, 48.0f };
+	// part of a threshold an item has to pass it by before it
+	// switches level, so items near it do not flicker
+	const float g_LodHysteresis = 0.2f;
+
+	// fewest items a chunk of a parallel stage works on
+	const int g_JobGrainSize = 256;
+
+	// compute shaders of the GPU cull pass
+	const char* g_CullShaderName = "shaders/cullComputeShader.glsl";
+	const char* g_DepthPyramidShaderName = "shaders/depthPyramidShader.glsl";
+	// compute shader assigning the lights to the clusters
+	const char* g_LightClusterShaderName = "shaders/lightClusterShader.glsl";
+	const char* g_MaterialIndexName = "materialIndex";
+
+	// uniform block binding points and array sizes - these
+	// must match the uniform blocks in fragmentShader.glsl
+	const GLuint g_LightBlockBinding = 0;
+	const GLuint g_MaterialBlockBinding = 1;
+	const int g_MaxLightSources = 64;
+	// light sources the clustered lighting can hold, which are
+	// only limited by the light buffer
+	const int g_MaxClusteredLights = 4096;
+	const int g_MaxObjectMaterials = 256;
+
+	// bits of the view depth dropped for the depth bucket of an
+	// instanced batch, leaving the exponent and the top three
+	// bits of the mantissa, so a bucket spans an eighth of a
+	// doubling of the distance
+	const int g_DepthBucketShift = 20;
+
+	// height between the tiers of a replicated dumbbell rack
+	const float g_RackTierSpacing = 1.0f;
+
+	// floor space covered by the ceiling fixture lights, their
+	// height and the distance they reach
+	const glm::vec2 g_CeilingSize = glm::vec2(28.0f, 20.0f);
+	const float g_CeilingLightHeight = 14.5f;
+	const float g_CeilingLightRange = 8.0f;
+
+	// std140 layout of one entry of the material table
+	struct MATERIAL_STD140
+	{
+		// xyz = ambient color, w = ambient strength
+		glm::vec4 ambientColorStrength;
+		// xyz = diffuse color, w = shininess
+		glm::vec4 diffuseColorShininess;
+		glm::vec4 specularColor;
+	};
+
+	// the light count takes up a whole vec4 slot before the
+	// light array in std140
+	const size_t g_LightArrayOffset = sizeof(glm::vec4);
+
+	/***********************************************************
+	 *  PackMaterial()
+	 *
+	 *  This function lays an object material out as one entry
+	 *  of the std140 material table.
+	 ***********************************************************/
+	MATERIAL_STD140 PackMaterial(const SceneManager::OBJECT_MATERIAL& material)
+	{
+		MATERIAL_STD140 entry;
+		entry.ambientColorStrength = glm::vec4(material.ambientColor, material.ambientStrength);
+		entry.diffuseColorShininess = glm::vec4(material.diffuseColor, material.shininess);
+		entry.specularColor = glm::vec4(material.specularColor, 0.0f);
+		return(entry);
+	}
+
+	/***********************************************************
+	 *  ReadSceneFileMaterial()
+	 *
+	 *  This function gets the object material of a material
+	 *  record of a scene file.
+	 ***********************************************************/
+	SceneManager::OBJECT_MATERIAL ReadSceneFileMaterial(
+		const SceneFile& sceneFile,
+		const SceneFile::SCENE_MATERIAL& record)
+	{
+		SceneManager::OBJECT_MATERIAL material;
+		material.ambientColor = record.ambientColor;
+		material.ambientStrength = record.ambientStrength;
+		material.diffuseColor = record.diffuseColor;
+		material.specularColor = record.specularColor;
+		material.shininess = record.shininess;
+		material.tag = sceneFile.GetString(record.tag);
+		material.bTransparent = ((record.flags & SceneFile::MATERIAL_TRANSPARENT) != 0);
+		return(material);
+	}
+
+	/***********************************************************
+	 *  ReadSceneFileLight()
+	 *
+	 *  This function gets the light source of a light record of
+	 *  a scene file.
+	 ***********************************************************/
+	SceneManager::LIGHT_SOURCE ReadSceneFileLight(const SceneFile::SCENE_LIGHT& record)
+	{
+		SceneManager::LIGHT_SOURCE light;
+		light.position = record.position;
+		light.ambientColor = record.ambientColor;
+		light.diffuseColor = record.diffuseColor;
+		light.specularColor = record.specularColor;
+		light.focalStrength = record.focalStrength;
+		light.specularIntensity = record.specularIntensity;
+		light.range = record.range;
+		return(light);
+	}
+
+	/***********************************************************
+	 *  IsSameMaterial()
+	 *
+	 *  This function checks whether two object materials have
+	 *  the same values.
+	 ***********************************************************/
+	bool IsSameMaterial(const SceneManager::OBJECT_MATERIAL& a, const SceneManager::OBJECT_MATERIAL& b)
+	{
+		return((a.ambientColor == b.ambientColor) && (a.ambientStrength == b.ambientStrength) &&
+			(a.diffuseColor == b.diffuseColor) && (a.specularColor == b.specularColor) &&
+			(a.shininess == b.shininess) && (a.bTransparent == b.bTransparent));
+	}
+
+	/***********************************************************
+	 *  IsSameLight()
+	 *
+	 *  This function checks whether two light sources have the
+	 *  same values.
+	 ***********************************************************/
+	bool IsSameLight(const SceneManager::LIGHT_SOURCE& a, const SceneManager::LIGHT_SOURCE& b)
+	{
+		return((a.position == b.position) && (a.ambientColor == b.ambientColor) &&
+			(a.diffuseColor == b.diffuseColor) && (a.specularColor == b.specularColor) &&
+			(a.focalStrength == b.focalStrength) && (a.specularIntensity == b.specularIntensity) &&
+			(a.range == b.range));
+	}
+
+	/***********************************************************
+	 *  IsDrawnBefore()
+	 *
+	 *  This function is used for ordering two draw order
+	 *  entries by key, and by item for the same key.
+	 ***********************************************************/
+	bool IsDrawnBefore(const SceneManager::DRAW_ORDER_ENTRY& a, const SceneManager::DRAW_ORDER_ENTRY& b)
+	{
+		if (a.sortKey != b.sortKey)
+		{
+			return(a.sortKey < b.sortKey);
+		}
+		return(a.itemIndex < b.itemIndex);
+	}
+}
+
+/***********************************************************
+ *  SceneManager()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+SceneManager::SceneManager(ShaderManager* pShaderManager)
+{
+	m_pShaderManager = pShaderManager;
+	m_pStateCache = new ShaderStateCache(pShaderManager);
+	m_pLightBlock = new UniformBlock(g_LightBlockBinding);
+	m_pMaterialBlock = new UniformBlock(g_MaterialBlockBinding);
+	m_basicMeshes = new ShapeMeshes();
+	m_pInstancedMeshes = new InstancedMeshes();
+	m_renderPath = RENDER_PATH_DIRECT;
+	m_pIndirectCommands = new IndirectCommandBuffer();
+	m_indirectOffset = 0;
+	m_pGpuCuller = new GpuCuller();
+	m_pJobSystem = new JobSystem();
+	m_workerThreadCount = -1;
+	m_bGpuCulling = true;
+	m_bTransparentOrderDirty = false;
+	m_bTextureDemandDirty = false;
+	m_pLightClusters = new LightClusters();
+	m_bClusteredLighting = true;
+	m_ceilingLightCount = 0;
+	m_sceneFileLightCount = 0;
+	m_pShadowMaps = new ShadowMaps();
+	m_pShadowCasters = new StaticGeometry();
+	m_bShadows = true;
+	m_bMovingShadows = true;
+	m_bShadowCastersDirty = true;
+	m_bShadowMapsDirty = true;
+	m_shadowMapRenderCount = 0;
+	m_bDepthPrepass = false;
+	m_drawCommandBuffer = 0;
+	m_drawCommandOffset = 0;
+	m_pStaticGeometry = new StaticGeometry();
+	m_bStaticBatching = true;
+	m_bStaticGeometryBaked = false;
+	m_pTextureManager = new TextureManager();
+	m_pTextureStreamer = new TextureStreamer(m_pTextureManager);
+	m_opaqueItemCount = 0;
+	m_bDrawOrderDirty = true;
+	m_bRedrawNeeded = true;
+	m_opaqueBatchCount = 0;
+	m_drawCallCount = 0;
+	m_rackCount = 1;
+	m_bFrustumCulling = true;
+	m_visibleItemCount = 0;
+	m_viewMatrix = glm::mat4(1.0f);
+	m_projectionMatrix = glm::mat4(1.0f);
+	m_viewPosition = glm::vec3(0.0f, 0.0f, 0.0f);
+	m_sceneViews.resize(1);
+	m_sceneViews[0].view = m_viewMatrix;
+	m_sceneViews[0].projection = m_projectionMatrix;
+	m_sceneViews[0].viewPosition = m_viewPosition;
+	m_sceneViews[0].viewportX = 0;
+	m_sceneViews[0].viewportY = 0;
+	m_sceneViews[0].viewportWidth = 0;
+	m_sceneViews[0].viewportHeight = 0;
+}
+
+/***********************************************************
+ *  ~SceneManager()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+SceneManager::~SceneManager()
+{
+	// free the GPU resources while the context is still current
+	DestroyGLTextures();
+
+	m_pShaderManager = NULL;
+	delete m_pStateCache;
+	m_pStateCache = NULL;
+	delete m_pLightBlock;
+	m_pLightBlock = NULL;
+	delete m_pMaterialBlock;
+	m_pMaterialBlock = NULL;
+	delete m_basicMeshes;
+	m_basicMeshes = NULL;
+	delete m_pInstancedMeshes;
+	m_pInstancedMeshes = NULL;
+	delete m_pIndirectCommands;
+	m_pIndirectCommands = NULL;
+	delete m_pGpuCuller;
+	m_pGpuCuller = NULL;
+	delete m_pJobSystem;
+	m_pJobSystem = NULL;
+	delete m_pLightClusters;
+	m_pLightClusters = NULL;
+	delete m_pShadowMaps;
+	m_pShadowMaps = NULL;
+	delete m_pShadowCasters;
+	m_pShadowCasters = NULL;
+	delete m_pStaticGeometry;
+	m_pStaticGeometry = NULL;
+	delete m_pTextureStreamer;
+	m_pTextureStreamer = NULL;
+	delete m_pTextureManager;
+	m_pTextureManager = NULL;
+}
+
+/***********************************************************
+ *  CreateGLTexture()
+ *
+ *  This method is used for queueing a texture image file to
+ *  be loaded in the background. The texture slot is reserved
+ *  for the tag straight away and shows a placeholder until
+ *  the image has been decoded and uploaded.
+ ***********************************************************/
+bool SceneManager::CreateGLTexture(const char* filename, const std::string& tag)
+{
+	return(m_pTextureManager->RequestTexture(filename, tag) >= 0);
+}
+
+/***********************************************************
+ *  BindGLTextures()
+ *
+ *  This method is used for binding the loaded textures to
+ *  OpenGL texture memory slots.  There are up to 16 slots.
+ ***********************************************************/
+void SceneManager::BindGLTextures()
+{
+	m_pTextureManager->BindTextureUnits();
+}
+
+/***********************************************************
+ *  DestroyGLTextures()
+ *
+ *  This method is used for freeing the memory in all the
+ *  used texture memory slots.
+ ***********************************************************/
+void SceneManager::DestroyGLTextures()
+{
+	m_pTextureManager->Shutdown();
+}
+
+/***********************************************************
+ *  FindTextureID()
+ *
+ *  This method is used for getting an ID for the previously
+ *  loaded texture bitmap associated with the passed in tag.
+ ***********************************************************/
+int SceneManager::FindTextureID(const std::string& tag)
+{
+	int textureSlot = FindTextureSlot(tag);
+	if (textureSlot < 0)
+	{
+		return(-1);
+	}
+
+	return((int)m_pTextureManager->GetTextureID(textureSlot));
+}
+
+/***********************************************************
+ *  FindTextureSlot()
+ *
+ *  This method is used for getting a slot index for the previously
+ *  loaded texture bitmap associated with the passed in tag. The
+ *  slot index is also the handle of the texture.
+ ***********************************************************/
+int SceneManager::FindTextureSlot(const std::string& tag)
+{
+	return(m_pTextureManager->Find(tag));
+}
+
+/***********************************************************
+ *  WaitForTextures()
+ *
+ *  This method is used for blocking until every requested
+ *  texture has been uploaded, for runs that need the final
+ *  textures from the first frame on.
+ ***********************************************************/
+void SceneManager::WaitForTextures()
+{
+	m_pTextureManager->WaitForAll();
+}
+
+/***********************************************************
+ *  FindMaterial()
+ *
+ *  This method is used for getting a material from the previously
+ *  defined materials list that is associated with the passed in tag.
+ ***********************************************************/
+bool SceneManager::FindMaterial(const std::string& tag, OBJECT_MATERIAL& material)
+{
+	int materialIndex = FindMaterialIndex(tag);
+	if (materialIndex < 0)
+	{
+		return(false);
+	}
+
+	material = m_objectMaterials[materialIndex];
+
+	return(true);
+}
+
+/***********************************************************
+ *  FindMaterialIndex()
+ *
+ *  This method is used for getting the index of the previously
+ *  defined material associated with the passed in tag. The
+ *  index is also the handle of the material.
+ ***********************************************************/
+int SceneManager::FindMaterialIndex(const std::string& tag)
+{
+	return(m_materialTags.Find(tag));
+}
+
+/***********************************************************
+ *  RegisterObjectMaterials()
+ *
+ *  This method is used for resolving the tags of the defined
+ *  object materials to handles, so that the materials can
+ *  be looked up without comparing strings. A handle is the
+ *  index of its material, so a tag defined again is left
+ *  out of the table instead of moving the materials after
+ *  it away from their handles.
+ ***********************************************************/
+void SceneManager::RegisterObjectMaterials()
+{
+	m_materialTags.Clear();
+	int keptCount = 0;
+	for (int index = 0; index < m_objectMaterials.size(); index++)
+	{
+		if (m_materialTags.Find(m_objectMaterials[index].tag) != TagRegistry::INVALID_HANDLE)
+		{
+			std::cout << "Material tag defined more than once, keeping the first:" << m_objectMaterials[index].tag << std::endl;
+			continue;
+		}
+
+		m_materialTags.Register(m_objectMaterials[index].tag);
+		if (keptCount != index)
+		{
+			m_objectMaterials[keptCount] = m_objectMaterials[index];
+		}
+		keptCount++;
+	}
+	m_objectMaterials.resize(keptCount);
+}
+
+/***********************************************************
+ *  RegisterShaderUniforms()
+ *
+ *  This method is used for registering the uniforms that are
+ *  set for every draw with the shader state cache, so their
+ *  locations are only looked up once.
+ ***********************************************************/
+void SceneManager::RegisterShaderUniforms()
+{
+	m_uniforms.model = m_pStateCache->RegisterUniform(g_ModelName);
+	m_uniforms.objectColor = m_pStateCache->RegisterUniform(g_ColorValueName);
+	m_uniforms.objectTexture = m_pStateCache->RegisterUniform(g_TextureValueName);
+	m_uniforms.textureLayer = m_pStateCache->RegisterUniform(g_TextureLayerName);
+	m_uniforms.useTexture = m_pStateCache->RegisterUniform(g_UseTextureName);
+	m_uniforms.UVscale = m_pStateCache->RegisterUniform("UVscale");
+	m_uniforms.materialIndex = m_pStateCache->RegisterUniform(g_MaterialIndexName);
+	m_uniforms.useInstancing = m_pStateCache->RegisterUniform(g_UseInstancingName);
+	m_uniforms.depthOnly = m_pStateCache->RegisterUniform(g_DepthOnlyName);
+	m_uniforms.useShadows = m_pStateCache->RegisterUniform("bUseShadows");
+	m_uniforms.shadowMaps = m_pStateCache->RegisterUniform("shadowMaps");
+	m_uniforms.shadowLightCount = m_pStateCache->RegisterUniform("shadowLightCount");
+	m_uniforms.shadowDepthRange = m_pStateCache->RegisterUniform("shadowDepthRange");
+	m_uniforms.useClusters = m_pStateCache->RegisterUniform("bUseClusters");
+	m_uniforms.clusterViewport = m_pStateCache->RegisterUniform("clusterViewport");
+	m_uniforms.clusterSliceScaleBias = m_pStateCache->RegisterUniform("clusterSliceScaleBias");
+}
+
+/***********************************************************
+ *  CreateUniformBlocks()
+ *
+ *  This method is used for creating the uniform buffers that
+ *  hold the light sources and the object material table, and
+ *  attaching them to the uniform blocks of the shader.
+ ***********************************************************/
+void SceneManager::CreateUniformBlocks()
+{
+	m_pLightBlock->Create(g_LightArrayOffset + g_MaxLightSources * sizeof(LightClusters::LIGHT_DATA));
+	m_pMaterialBlock->Create(g_MaxObjectMaterials * sizeof(MATERIAL_STD140));
+
+	if (NULL != m_pShaderManager)
+	{
+		m_pLightBlock->AttachToProgram(m_pShaderManager->m_programID, "LightBlock");
+		m_pMaterialBlock->AttachToProgram(m_pShaderManager->m_programID, "MaterialBlock");
+	}
+}
+
+/***********************************************************
+ *  UploadObjectMaterials()
+ *
+ *  This method is used for copying all of the defined object
+ *  materials into the material table with one buffer update.
+ *  The material handles index straight into the table.
+ ***********************************************************/
+void SceneManager::UploadObjectMaterials()
+{
+	int materialCount = (int)m_objectMaterials.size();
+	if (materialCount > g_MaxObjectMaterials)
+	{
+		std::cout << "Too many object materials, only the first " << g_MaxObjectMaterials << " are used" << std::endl;
+		materialCount = g_MaxObjectMaterials;
+	}
+
+	std::vector<MATERIAL_STD140> materialTable(materialCount);
+	for (int index = 0; index < materialCount; index++)
+	{
+		materialTable[index] = PackMaterial(m_objectMaterials[index]);
+	}
+
+	if (materialCount > 0)
+	{
+		m_pMaterialBlock->Update(0, materialCount * sizeof(MATERIAL_STD140), materialTable.data());
+	}
+}
+
+/***********************************************************
+ *  UploadObjectMaterial()
+ *
+ *  This method is used for copying the object material at
+ *  the passed in index into its entry of the material table,
+ *  leaving the other entries alone.
+ ***********************************************************/
+void SceneManager::UploadObjectMaterial(int materialIndex)
+{
+	if ((materialIndex < 0) || (materialIndex >= m_objectMaterials.size()) ||
+		(materialIndex >= g_MaxObjectMaterials))
+	{
+		return;
+	}
+
+	MATERIAL_STD140 entry = PackMaterial(m_objectMaterials[materialIndex]);
+	m_pMaterialBlock->Update(materialIndex * sizeof(MATERIAL_STD140), sizeof(MATERIAL_STD140), &entry);
+}
+
+/***********************************************************
+ *  UploadLightSource()
+ *
+ *  This method is used for copying the light source at the
+ *  passed in index into the light buffer of the clusters,
+ *  and into the light block when it fits.
+ ***********************************************************/
+void SceneManager::UploadLightSource(int lightIndex)
+{
+	const LIGHT_SOURCE& light = m_lightSources[lightIndex];
+
+	LightClusters::LIGHT_DATA lightData;
+	lightData.positionFocal = glm::vec4(light.position, light.focalStrength);
+	lightData.ambientColor = glm::vec4(light.ambientColor, 0.0f);
+	lightData.diffuseColorRange = glm::vec4(light.diffuseColor, light.range);
+	lightData.specularColorIntensity = glm::vec4(light.specularColor, light.specularIntensity);
+
+	m_pLightClusters->SetLight(lightIndex, lightData);
+	if (lightIndex < g_MaxLightSources)
+	{
+		m_pLightBlock->Update(
+			g_LightArrayOffset + lightIndex * sizeof(LightClusters::LIGHT_DATA),
+			sizeof(LightClusters::LIGHT_DATA),
+			&lightData);
+	}
+}
+
+/***********************************************************
+ *  AddLightSource()
+ *
+ *  This method is used for adding a light source to the
+ *  lights of the scene and returning its index, or -1 when
+ *  the lights are already full. The clustered lighting holds
+ *  far more lights than the light block, which only ever
+ *  holds the first ones.
+ ***********************************************************/
+int SceneManager::AddLightSource(const LIGHT_SOURCE& light)
+{
+	int maxLightSources = (IsClusteredLightingActive() == true) ? g_MaxClusteredLights : g_MaxLightSources;
+	if (m_lightSources.size() >= maxLightSources)
+	{
+		std::cout << "Too many light sources, the limit is " << maxLightSources << std::endl;
+		return(-1);
+	}
+
+	m_lightSources.push_back(light);
+	int lightIndex = (int)m_lightSources.size() - 1;
+	UploadLightSource(lightIndex);
+
+	GLint lightCount = std::min((GLint)m_lightSources.size(), (GLint)g_MaxLightSources);
+	m_pLightBlock->Update(0, sizeof(lightCount), &lightCount);
+	m_bShadowMapsDirty = true;
+
+	return(lightIndex);
+}
+
+/***********************************************************
+ *  SetLightSource()
+ *
+ *  This method is used for changing the light source at the
+ *  passed in index, which only updates that light's part
+ *  of the light block.
+ ***********************************************************/
+void SceneManager::SetLightSource(int lightIndex, const LIGHT_SOURCE& light)
+{
+	if ((lightIndex < 0) || (lightIndex >= m_lightSources.size()))
+	{
+		return;
+	}
+
+	m_lightSources[lightIndex] = light;
+	UploadLightSource(lightIndex);
+	if (lightIndex < ShadowMaps::MAX_SHADOW_LIGHTS)
+	{
+		m_bShadowMapsDirty = true;
+	}
+}
+
+/***********************************************************
+ *  ClearLightSources()
+ *
+ *  This method is used for removing every light source, so
+ *  the lights can be added again from the start.
+ ***********************************************************/
+void SceneManager::ClearLightSources()
+{
+	m_lightSources.clear();
+	m_pLightClusters->ClearLights();
+
+	GLint lightCount = 0;
+	m_pLightBlock->Update(0, sizeof(lightCount), &lightCount);
+	m_bShadowMapsDirty = true;
+}
+
+/***********************************************************
+ *  SetTransformations()
+ *
+ *  This method is used for setting the transformation of the
+ *  next recorded item using the passed in transformation
+ *  values.
+ ***********************************************************/
+void SceneManager::SetTransformations(
+	glm::vec3 scaleXYZ,
+	float XrotationDegrees,
+	float YrotationDegrees,
+	float ZrotationDegrees,
+	glm::vec3 positionXYZ)
+{
+	m_currentItem.transform.Set(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+}
+
+/***********************************************************
+ *  SetTransformations()
+ *
+ *  This method is used for sending the model matrix of the
+ *  passed in transform into the shader. The matrix is only
+ *  composed again when the transform has been changed.
+ ***********************************************************/
+void SceneManager::SetTransformations(
+	SceneTransform& transform)
+{
+	m_pStateCache->SetMat4Value(m_uniforms.model, transform.GetModelMatrix());
+}
+
+/***********************************************************
+ *  SetShaderColor()
+ *
+ *  This method is used for setting the passed in color
+ *  for the next recorded item
+ ***********************************************************/
+void SceneManager::SetShaderColor(
+	float redColorValue,
+	float greenColorValue,
+	float blueColorValue,
+	float alphaValue)
+{
+	// variables for this method
+	glm::vec4 currentColor;
+
+	currentColor.r = redColorValue;
+	currentColor.g = greenColorValue;
+	currentColor.b = blueColorValue;
+	currentColor.a = alphaValue;
+
+	m_currentItem.color = currentColor;
+	m_currentItem.bUseTexture = false;
+}
+
+/***********************************************************
+ *  SetShaderTexture()
+ *
+ *  This method is used for setting the texture slot
+ *  associated with the passed in tag for the next
+ *  recorded item.
+ ***********************************************************/
+void SceneManager::SetShaderTexture(
+	const std::string& textureTag)
+{
+	m_currentItem.textureSlot = FindTextureSlot(textureTag);
+	m_currentItem.bUseTexture = true;
+
+	if (m_currentItem.textureSlot < 0)
+	{
+		std::cout << "Texture tag not loaded:" << textureTag << std::endl;
+	}
+}
+
+/***********************************************************
+ *  SetShaderTexture()
+ *
+ *  This method is used for setting the texture unit and the
+ *  array layer of the texture associated with the passed in
+ *  handle into the shader.
+ ***********************************************************/
+void SceneManager::SetShaderTexture(
+	int textureHandle)
+{
+	m_pStateCache->SetBoolValue(m_uniforms.useTexture, true);
+	m_pStateCache->SetSampler2DValue(m_uniforms.objectTexture, m_pTextureManager->GetTextureUnit(textureHandle));
+	m_pStateCache->SetIntValue(m_uniforms.textureLayer, m_pTextureManager->GetTextureLayer(textureHandle));
+}
+
+/***********************************************************
+ *  SetObjectStatic()
+ *
+ *  This method is used for setting whether the next recorded
+ *  items never move. Static items are baked into merged
+ *  batches, and moving ones keep the per-item paths.
+ ***********************************************************/
+void SceneManager::SetObjectStatic(
+	bool bStatic)
+{
+	m_currentItem.bStatic = bStatic;
+}
+
+/***********************************************************
+ *  SetTextureUVScale()
+ *
+ *  This method is used for setting the texture UV scale
+ *  values for the next recorded item.
+ ***********************************************************/
+void SceneManager::SetTextureUVScale(float u, float v)
+{
+	m_currentItem.uvScale = glm::vec2(u, v);
+}
+
+/***********************************************************
+ *  SetShaderMaterial()
+ *
+ *  This method is used for setting the material associated
+ *  with the passed in tag for the next recorded item. When
+ *  the tag is not defined, the previous material is kept.
+ ***********************************************************/
+void SceneManager::SetShaderMaterial(
+	const std::string& materialTag)
+{
+	int materialIndex = FindMaterialIndex(materialTag);
+	if (materialIndex >= 0)
+	{
+		m_currentItem.materialIndex = materialIndex;
+	}
+	else
+	{
+		std::cout << "Material tag not defined:" << materialTag << std::endl;
+	}
+}
+
+/***********************************************************
+ *  SetShaderMaterial()
+ *
+ *  This method is used for passing the material table index
+ *  of the passed in handle into the shader. Objects without
+ *  a valid material are drawn unlit.
+ ***********************************************************/
+void SceneManager::SetShaderMaterial(
+	int materialHandle)
+{
+	if (m_materialTags.IsValid(materialHandle) == false)
+	{
+		materialHandle = -1;
+	}
+
+	m_pStateCache->SetIntValue(m_uniforms.materialIndex, materialHandle);
+}
+
+/***********************************************************
+ *  AddRenderItem()
+ *
+ *  This method is used for recording the current render
+ *  values for the passed in mesh into the render list.
+ ***********************************************************/
+void SceneManager::AddRenderItem(MESH_TYPE mesh)
+{
+	m_currentItem.mesh = mesh;
+	m_currentItem.bTransparent = (m_currentItem.bUseTexture == false) && (m_currentItem.color.a < 1.0f);
+	if ((m_currentItem.materialIndex >= 0) &&
+		(m_objectMaterials[m_currentItem.materialIndex].bTransparent == true))
+	{
+		m_currentItem.bTransparent = true;
+	}
+	m_renderItems.push_back(m_currentItem);
+	m_bDrawOrderDirty = true;
+	m_bShadowCastersDirty = true;
+
+	// compose the model matrix and the bounds now so that
+	// they are already cached when the scene is rendered
+	UpdateRenderItemBounds(m_renderItems.back());
+}
+
+/***********************************************************
+ *  UpdateRenderItemBounds()
+ *
+ *  This method is used for computing the world space bounds
+ *  of the passed in render item from the object space box of
+ *  its mesh and its model matrix. The transformed box is
+ *  enclosed in a new axis aligned box, and the bounding
+ *  sphere encloses that box.
+ ***********************************************************/
+void SceneManager::UpdateRenderItemBounds(RENDER_ITEM& item)
+{
+	glm::vec3 localMin;
+	glm::vec3 localMax;
+	PrimitiveGeometry::GetLocalBounds(item.mesh, localMin, localMax);
+
+	const glm::mat4& model = item.transform.GetModelMatrix();
+	glm::vec3 localCenter = (localMin + localMax) * 0.5f;
+	glm::vec3 localExtent = (localMax - localMin) * 0.5f;
+
+	// the world extent along each axis is the sum of the
+	// absolute contributions of the three local axes
+	glm::vec3 worldCenter = glm::vec3(model * glm::vec4(localCenter, 1.0f));
+	glm::vec3 worldExtent(0.0f, 0.0f, 0.0f);
+	for (int axis = 0; axis < 3; axis++)
+	{
+		worldExtent += glm::abs(glm::vec3(model[axis])) * localExtent[axis];
+	}
+
+	item.boundsMin = worldCenter - worldExtent;
+	item.boundsMax = worldCenter + worldExtent;
+	item.boundsCenter = worldCenter;
+	item.boundsRadius = glm::length(worldExtent);
+}
+
+/***********************************************************
+ *  DrawMesh()
+ *
+ *  This method is used for drawing the basic mesh
+ *  associated with the passed in type.
+ ***********************************************************/
+void SceneManager::DrawMesh(MESH_TYPE mesh)
+{
+	switch (mesh)
+	{
+	case MESH_BOX:
+		m_basicMeshes->DrawBoxMesh();
+		break;
+	case MESH_CONE:
+		m_basicMeshes->DrawConeMesh();
+		break;
+	case MESH_CYLINDER:
+		m_basicMeshes->DrawCylinderMesh();
+		break;
+	case MESH_PLANE:
+		m_basicMeshes->DrawPlaneMesh();
+		break;
+	case MESH_SPHERE:
+		m_basicMeshes->DrawSphereMesh();
+		break;
+	case MESH_TAPERED_CYLINDER:
+		m_basicMeshes->DrawTaperedCylinderMesh();
+		break;
+	case MESH_TORUS:
+		m_basicMeshes->DrawTorusMesh();
+		break;
+	default:
+		break;
+	}
+}
+
+/**************************************************************/
+/*** STUDENTS CAN MODIFY the code in the methods BELOW for  ***/
+/*** preparing and rendering their own 3D replicated scenes.***/
+/*** Please refer to the code in the OpenGL sample project  ***/
+/*** for assistance.                                        ***/
+/**************************************************************/
+
+void SceneManager::LoadSceneTextures()
+{
+	/*** STUDENTS - add the code BELOW for loading the textures that ***/
+	/*** will be used for mapping to objects in the 3D scene. Refer ***/
+	/*** to the code in the OpenGL Sample for help.                 ***/
+	bool bReturn = false;
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/d6z6f7n-d0432750-413e-43dd-9c71-94851bd5de38.jpg", "floor");
+
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/dark_brown_leather_texture__tileable___2048x2048__by_fabooguy_d7aect6-pre.jpg", "kickstand"
+	);
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/Beveled_top_edge_red_textured_cast_finish_dusty_grubby_rough_flecked_metal_sheet_surface_texture.jpg", "kickbag"
+	);
+
+	//Create dumbell_steel texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/dumbell_steel_texture.jpg", "dumbell_steel"
+	);
+	//Create dumbell_orange texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/orange_dumbell_texture.jpg", "dumbell_orange"
+	);
+
+	//Create dumbell_pink texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/pink_dumbell_texture.jpg", "dumbell_pink"
+	);
+
+	//Create dumbell_grey texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/grey_dumbell_texture.jpg", "dumbell_grey"
+	);
+
+
+	//Create wall texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/texture2.jpg", "wall"
+	);
+
+	//Create window texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/glass_window_texture.jpg", "window"
+	);
+
+	//Create window wall texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/window_wall_texture.jpg", "window_wall"
+	);
+
+	//Create tv texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/TV_Texture.jpg", "tv"
+	);
+
+	//Create dumbell_steel_white texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/dumbell_steel_white_texture.jpg", "dumbell_steel_white"
+	);
+
+	//Create doors texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/door_texture.jpg", "door"
+	);
+
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/double_door_texture.jpg", "double_doors"
+	);
+	//Create weight_mats texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/texture1.jpg", "weight_mats"
+	);
+	//Create wall_mat texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/wall_mat_texture.jpg", "wall_mat"
+	);
+	//Create kettlebell_blue texture
+	bReturn = CreateGLTexture(
+		"C:/Users/coope/Downloads/kettlebell_blue_texture.jpg", "kettlebell_blue"
+	);
+
+	// after the texture image data is loaded into memory, the
+	// array textures holding them need to be bound to their
+	// texture units
+	BindGLTextures();
+}
+
+
+/*********************************************
+* DefineObjectMaterials()
+*
+This method is used to define the objects material
+for lighting, and how said objects texture would reflect
+or look when lit
+**********************************************/
+void SceneManager::DefineObjectMaterials()
+{
+	OBJECT_MATERIAL redKickMaterial;
+	redKickMaterial.ambientColor = glm::vec3(0.2f, 0.2f, 0.1f); //Low ambient color
+	redKickMaterial.ambientStrength = 0.4f; //low ambient strength
+	redKickMaterial.diffuseColor = glm::vec3(0.3f, 0.3f, 0.2f); //Low diffuse color
+	redKickMaterial.specularColor = glm::vec3(0.6f, 0.5f, 0.4f); //High specular color
+	redKickMaterial.shininess = 22.0; //Lower shininess
+	redKickMaterial.tag = "redKick";
+	m_objectMaterials.push_back(redKickMaterial);
+
+	OBJECT_MATERIAL KickStandMaterial;
+	KickStandMaterial.ambientColor = glm::vec3(0.2f, 0.2f, 0.1f); //Low ambient color
+	KickStandMaterial.ambientStrength = 0.4f; //low ambient strength
+	KickStandMaterial.diffuseColor = glm::vec3(0.3f, 0.3f, 0.2f); //Low diffuse color
+	KickStandMaterial.specularColor = glm::vec3(0.6f, 0.5f, 0.4f); //High specular color
+	KickStandMaterial.shininess = 22.0; //Lower shininess
+	KickStandMaterial.tag = "KickStand";
+	m_objectMaterials.push_back(KickStandMaterial);
+
+	OBJECT_MATERIAL MetalDumbbellMaterial;
+	MetalDumbbellMaterial.ambientColor = glm::vec3(0.1f, 0.1f, 0.1f); // Low ambient color
+	MetalDumbbellMaterial.ambientStrength = 0.2f; // Low ambient strength
+	MetalDumbbellMaterial.diffuseColor = glm::vec3(0.1f, 0.1f, 0.1f); // Low diffuse color
+	MetalDumbbellMaterial.specularColor = glm::vec3(0.5f, 0.5f, 0.5f); // High specular color
+	MetalDumbbellMaterial.shininess = 32.0; // Moderate shininess
+	MetalDumbbellMaterial.tag = "darkMetallicDumbbell";
+	m_objectMaterials.push_back(MetalDumbbellMaterial);
+
+	OBJECT_MATERIAL TVScreenMaterial;
+	TVScreenMaterial.ambientColor = glm::vec3(0.0f, 0.0f, 0.0f); // No ambient light contribution
+	TVScreenMaterial.ambientStrength = 0.0f; // Ambient strength set to 0
+	TVScreenMaterial.diffuseColor = glm::vec3(0.0f, 0.0f, 0.0f); // No diffuse reflection
+	TVScreenMaterial.specularColor = glm::vec3(0.0f, 0.0f, 0.0f); // No specular highlights
+	TVScreenMaterial.shininess = 0.0; // No shininess
+	TVScreenMaterial.tag = "blackTVScreen";
+	m_objectMaterials.push_back(TVScreenMaterial);
+
+	OBJECT_MATERIAL MirrorMaterial;
+	MirrorMaterial.ambientColor = glm::vec3(0.0f, 0.0f, 0.0f); // No ambient light contribution
+	MirrorMaterial.ambientStrength = 0.0f; // Ambient strength set to 0
+	MirrorMaterial.diffuseColor = glm::vec3(0.0f, 0.0f, 0.0f); // No diffuse reflection
+	MirrorMaterial.specularColor = glm::vec3(1.0f, 1.0f, 1.0f); // Full white specular reflection
+	MirrorMaterial.shininess = 100.0; // High shininess for sharp reflections
+	MirrorMaterial.tag = "glassMirror";
+	MirrorMaterial.bTransparent = true;
+	m_objectMaterials.push_back(MirrorMaterial);
+
+	OBJECT_MATERIAL WhiteWallMaterial;
+	WhiteWallMaterial.ambientColor = glm::vec3(0.8f, 0.8f, 0.8f); // Ambient color for soft ambient light
+	WhiteWallMaterial.ambientStrength = 0.2f; // Low ambient strength for subtle ambient light
+	WhiteWallMaterial.diffuseColor = glm::vec3(0.8f, 0.8f, 0.8f); // Diffuse color for light reflection
+	WhiteWallMaterial.specularColor = glm::vec3(0.0f, 0.0f, 0.0f); // No specular highlights
+	WhiteWallMaterial.shininess = 0.0; // No shininess
+	WhiteWallMaterial.tag = "whiteWall";
+	m_objectMaterials.push_back(WhiteWallMaterial);
+
+	OBJECT_MATERIAL WhiteHardwoodMaterial;
+	WhiteHardwoodMaterial.ambientColor = glm::vec3(0.4f, 0.4f, 0.4f); // Ambient color for soft ambient light
+	WhiteHardwoodMaterial.ambientStrength = 0.3f; // Low ambient strength for subtle ambient light
+	WhiteHardwoodMaterial.diffuseColor = glm::vec3(0.8f, 0.8f, 0.8f); // Diffuse color for light reflection
+	WhiteHardwoodMaterial.specularColor = glm::vec3(0.3f, 0.3f, 0.3f); // Specular color for sheen effect
+	WhiteHardwoodMaterial.shininess = 25.0; // Medium shininess for a slight reflective sheen
+	WhiteHardwoodMaterial.tag = "whiteHardwoodFloor";
+	m_objectMaterials.push_back(WhiteHardwoodMaterial);
+
+	OBJECT_MATERIAL RubberDumbbellMaterial;
+	RubberDumbbellMaterial.ambientColor = glm::vec3(0.1f, 0.1f, 0.1f); // Ambient color for soft ambient light
+	RubberDumbbellMaterial.ambientStrength = 0.2f; // Low ambient strength for subtle ambient light
+	RubberDumbbellMaterial.diffuseColor = glm::vec3(0.2f, 0.2f, 0.2f); // Diffuse color for light reflection
+	RubberDumbbellMaterial.specularColor = glm::vec3(0.0f, 0.0f, 0.0f); // No specular highlights
+	RubberDumbbellMaterial.shininess = 0.0; // No shininess
+	RubberDumbbellMaterial.tag = "rubberDumbbell";
+	m_objectMaterials.push_back(RubberDumbbellMaterial);
+
+	OBJECT_MATERIAL FloorMatMaterial;
+	FloorMatMaterial.ambientColor = glm::vec3(0.1f, 0.1f, 0.1f); // Ambient color for soft ambient light
+	FloorMatMaterial.ambientStrength = 0.2f; // Low ambient strength for subtle ambient light
+	FloorMatMaterial.diffuseColor = glm::vec3(0.3f, 0.3f, 0.3f); // Diffuse color for light reflection
+	FloorMatMaterial.specularColor = glm::vec3(0.0f, 0.0f, 0.0f); // No specular highlights
+	FloorMatMaterial.shininess = 0.0; // No shininess
+	FloorMatMaterial.tag = "floorMat";
+	m_objectMaterials.push_back(FloorMatMaterial);
+
+	OBJECT_MATERIAL WhiteDoorMaterial;
+	WhiteDoorMaterial.ambientColor = glm::vec3(0.2f, 0.2f, 0.2f); // Ambient color for soft ambient light
+	WhiteDoorMaterial.ambientStrength = 0.3f; // Low ambient strength for subtle ambient light
+	WhiteDoorMaterial.diffuseColor = glm::vec3(0.8f, 0.8f, 0.8f); // Diffuse color for light reflection
+	WhiteDoorMaterial.specularColor = glm::vec3(0.2f, 0.2f, 0.2f); // Specular color for slight sheen effect
+	WhiteDoorMaterial.shininess = 10.0; // Medium shininess for being slight reflective
+	WhiteDoorMaterial.tag = "whiteDoor";
+	m_objectMaterials.push_back(WhiteDoorMaterial);
+
+	OBJECT_MATERIAL WindowMaterial;
+	WindowMaterial.ambientColor = glm::vec3(0.2f, 0.2f, 0.2f); // Ambient color for soft ambient light
+	WindowMaterial.ambientStrength = 0.1f; // Low ambient strength for subtle ambient light
+	WindowMaterial.diffuseColor = glm::vec3(0.8f, 0.8f, 0.8f); // Diffuse color for light reflection
+	WindowMaterial.specularColor = glm::vec3(0.0f, 0.0f, 0.0f); // No specular highlights
+	WindowMaterial.shininess = 0.0; // No shininess
+	WindowMaterial.tag = "Window";
+	WindowMaterial.bTransparent = true;
+	m_objectMaterials.push_back(WindowMaterial);
+}
+
+
+/*********************************************
+* SetupSceneLights()
+* 
+This method is used to setup the lights
+in the scene
+**********************************************/
+
+void SceneManager::SetupSceneLights()
+{
+	// Adjusting for cool white lighting
+	const float coolWhiteIntensity = 0.8f; // Intensity for cool white lighting
+
+	// Adjusting light color temperature towards cooler end of the spectrum (blue-white)
+	const glm::vec3 coolWhite = glm::vec3(0.7f, 0.75f, 0.85f);
+
+	LIGHT_SOURCE light;
+
+	// Light 1
+	light.position = glm::vec3(-14.0f, 14.0f, 0.0f);
+	light.ambientColor = coolWhite;
+	light.diffuseColor = coolWhite;
+	light.specularColor = coolWhite;
+	light.focalStrength = 18.0f;
+	light.specularIntensity = coolWhiteIntensity;
+	light.range = 0.0f;
+	AddLightSource(light);
+
+	// Light 2
+	light.position = glm::vec3(14.0f, 5.0f, 14.0f);
+	AddLightSource(light);
+
+	m_pShaderManager->setBoolValue("bUseLighting", true);
+}
+
+/***********************************************************
+ *  AddCeilingLights()
+ *
+ *  This method is used for adding the ceiling fixtures in an
+ *  even grid under the ceiling, each only lighting the space
+ *  below it, so the clusters keep the lights per fragment
+ *  low however many there are.
+ ***********************************************************/
+void SceneManager::AddCeilingLights()
+{
+	if (m_ceilingLightCount <= 0)
+	{
+		return;
+	}
+
+	int columns = (int)std::ceil(std::sqrt(m_ceilingLightCount * g_CeilingSize.x / g_CeilingSize.y));
+	int rows = (m_ceilingLightCount + columns - 1) / columns;
+
+	LIGHT_SOURCE light;
+	light.ambientColor = glm::vec3(0.0f, 0.0f, 0.0f);
+	light.diffuseColor = glm::vec3(0.5f, 0.5f, 0.45f);
+	light.specularColor = light.diffuseColor;
+	light.focalStrength = 18.0f;
+	light.specularIntensity = 0.3f;
+	light.range = g_CeilingLightRange;
+	for (int i = 0; i < m_ceilingLightCount; i++)
+	{
+		light.position = glm::vec3(
+			g_CeilingSize.x * (((i % columns) + 0.5f) / columns - 0.5f),
+			g_CeilingLightHeight,
+			g_CeilingSize.y * (((i / columns) + 0.5f) / rows - 0.5f));
+		if (AddLightSource(light) < 0)
+		{
+			break;
+		}
+	}
+}
+
+/***********************************************************
+ *  LoadSceneFileTextures()
+ *
+ *  This method is used for queueing the texture images
+ *  listed in the opened scene file. The textures that are
+ *  already loaded are kept as they are.
+ ***********************************************************/
+void SceneManager::LoadSceneFileTextures(const SceneFile& sceneFile)
+{
+	const SceneFile::SCENE_TEXTURE* pTextures = sceneFile.GetTextures();
+	m_sceneFileTextureTags.resize(sceneFile.GetTextureCount());
+	for (int i = 0; i < sceneFile.GetTextureCount(); i++)
+	{
+		m_sceneFileTextureTags[i] = sceneFile.GetString(pTextures[i].tag);
+		if (FindTextureSlot(m_sceneFileTextureTags[i]) < 0)
+		{
+			CreateGLTexture(sceneFile.GetFilePath(pTextures[i].filename).c_str(), m_sceneFileTextureTags[i]);
+		}
+	}
+
+	BindGLTextures();
+}
+
+/***********************************************************
+ *  HasRoomForMaterials()
+ *
+ *  This method is used for checking that the materials of a
+ *  scene file fit into the material block, together with the
+ *  ones already defined. The new materials of a file are
+ *  added after the old ones, so a file that needs more than
+ *  the block holds is turned down before it is loaded or
+ *  reloaded, instead of drawing the items of the dropped
+ *  materials with the shader fallback.
+ ***********************************************************/
+bool SceneManager::HasRoomForMaterials(const SceneFile& sceneFile)
+{
+	const SceneFile::SCENE_MATERIAL* pMaterials = sceneFile.GetMaterials();
+	std::set<std::string> newMaterialTags;
+	for (int i = 0; i < sceneFile.GetMaterialCount(); i++)
+	{
+		std::string tag = sceneFile.GetString(pMaterials[i].tag);
+		if (FindMaterialIndex(tag) < 0)
+		{
+			newMaterialTags.insert(tag);
+		}
+	}
+
+	if (m_objectMaterials.size() + newMaterialTags.size() > g_MaxObjectMaterials)
+	{
+		std::cout << "The scene would need more than " << g_MaxObjectMaterials << " materials" << std::endl;
+		return(false);
+	}
+	return(true);
+}
+
+/***********************************************************
+ *  DefineSceneFileMaterials()
+ *
+ *  This method is used for defining the object materials
+ *  listed in the opened scene file.
+ ***********************************************************/
+void SceneManager::DefineSceneFileMaterials(const SceneFile& sceneFile)
+{
+	const SceneFile::SCENE_MATERIAL* pMaterials = sceneFile.GetMaterials();
+	m_objectMaterials.reserve(m_objectMaterials.size() + sceneFile.GetMaterialCount());
+	m_sceneFileMaterialTags.resize(sceneFile.GetMaterialCount());
+	for (int i = 0; i < sceneFile.GetMaterialCount(); i++)
+	{
+		m_objectMaterials.push_back(ReadSceneFileMaterial(sceneFile, pMaterials[i]));
+		m_sceneFileMaterialTags[i] = m_objectMaterials.back().tag;
+	}
+}
+
+/***********************************************************
+ *  SetupSceneFileLights()
+ *
+ *  This method is used for adding the light sources listed
+ *  in the opened scene file.
+ ***********************************************************/
+void SceneManager::SetupSceneFileLights(const SceneFile& sceneFile)
+{
+	const SceneFile::SCENE_LIGHT* pLights = sceneFile.GetLights();
+	m_sceneFileLightCount = sceneFile.GetLightCount();
+	for (int i = 0; i < sceneFile.GetLightCount(); i++)
+	{
+		if (AddLightSource(ReadSceneFileLight(pLights[i])) < 0)
+		{
+			break;
+		}
+	}
+
+	m_pShaderManager->setBoolValue("bUseLighting", true);
+}
+/***********************************************************
+ *  PrepareScene()
+ *
+ *  This method is used for preparing the 3D scene by loading
+ *  the shapes, textures in memory to support the 3D scene
+ *  rendering
+ ***********************************************************/
+void SceneManager::PrepareScene()
+{
+	// look up the per draw uniform locations once
+	RegisterShaderUniforms();
+	CreateUniformBlocks();
+
+	// a scene file replaces the built in textures, materials,
+	// lights and objects, and stays mapped until the objects
+	// have been recorded from it
+	SceneFile sceneFile;
+	bool bSceneFile = false;
+	if (m_sceneFilename.empty() == false)
+	{
+		bSceneFile = (sceneFile.Open(m_sceneFilename) == true) && (HasRoomForMaterials(sceneFile) == true);
+		if (bSceneFile == false)
+		{
+			sceneFile.Close();
+			std::cout << "Using the built in scene instead of " << m_sceneFilename << std::endl;
+		}
+	}
+
+	// decode the texture images on all but one of the cores,
+	// leaving the main thread free to render
+	unsigned int coreCount = std::thread::hardware_concurrency();
+	m_pTextureManager->Initialize((coreCount > 1) ? (int)coreCount - 1 : 1);
+	// the worker threads that split up the culling, sorting
+	// and instance filling of the draw list - GL calls stay on
+	// this thread
+	m_pJobSystem->Initialize(m_workerThreadCount);
+
+	// load the textures for the 3D scene
+	if (bSceneFile == true)
+	{
+		LoadSceneFileTextures(sceneFile);
+		DefineSceneFileMaterials(sceneFile);
+	}
+	else
+	{
+		LoadSceneTextures();
+		DefineObjectMaterials();
+	}
+	// resolve the material tags once, so that rendering
+	// only ever uses the material handles
+	RegisterObjectMaterials();
+	UploadObjectMaterials();
+	// the clusters are set up first, so that the lights past
+	// the light block limit can be added
+	if (m_pLightClusters->Initialize(g_LightClusterShaderName) == false)
+	{
+		std::cout << "Clustered lighting is not available, looping over the light block instead" << std::endl;
+	}
+	if (bSceneFile == true)
+	{
+		SetupSceneFileLights(sceneFile);
+	}
+	else
+	{
+		SetupSceneLights();
+	}
+	AddCeilingLights();
+	// only one instance of a particular mesh needs to be
+	// loaded in memory no matter how many times it is drawn
+	// in the rendered 3D scene
+
+	m_basicMeshes->LoadPlaneMesh();
+	m_basicMeshes->LoadTaperedCylinderMesh();
+	m_basicMeshes->LoadCylinderMesh();
+	m_basicMeshes->LoadConeMesh();
+	m_basicMeshes->LoadBoxMesh();
+	m_basicMeshes->LoadTorusMesh();
+	m_basicMeshes->LoadSphereMesh();
+
+	// the instanced path keeps its own copy of the basic
+	// shapes, with the per-instance attributes attached, and
+	// with multi-draw-indirect the batches of a texture array
+	// go out together in one call
+	m_pInstancedMeshes->LoadMeshes();
+	m_renderPath = RENDER_PATH_INDIRECT;
+	m_pGpuCuller->Initialize(g_CullShaderName, g_DepthPyramidShaderName);
+	ApplyCullingMode();
+
+	// record every object of the 3D scene once, so that
+	// rendering a frame only needs to walk the list
+	if (bSceneFile == true)
+	{
+		BuildSceneFileItems(sceneFile);
+	}
+	else
+	{
+		BuildRenderItems();
+	}
+	// merge the objects that never move into a few batches
+	BakeStaticGeometry();
+}
+
+/***********************************************************
+ *  RenderScene()
+ *
+ *  This method is used for rendering the 3D scene by
+ *  submitting the recorded render items to the shader. The
+ *  draw list, the instances and the shadow maps are built
+ *  once for the frame, and only the culling and the passes
+ *  are run again for every camera of SetSceneViews().
+ ***********************************************************/
+void SceneManager::RenderScene()
+{
+	if (NULL == m_pShaderManager)
+	{
+		return;
+	}
+	m_bRedrawNeeded = false;
+
+	// the shared work is done for the primary view, so its
+	// texture demand and LODs follow its viewport
+	GLint savedViewport[4];
+	glGetIntegerv(GL_VIEWPORT, savedViewport);
+	BeginSceneView(0);
+
+	// tell the streamer which textures the visible items draw,
+	// then evict and swap in textures - the array textures and
+	// layers decide the batches, so any change rebuilds them
+	m_pTextureStreamer->BeginFrame();
+	for (int slot = 0; slot < m_textureDemand.size(); slot++)
+	{
+		if (m_textureDemand[slot] >= 0)
+		{
+			m_pTextureStreamer->MarkUsed(slot, m_textureDemand[slot]);
+		}
+	}
+	if (m_pTextureStreamer->Update() > 0)
+	{
+		m_bDrawOrderDirty = true;
+	}
+	if (m_pTextureManager->ProcessUploads() > 0)
+	{
+		m_bDrawOrderDirty = true;
+	}
+
+	// the static batches look up the unit and layer of their
+	// texture when drawn, so moved textures need no new bake
+	if ((m_bStaticBatching == true) && (m_bStaticGeometryBaked == false))
+	{
+		BakeStaticGeometry();
+	}
+
+	// the GPU culls for the new view, but the tessellation
+	// levels are picked on the CPU and decide the batches
+	if ((m_bDrawOrderDirty == false) && (m_bTransparentOrderDirty == true) && (UpdateLodLevels() > 0))
+	{
+		m_bDrawOrderDirty = true;
+	}
+
+	if (m_bDrawOrderDirty == true)
+	{
+		CullRenderItems();
+		UpdateTextureDemand();
+		UpdateLodLevels();
+		SortRenderItems();
+		BuildInstanceBatches(0);
+		if (m_renderPath == RENDER_PATH_INDIRECT)
+		{
+			BuildIndirectCommands();
+		}
+		m_bTransparentOrderDirty = false;
+	}
+	else if (m_bTransparentOrderDirty == true)
+	{
+		// the opaque batches stay as they are, only the
+		// blended tail has to follow the camera
+		SortTransparentItems();
+		BuildInstanceBatches(m_opaqueItemCount);
+		BuildIndirectCommands();
+		m_bTransparentOrderDirty = false;
+	}
+
+	// the GPU culling leaves the CPU without the visible items
+	// of the new view, so their textures are found from a test
+	// of their bounds on every view change
+	if (m_bTextureDemandDirty == true)
+	{
+		UpdateTextureDemand();
+	}
+
+	m_drawCallCount = 0;
+	m_pStateCache->ResetCounters();
+
+	// the cached static shadow maps are only drawn again when
+	// a light or a static item has changed
+	UpdateShadowMaps();
+
+	for (int i = 0; i < m_sceneViews.size(); i++)
+	{
+		BeginSceneView(i);
+		DrawSceneView(i);
+	}
+
+	if (m_renderPath == RENDER_PATH_INDIRECT)
+	{
+		// the depth pyramid is only tested against by the
+		// primary view, so it is built from its viewport
+		if (m_sceneViews.size() > 1)
+		{
+			BeginSceneView(0);
+		}
+		FinishIndirectFrame();
+	}
+	glViewport(savedViewport[0], savedViewport[1], savedViewport[2], savedViewport[3]);
+}
+
+/***********************************************************
+ *  BeginSceneView()
+ *
+ *  This method is used for making one camera of the frame
+ *  the current one, setting its viewport and frustum. With
+ *  a single camera the view manager has already sent its
+ *  view uniforms, otherwise they are sent here.
+ ***********************************************************/
+void SceneManager::BeginSceneView(int viewIndex)
+{
+	const SCENE_VIEW& sceneView = m_sceneViews[viewIndex];
+	if (sceneView.viewportWidth > 0)
+	{
+		glViewport(sceneView.viewportX, sceneView.viewportY, sceneView.viewportWidth, sceneView.viewportHeight);
+	}
+	m_frustum.Update(sceneView.view, sceneView.projection);
+
+	if (m_sceneViews.size() > 1)
+	{
+		m_pShaderManager->setMat4Value(g_ViewName, sceneView.view);
+		m_pShaderManager->setMat4Value(g_ProjectionName, sceneView.projection);
+		m_pShaderManager->setVec3Value(g_ViewPositionName, sceneView.viewPosition);
+	}
+}
+
+/***********************************************************
+ *  DrawSceneView()
+ *
+ *  This method is used for drawing the shared draw list for
+ *  the current camera - its light clusters, the GPU culling
+ *  of the indirect draws and the opaque and transparent
+ *  passes. Only the primary view is tested against the depth
+ *  pyramid, which was built from its own depth.
+ ***********************************************************/
+void SceneManager::DrawSceneView(int viewIndex)
+{
+	const SCENE_VIEW& sceneView = m_sceneViews[viewIndex];
+	UpdateLightClusters(sceneView.view, sceneView.projection);
+
+	if (m_renderPath == RENDER_PATH_INDIRECT)
+	{
+		CullIndirectCommands(viewIndex == 0);
+	}
+
+	if (m_bDepthPrepass == true)
+	{
+		// lay down the depth of the opaque items first, so the
+		// lit pass after it only shades the fragments that end
+		// up on screen, instead of every overdrawn one
+		glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+		m_pStateCache->SetBoolValue(m_uniforms.depthOnly, true);
+		DrawOpaquePass();
+		m_pStateCache->SetBoolValue(m_uniforms.depthOnly, false);
+		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+		glDepthFunc(GL_LEQUAL);
+		glDepthMask(GL_FALSE);
+		DrawOpaquePass();
+		glDepthMask(GL_TRUE);
+		glDepthFunc(GL_LESS);
+	}
+	else
+	{
+		DrawOpaquePass();
+	}
+	DrawTransparentPass();
+}
+
+/***********************************************************
+ *  IsItemInSceneView()
+ *
+ *  This method is used for checking whether a render item of
+ *  the draw list is inside the current camera. The draw list
+ *  of several cameras keeps what any of them can see, so the
+ *  items are checked again as each camera draws them.
+ ***********************************************************/
+bool SceneManager::IsItemInSceneView(const RENDER_ITEM& item) const
+{
+	if ((m_sceneViews.size() <= 1) || (m_bFrustumCulling == false))
+	{
+		return(true);
+	}
+
+	return(m_frustum.IsBoxVisible(item.boundsMin, item.boundsMax));
+}
+
+/***********************************************************
+ *  DrawOpaquePass()
+ *
+ *  This method is used for drawing the static batches and
+ *  the opaque part of the draw list through the current
+ *  render path. With the depth pre-pass it is called twice,
+ *  first depth only and then lit.
+ ***********************************************************/
+void SceneManager::DrawOpaquePass()
+{
+	// the static environment is opaque, so it is drawn first
+	DrawStaticBatches();
+
+	if (m_renderPath == RENDER_PATH_INDIRECT)
+	{
+		DrawIndirectGroups(false);
+	}
+	else if (m_renderPath == RENDER_PATH_INSTANCED)
+	{
+		m_pStateCache->SetBoolValue(m_uniforms.useInstancing, true);
+		m_pInstancedMeshes->BeginDraw();
+		for (int i = 0; i < m_opaqueBatchCount; i++)
+		{
+			DrawInstanceBatch(m_instanceBatches[i]);
+		}
+		m_pInstancedMeshes->EndDraw();
+		m_pStateCache->SetBoolValue(m_uniforms.useInstancing, false);
+	}
+	else
+	{
+		// opaque items are grouped by shader state and drawn
+		// front to back within each group
+		for (int i = 0; i < m_opaqueItemCount; i++)
+		{
+			RENDER_ITEM& item = m_renderItems[m_drawOrder[i].itemIndex];
+			if (IsItemInSceneView(item) == true)
+			{
+				DrawRenderItem(item);
+			}
+		}
+	}
+}
+
+/***********************************************************
+ *  DrawTransparentPass()
+ *
+ *  This method is used for blending the transparent part of
+ *  the draw list back to front on top of the opaque items,
+ *  without writing to the z buffer.
+ ***********************************************************/
+void SceneManager::DrawTransparentPass()
+{
+	if (m_opaqueItemCount >= m_drawOrder.size())
+	{
+		return;
+	}
+
+	glDepthMask(GL_FALSE);
+	if (m_renderPath == RENDER_PATH_INDIRECT)
+	{
+		DrawIndirectGroups(true);
+	}
+	else if (m_renderPath == RENDER_PATH_INSTANCED)
+	{
+		m_pStateCache->SetBoolValue(m_uniforms.useInstancing, true);
+		m_pInstancedMeshes->BeginDraw();
+		for (int i = m_opaqueBatchCount; i < m_instanceBatches.size(); i++)
+		{
+			DrawInstanceBatch(m_instanceBatches[i]);
+		}
+		m_pInstancedMeshes->EndDraw();
+		m_pStateCache->SetBoolValue(m_uniforms.useInstancing, false);
+	}
+	else
+	{
+		for (int i = m_opaqueItemCount; i < m_drawOrder.size(); i++)
+		{
+			RENDER_ITEM& item = m_renderItems[m_drawOrder[i].itemIndex];
+			if (IsItemInSceneView(item) == true)
+			{
+				DrawRenderItem(item);
+			}
+		}
+	}
+	glDepthMask(GL_TRUE);
+}
+
+/***********************************************************
+ *  UpdateShadowMaps()
+ *
+ *  This method is used for keeping the shadow cube maps of
+ *  the lights up to date. The static maps are drawn once and
+ *  reused until a light or a static item changes, and the
+ *  items that move are drawn every frame into a copy of
+ *  them, unless their shadows are turned off and the copy is
+ *  freed. The view and projection of the scene are set again
+ *  once the maps are done.
+ ***********************************************************/
+void SceneManager::UpdateShadowMaps()
+{
+	// the shadow sampler keeps its own unit even while the
+	// shadows are off, as two sampler types must never share
+	// the unit of the texture arrays
+	m_pStateCache->SetIntValue(m_uniforms.shadowMaps, g_ShadowTextureUnit);
+
+	int shadowLightCount = std::min((int)m_lightSources.size(), (int)ShadowMaps::MAX_SHADOW_LIGHTS);
+	if ((m_bShadows == true) && (shadowLightCount > 0) && (m_pShadowMaps->GetLightCount() != shadowLightCount))
+	{
+		if (m_pShadowMaps->Create(shadowLightCount, g_ShadowMapResolution) == false)
+		{
+			std::cout << "Shadow maps could not be created, drawing the lights without shadows" << std::endl;
+			m_bShadows = false;
+		}
+		m_bShadowMapsDirty = true;
+	}
+
+	if ((m_bShadows == false) || (shadowLightCount == 0))
+	{
+		m_pShadowMaps->BindEmpty(g_ShadowTextureUnit);
+		m_pStateCache->SetBoolValue(m_uniforms.useShadows, false);
+		return;
+	}
+
+	if (m_bShadowCastersDirty == true)
+	{
+		BakeShadowCasters();
+	}
+
+	if (m_bMovingShadows == false)
+	{
+		m_pShadowMaps->DestroyFrameMaps();
+	}
+
+	bool bMovingCasters = (m_bMovingShadows == true) && (m_movingCasters.size() > 0);
+	if ((m_bShadowMapsDirty == true) || (bMovingCasters == true))
+	{
+		m_pShadowMaps->BeginRender(g_ShadowTextureUnit);
+		m_pStateCache->SetBoolValue(m_uniforms.depthOnly, true);
+
+		if (m_bShadowMapsDirty == true)
+		{
+			for (int light = 0; light < shadowLightCount; light++)
+			{
+				for (int face = 0; face < ShadowMaps::FACE_COUNT; face++)
+				{
+					m_pShadowMaps->BeginFace(light, face, true);
+					DrawShadowCasters(light, face, true);
+				}
+			}
+			m_bShadowMapsDirty = false;
+			m_shadowMapRenderCount++;
+		}
+
+		if (bMovingCasters == true)
+		{
+			m_pShadowMaps->CopyStaticToFrame();
+			for (int light = 0; light < shadowLightCount; light++)
+			{
+				for (int face = 0; face < ShadowMaps::FACE_COUNT; face++)
+				{
+					m_pShadowMaps->BeginFace(light, face, false);
+					DrawShadowCasters(light, face, false);
+				}
+			}
+		}
+
+		m_pStateCache->SetBoolValue(m_uniforms.depthOnly, false);
+		m_pShadowMaps->EndRender();
+		m_pShaderManager->setMat4Value(g_ViewName, m_viewMatrix);
+		m_pShaderManager->setMat4Value(g_ProjectionName, m_projectionMatrix);
+		m_pShadowMaps->Bind(g_ShadowTextureUnit, bMovingCasters);
+	}
+
+	m_pStateCache->SetBoolValue(m_uniforms.useShadows, true);
+	m_pStateCache->SetIntValue(m_uniforms.shadowLightCount, shadowLightCount);
+	m_pStateCache->SetVec2Value(m_uniforms.shadowDepthRange,
+		glm::vec2(m_pShadowMaps->GetNearPlane(), m_pShadowMaps->GetFarPlane()));
+}
+
+/***********************************************************
+ *  BakeShadowCasters()
+ *
+ *  This method is used for merging the static opaque items
+ *  into the batches drawn into the static shadow maps, and
+ *  collecting the opaque items that move. Only the depth of
+ *  a caster is drawn, so the batches leave out the textures
+ *  and the transparent items cast no shadows.
+ ***********************************************************/
+void SceneManager::BakeShadowCasters()
+{
+	std::vector<StaticGeometry::STATIC_OBJECT> objects;
+	m_movingCasters.clear();
+
+	for (int i = 0; i < m_renderItems.size(); i++)
+	{
+		RENDER_ITEM& item = m_renderItems[i];
+		if (item.bTransparent == true)
+		{
+			continue;
+		}
+		if (item.bStatic == false)
+		{
+			m_movingCasters.push_back(i);
+			continue;
+		}
+
+		StaticGeometry::STATIC_OBJECT object;
+		object.mesh = item.mesh;
+		object.model = item.transform.GetModelMatrix();
+		object.color = item.color;
+		object.uvScale = item.uvScale;
+		object.materialIndex = item.materialIndex;
+		object.textureSlot = -1;
+		objects.push_back(object);
+	}
+
+	m_pShadowCasters->Build(objects);
+	m_bShadowCastersDirty = false;
+	m_bShadowMapsDirty = true;
+}
+
+/***********************************************************
+ *  DrawShadowCasters()
+ *
+ *  This method is used for drawing the static batches or the
+ *  moving items that are inside one face of a light's cube
+ *  map, with the view and projection of that face.
+ ***********************************************************/
+void SceneManager::DrawShadowCasters(int light, int face, bool bStatic)
+{
+	glm::mat4 view = m_pShadowMaps->GetFaceView(m_lightSources[light].position, face);
+	glm::mat4 projection = m_pShadowMaps->GetFaceProjection();
+	m_pShaderManager->setMat4Value(g_ViewName, view);
+	m_pShaderManager->setMat4Value(g_ProjectionName, projection);
+
+	Frustum faceFrustum;
+	faceFrustum.Update(view, projection);
+
+	if (bStatic == true)
+	{
+		m_pShadowCasters->BeginDraw();
+		m_pStateCache->SetBoolValue(m_uniforms.useInstancing, true);
+		for (int i = 0; i < m_pShadowCasters->GetBatchCount(); i++)
+		{
+			glm::vec3 boundsMin;
+			glm::vec3 boundsMax;
+			m_pShadowCasters->GetBatchBounds(i, boundsMin, boundsMax);
+			if (faceFrustum.IsBoxVisible(boundsMin, boundsMax) == true)
+			{
+				m_pShadowCasters->DrawBatch(i);
+				m_drawCallCount++;
+			}
+		}
+		m_pStateCache->SetBoolValue(m_uniforms.useInstancing, false);
+		m_pShadowCasters->EndDraw();
+		return;
+	}
+
+	for (int i = 0; i < m_movingCasters.size(); i++)
+	{
+		RENDER_ITEM& item = m_renderItems[m_movingCasters[i]];
+		if (faceFrustum.IsBoxVisible(item.boundsMin, item.boundsMax) == true)
+		{
+			DrawRenderItem(item);
+		}
+	}
+}
+
+/***********************************************************
+ *  UpdateLightClusters()
+ *
+ *  This method is used for assigning the lights to the
+ *  clusters of a view, and setting the cluster uniforms of
+ *  the lit passes. The clusters are laid over the viewport
+ *  that the view is drawn into.
+ ***********************************************************/
+void SceneManager::UpdateLightClusters(const glm::mat4& view, const glm::mat4& projection)
+{
+	if (IsClusteredLightingActive() == false)
+	{
+		m_pStateCache->SetBoolValue(m_uniforms.useClusters, false);
+		return;
+	}
+
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+
+	m_pLightClusters->Update(view, projection);
+	m_pLightClusters->Bind();
+
+	m_pStateCache->SetBoolValue(m_uniforms.useClusters, true);
+	m_pStateCache->SetVec4Value(m_uniforms.clusterViewport,
+		glm::vec4((float)viewport[0], (float)viewport[1], (float)viewport[2], (float)viewport[3]));
+	m_pStateCache->SetVec2Value(m_uniforms.clusterSliceScaleBias, m_pLightClusters->GetSliceScaleBias());
+}
+
+/***********************************************************
+ *  IsClusteredLightingActive()
+ *
+ *  This method is used for checking whether the lit passes
+ *  only evaluate the lights of each fragment's cluster.
+ ***********************************************************/
+bool SceneManager::IsClusteredLightingActive() const
+{
+	return((m_bClusteredLighting == true) && (m_pLightClusters->IsReady() == true));
+}
+
+/***********************************************************
+ *  SetShadows()
+ *
+ *  This method is used for turning the shadow maps of the
+ *  lights on or off. The static maps are drawn again when
+ *  they are turned back on.
+ ***********************************************************/
+void SceneManager::SetShadows(bool bEnabled)
+{
+	if (m_bShadows != bEnabled)
+	{
+		m_bShadows = bEnabled;
+		m_bShadowMapsDirty = true;
+	}
+}
+
+/***********************************************************
+ *  SetMovingShadows()
+ *
+ *  This method is used for turning the shadows of the moving
+ *  items on or off. Without them the per frame maps are not
+ *  needed, saving as much video memory as the static maps
+ *  take. The static maps are drawn again so they are bound
+ *  in place of the per frame ones.
+ ***********************************************************/
+void SceneManager::SetMovingShadows(bool bEnabled)
+{
+	if (m_bMovingShadows != bEnabled)
+	{
+		m_bMovingShadows = bEnabled;
+		m_bShadowMapsDirty = true;
+	}
+}
+
+/***********************************************************
+ *  SetSceneView()
+ *
+ *  This method is used for setting the view values of the
+ *  frame to be rendered. The visible items and the draw order
+ *  depend on the view and projection, so they are culled and
+ *  sorted again whenever either has changed. When the GPU
+ *  culls the indirect draws only the transparent items are
+ *  sorted again.
+ ***********************************************************/
+void SceneManager::SetSceneView(
+	const glm::mat4& view,
+	const glm::mat4& projection,
+	const glm::vec3& viewPosition)
+{
+	// the draw list of several cameras kept what any of them
+	// could see, which is more than this one needs
+	if (m_sceneViews.size() > 1)
+	{
+		m_bRedrawNeeded = true;
+		m_bDrawOrderDirty = true;
+	}
+	UpdatePrimaryView(view, projection, viewPosition);
+
+	SCENE_VIEW sceneView;
+	sceneView.view = view;
+	sceneView.projection = projection;
+	sceneView.viewPosition = viewPosition;
+	sceneView.viewportX = 0;
+	sceneView.viewportY = 0;
+	sceneView.viewportWidth = 0;
+	sceneView.viewportHeight = 0;
+	m_sceneViews.assign(1, sceneView);
+}
+
+/***********************************************************
+ *  SetSceneViews()
+ *
+ *  This method is used for setting several cameras for the
+ *  frame, each drawn into its own viewport. The first one is
+ *  the primary view, which the draw list is sorted and its
+ *  LODs picked for. Without GPU culling the CPU keeps the
+ *  items that any camera can see, so a change to any of
+ *  them culls the draw list again.
+ ***********************************************************/
+void SceneManager::SetSceneViews(const std::vector<SCENE_VIEW>& views)
+{
+	if (views.empty() == true)
+	{
+		return;
+	}
+
+	bool bChanged = (views.size() != m_sceneViews.size());
+	for (int i = 0; (i < views.size()) && (bChanged == false); i++)
+	{
+		const SCENE_VIEW& newView = views[i];
+		const SCENE_VIEW& oldView = m_sceneViews[i];
+		bChanged = (memcmp(&newView.view, &oldView.view, sizeof(glm::mat4)) != 0) ||
+			(memcmp(&newView.projection, &oldView.projection, sizeof(glm::mat4)) != 0) ||
+			(newView.viewportX != oldView.viewportX) ||
+			(newView.viewportY != oldView.viewportY) ||
+			(newView.viewportWidth != oldView.viewportWidth) ||
+			(newView.viewportHeight != oldView.viewportHeight);
+	}
+	if (bChanged == true)
+	{
+		m_bRedrawNeeded = true;
+		if (IsGpuCullingActive() == false)
+		{
+			m_bDrawOrderDirty = true;
+		}
+		else
+		{
+			m_bTextureDemandDirty = true;
+		}
+	}
+
+	UpdatePrimaryView(views[0].view, views[0].projection, views[0].viewPosition);
+	m_sceneViews = views;
+}
+
+/***********************************************************
+ *  UpdatePrimaryView()
+ *
+ *  This method is used for keeping the view values of the
+ *  primary camera, marking the draw order or only its
+ *  transparent part to be sorted again when they change.
+ ***********************************************************/
+void SceneManager::UpdatePrimaryView(
+	const glm::mat4& view,
+	const glm::mat4& projection,
+	const glm::vec3& viewPosition)
+{
+	if ((memcmp(&view, &m_viewMatrix, sizeof(glm::mat4)) != 0) ||
+		(memcmp(&projection, &m_projectionMatrix, sizeof(glm::mat4)) != 0))
+	{
+		m_bRedrawNeeded = true;
+		if (IsGpuCullingActive() == true)
+		{
+			m_bTransparentOrderDirty = true;
+			m_bTextureDemandDirty = true;
+		}
+		else
+		{
+			m_bDrawOrderDirty = true;
+		}
+	}
+
+	m_viewMatrix = view;
+	m_projectionMatrix = projection;
+	m_viewPosition = viewPosition;
+}
+
+/***********************************************************
+ *  CullRenderItems()
+ *
+ *  This method is used for marking which render items are
+ *  inside the view frustum of the frame. The cheap sphere
+ *  test rejects most hidden items, and the items that pass it
+ *  are checked again against their tighter box. With several
+ *  cameras an item is kept when any of them can see it.
+ ***********************************************************/
+void SceneManager::CullRenderItems()
+{
+	UpdateViewFrustums();
+	m_visibleItemCount = 0;
+
+	// the GPU tests every item in its cull pass instead
+	bool bTestOnCpu = (m_bFrustumCulling == true) && (IsGpuCullingActive() == false);
+
+	std::atomic<int> visibleCount(0);
+	m_pJobSystem->ParallelFor((int)m_renderItems.size(), g_JobGrainSize,
+		[&](int first, int last, int threadIndex)
+		{
+			int chunkVisibleCount = 0;
+			for (int i = first; i < last; i++)
+			{
+				RENDER_ITEM& item = m_renderItems[i];
+
+				item.bVisible = (bTestOnCpu == false);
+				for (int view = 0; (view < m_viewFrustums.size()) && (item.bVisible == false); view++)
+				{
+					const Frustum& frustum = m_viewFrustums[view];
+					item.bVisible = (frustum.IsSphereVisible(item.boundsCenter, item.boundsRadius) == true) &&
+						(frustum.IsBoxVisible(item.boundsMin, item.boundsMax) == true);
+				}
+
+				if (item.bVisible == true)
+				{
+					chunkVisibleCount++;
+				}
+			}
+			visibleCount += chunkVisibleCount;
+		});
+	m_visibleItemCount = visibleCount.load();
+}
+
+/***********************************************************
+ *  UpdateViewFrustums()
+ *
+ *  This method is used for setting up the frustum of the
+ *  primary view and of every view drawn in the frame.
+ ***********************************************************/
+void SceneManager::UpdateViewFrustums()
+{
+	m_frustum.Update(m_viewMatrix, m_projectionMatrix);
+	m_viewFrustums.resize(m_sceneViews.size());
+	for (int i = 0; i < m_sceneViews.size(); i++)
+	{
+		m_viewFrustums[i].Update(m_sceneViews[i].view, m_sceneViews[i].projection);
+	}
+}
+
+/***********************************************************
+ *  UpdateTextureDemand()
+ *
+ *  This method is used for working out the first mip level
+ *  each texture needs. The bounding sphere of every visible
+ *  textured item is projected to find how many pixels it
+ *  covers, and the texels stretched across it are compared
+ *  with that - each halving of the texels per pixel below
+ *  one lets the texture drop a level.
+ ***********************************************************/
+void SceneManager::UpdateTextureDemand()
+{
+	m_textureDemand.assign(m_pTextureManager->GetTextureCount(), -1);
+
+	GLint viewport[4] = { 0, 0, 0, 0 };
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	// pixels covered by one world unit at a distance of one,
+	// or at any distance for an orthographic projection
+	float pixelsPerUnit = 0.5f * (float)viewport[3] * m_projectionMatrix[1][1];
+	bool bPerspective = (m_projectionMatrix[3][3] == 0.0f);
+
+	// the GPU cull pass leaves every item marked visible, so
+	// the items are tested against the view frustums here
+	bool bTestFrustums = (m_bFrustumCulling == true) && (IsGpuCullingActive() == true);
+	if (bTestFrustums == true)
+	{
+		UpdateViewFrustums();
+	}
+	m_bTextureDemandDirty = false;
+
+	// every thread keeps its own demand, merged at the end
+	std::vector<std::vector<int>> threadDemand(m_pJobSystem->GetThreadCount(), m_textureDemand);
+	m_pJobSystem->ParallelFor((int)m_renderItems.size(), g_JobGrainSize,
+		[&](int first, int last, int threadIndex)
+		{
+			for (int i = first; i < last; i++)
+			{
+				UpdateItemTextureDemand(m_renderItems[i], pixelsPerUnit, bPerspective, bTestFrustums, threadDemand[threadIndex]);
+			}
+		});
+
+	for (int thread = 0; thread < threadDemand.size(); thread++)
+	{
+		for (int slot = 0; slot < m_textureDemand.size(); slot++)
+		{
+			int level = threadDemand[thread][slot];
+			if ((level >= 0) && ((m_textureDemand[slot] < 0) || (level < m_textureDemand[slot])))
+			{
+				m_textureDemand[slot] = level;
+			}
+		}
+	}
+}
+
+/***********************************************************
+ *  UpdateItemTextureDemand()
+ *
+ *  This method is used for lowering the first mip level that
+ *  the passed in demand asks for the texture of an item, when
+ *  the item is visible and big enough on screen to need it.
+ ***********************************************************/
+void SceneManager::UpdateItemTextureDemand(
+	const RENDER_ITEM& item,
+	float pixelsPerUnit,
+	bool bPerspective,
+	bool bTestFrustums,
+	std::vector<int>& demand) const
+{
+	if ((item.bVisible == false) || (item.bUseTexture == false) ||
+		(item.textureSlot < 0) || (item.textureSlot >= demand.size()))
+	{
+		return;
+	}
+
+	if (bTestFrustums == true)
+	{
+		bool bInView = false;
+		for (int view = 0; (view < m_viewFrustums.size()) && (bInView == false); view++)
+		{
+			bInView = (m_viewFrustums[view].IsSphereVisible(item.boundsCenter, item.boundsRadius) == true);
+		}
+		if (bInView == false)
+		{
+			return;
+		}
+	}
+
+	int width = 0;
+	int height = 0;
+	int levelCount = 0;
+	m_pTextureManager->GetImageSize(item.textureSlot, width, height, levelCount);
+
+	// textures that were never loaded are asked for in full
+	int level = 0;
+	if (levelCount > 1)
+	{
+		float screenPixels = std::max(GetProjectedPixels(item, pixelsPerUnit, bPerspective), 1.0f);
+		float texels = (float)std::max(width, height) * std::max(item.uvScale.x, item.uvScale.y);
+
+		level = (int)std::floor(std::log2(std::max(texels / screenPixels, 1.0f)));
+		level = std::min(level, levelCount - 1);
+	}
+
+	int& slotDemand = demand[item.textureSlot];
+	slotDemand = (slotDemand < 0) ? level : std::min(slotDemand, level);
+}
+
+/***********************************************************
+ *  GetProjectedPixels()
+ *
+ *  This method is used for getting how many pixels high the
+ *  bounding sphere of an item is on screen, measured at the
+ *  point of the sphere closest to the camera.
+ ***********************************************************/
+float SceneManager::GetProjectedPixels(const RENDER_ITEM& item, float pixelsPerUnit, bool bPerspective) const
+{
+	float distance = 1.0f;
+	if (bPerspective == true)
+	{
+		distance = std::max(glm::length(item.boundsCenter - m_viewPosition) - item.boundsRadius, 0.1f);
+	}
+
+	return(2.0f * item.boundsRadius * pixelsPerUnit / distance);
+}
+
+/***********************************************************
+ *  UpdateLodLevels()
+ *
+ *  This method is used for picking the tessellation level of
+ *  every item drawn one by one from how many pixels high it
+ *  is, with the zoom of the projection already in the pixel
+ *  size. An item has to move past a threshold by part of
+ *  it before its level changes, so one resting on a threshold
+ *  does not switch back and forth between frames.
+ ***********************************************************/
+int SceneManager::UpdateLodLevels()
+{
+	GLint viewport[4] = { 0, 0, 0, 0 };
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	float pixelsPerUnit = 0.5f * (float)viewport[3] * m_projectionMatrix[1][1];
+	bool bPerspective = (m_projectionMatrix[3][3] == 0.0f);
+	std::atomic<int> changedCount(0);
+
+	m_pJobSystem->ParallelFor((int)m_renderItems.size(), g_JobGrainSize,
+		[&](int first, int last, int threadIndex)
+		{
+			int chunkChangedCount = 0;
+			for (int i = first; i < last; i++)
+			{
+				RENDER_ITEM& item = m_renderItems[i];
+				int lodCount = PrimitiveGeometry::GetLodCount(item.mesh);
+				if ((item.bVisible == false) || (item.bBaked == true) || (lodCount <= 1))
+				{
+					continue;
+				}
+
+				float pixels = GetProjectedPixels(item, pixelsPerUnit, bPerspective);
+				int level = std::max(0, std::min(item.lodLevel, lodCount - 1));
+				while ((level > 0) && (pixels > g_LodPixelThresholds[level - 1] * (1.0f + g_LodHysteresis)))
+				{
+					level--;
+				}
+				while ((level < lodCount - 1) && (pixels < g_LodPixelThresholds[level] * (1.0f - g_LodHysteresis)))
+				{
+					level++;
+				}
+
+				if (level != item.lodLevel)
+				{
+					item.lodLevel = level;
+					chunkChangedCount++;
+				}
+			}
+			changedCount += chunkChangedCount;
+		});
+
+	return(changedCount.load());
+}
+
+/***********************************************************
+ *  SortRenderItems()
+ *
+ *  This method is used for sorting the visible render items
+ *  into the draw order. Opaque items come first, sorted by mesh and
+ *  tessellation level, then texture array, then material, and front
+ *  to back for items with the same state so the z test can reject hidden fragments
+ *  early. Transparent items come last, sorted back to front
+ *  so they blend correctly.
+ ***********************************************************/
+void SceneManager::SortRenderItems()
+{
+	// every thread collects the entries of its chunks into a
+	// list of its own, so no entry is written under a lock
+	m_threadDrawOrders.resize(m_pJobSystem->GetThreadCount());
+	for (int thread = 0; thread < m_threadDrawOrders.size(); thread++)
+	{
+		m_threadDrawOrders[thread].clear();
+	}
+
+	std::atomic<int> opaqueCount(0);
+	m_pJobSystem->ParallelFor((int)m_renderItems.size(), g_JobGrainSize,
+		[&](int first, int last, int threadIndex)
+		{
+			std::vector<DRAW_ORDER_ENTRY>& entries = m_threadDrawOrders[threadIndex];
+			int chunkOpaqueCount = 0;
+			for (int i = first; i < last; i++)
+			{
+				RENDER_ITEM& item = m_renderItems[i];
+				if ((item.bVisible == false) || (item.bBaked == true))
+				{
+					continue;
+				}
+
+				DRAW_ORDER_ENTRY entry;
+				entry.sortKey = GetSortKey(item);
+				entry.itemIndex = i;
+				entries.push_back(entry);
+				if (item.bTransparent == false)
+				{
+					chunkOpaqueCount++;
+				}
+			}
+			opaqueCount += chunkOpaqueCount;
+		});
+
+	m_drawOrder.clear();
+	m_drawOrder.reserve(m_renderItems.size());
+	for (int thread = 0; thread < m_threadDrawOrders.size(); thread++)
+	{
+		m_drawOrder.insert(m_drawOrder.end(), m_threadDrawOrders[thread].begin(), m_threadDrawOrders[thread].end());
+	}
+	m_opaqueItemCount = opaqueCount.load();
+
+	SortDrawOrder(0, (int)m_drawOrder.size());
+
+	m_bDrawOrderDirty = false;
+}
+
+/***********************************************************
+ *  GetSortKey()
+ *
+ *  This method is used for getting the sort key of an item.
+ *  Transparent items have the top bit set so they come last,
+ *  with the depth inverted so the farthest comes first.
+ ***********************************************************/
+uint64_t SceneManager::GetSortKey(RENDER_ITEM& item)
+{
+	uint32_t depthBits = GetViewDepthBits(item);
+
+	if (item.bTransparent == true)
+	{
+		return((1ull << 63) | (uint64_t)(~depthBits));
+	}
+
+	// layers of the same array share the sampler, so only
+	// the texture unit of the array is part of the key
+	uint64_t textureKey = (item.bUseTexture == true) ? (uint64_t)(m_pTextureManager->GetTextureUnit(item.textureSlot) + 1) : 0;
+	uint64_t materialKey = (uint64_t)(item.materialIndex + 1);
+	// each level of a shape is a mesh of its own
+	uint64_t meshKey = (uint64_t)(item.mesh * PrimitiveGeometry::LOD_COUNT + item.lodLevel);
+
+	return((meshKey << 56) |
+		((textureKey & 0xFFF) << 44) |
+		((materialKey & 0xFFF) << 32) |
+		(uint64_t)depthBits);
+}
+
+/***********************************************************
+ *  SortDrawOrder()
+ *
+ *  This method is used for sorting the passed in range of the
+ *  draw order. The range is cut into one run per thread, the
+ *  runs are sorted at the same time, and then merged in pairs
+ *  until one run is left. Items with the same key stay in
+ *  item order, so the result does not depend on which thread
+ *  collected which entry.
+ ***********************************************************/
+void SceneManager::SortDrawOrder(int first, int last)
+{
+	std::vector<DRAW_ORDER_ENTRY>::iterator begin = m_drawOrder.begin() + first;
+	int count = last - first;
+	int runCount = std::min(m_pJobSystem->GetThreadCount(), count / g_JobGrainSize);
+
+	if (runCount <= 1)
+	{
+		std::sort(begin, begin + count, IsDrawnBefore);
+		return;
+	}
+
+	int runSize = (count + runCount - 1) / runCount;
+	m_pJobSystem->ParallelFor(runCount, 1,
+		[&](int firstRun, int lastRun, int threadIndex)
+		{
+			for (int run = firstRun; run < lastRun; run++)
+			{
+				int runStart = std::min(run * runSize, count);
+				int runEnd = std::min(runStart + runSize, count);
+				std::sort(begin + runStart, begin + runEnd, IsDrawnBefore);
+			}
+		});
+
+	for (int width = runSize; width < count; width *= 2)
+	{
+		int mergeCount = (count + 2 * width - 1) / (2 * width);
+		m_pJobSystem->ParallelFor(mergeCount, 1,
+			[&](int firstMerge, int lastMerge, int threadIndex)
+			{
+				for (int merge = firstMerge; merge < lastMerge; merge++)
+				{
+					int low = merge * 2 * width;
+					int middle = std::min(low + width, count);
+					int high = std::min(low + 2 * width, count);
+					if (middle < high)
+					{
+						std::inplace_merge(begin + low, begin + middle, begin + high, IsDrawnBefore);
+					}
+				}
+			});
+	}
+}
+
+/***********************************************************
+ *  GetViewDepthBits()
+ *
+ *  This method is used for getting the distance of an item in
+ *  front of the camera, along the view direction, as bits
+ *  that can be used in a sort key.
+ ***********************************************************/
+uint32_t SceneManager::GetViewDepthBits(RENDER_ITEM& item)
+{
+	const glm::mat4& model = item.transform.GetModelMatrix();
+	glm::vec4 viewPosition = m_viewMatrix * model[3];
+	float depth = std::max(-viewPosition.z, 0.0f);
+	// the bits of a positive float sort in the same order as its value
+	uint32_t depthBits = 0;
+	memcpy(&depthBits, &depth, sizeof(depthBits));
+
+	return(depthBits);
+}
+
+/***********************************************************
+ *  SortTransparentItems()
+ *
+ *  This method is used for sorting the transparent items at
+ *  the end of the draw order back to front for the current
+ *  view, leaving the opaque items where they are.
+ ***********************************************************/
+void SceneManager::SortTransparentItems()
+{
+	for (int i = m_opaqueItemCount; i < m_drawOrder.size(); i++)
+	{
+		m_drawOrder[i].sortKey = GetSortKey(m_renderItems[m_drawOrder[i].itemIndex]);
+	}
+
+	SortDrawOrder(m_opaqueItemCount, (int)m_drawOrder.size());
+}
+
+/***********************************************************
+ *  DrawRenderItem()
+ *
+ *  This method is used for sending the render values of the
+ *  passed in item into the shader and drawing its mesh.
+ ***********************************************************/
+void SceneManager::DrawRenderItem(RENDER_ITEM& item)
+{
+	SetTransformations(item.transform);
+	m_pStateCache->SetVec4Value(m_uniforms.objectColor, item.color);
+	if (item.bUseTexture == true)
+	{
+		SetShaderTexture(item.textureSlot);
+	}
+	else
+	{
+		m_pStateCache->SetBoolValue(m_uniforms.useTexture, false);
+	}
+	m_pStateCache->SetVec2Value(m_uniforms.UVscale, item.uvScale);
+	SetShaderMaterial(item.materialIndex);
+
+	DrawMesh(item.mesh);
+	m_drawCallCount++;
+}
+
+/***********************************************************
+ *  BuildInstanceBatches()
+ *
+ *  This method is used for grouping the sorted render items
+ *  into batches of neighbours that share the same mesh and
+ *  texture array, and for uploading the per-instance
+ *  values of every item in draw order. The sort already puts
+ *  items with the same state next to each other, so a batch
+ *  never changes the order the items are drawn in. Batches
+ *  before the passed in draw order entry are kept, which
+ *  has to be 0 or the start of a batch.
+ ***********************************************************/
+void SceneManager::BuildInstanceBatches(int firstEntry)
+{
+	m_instanceData.resize(m_drawOrder.size());
+	if (firstEntry == 0)
+	{
+		m_instanceBatches.clear();
+		m_opaqueBatchCount = 0;
+	}
+	// only the items from the first entry on have moved, so
+	// the kept batches still cover the same items
+	while ((m_instanceBatches.size() > 0) && (m_instanceBatches.back().firstItem >= firstEntry))
+	{
+		if (m_instanceBatches.size() <= m_opaqueBatchCount)
+		{
+			m_opaqueBatchCount--;
+		}
+		m_instanceBatches.pop_back();
+	}
+
+	// the per-instance values are filled in on all threads,
+	// every entry writing only its own slot
+	m_pJobSystem->ParallelFor((int)m_drawOrder.size() - firstEntry, g_JobGrainSize,
+		[&](int first, int last, int threadIndex)
+		{
+			for (int i = firstEntry + first; i < firstEntry + last; i++)
+			{
+				RENDER_ITEM& item = m_renderItems[m_drawOrder[i].itemIndex];
+
+				InstancedMeshes::INSTANCE_DATA& instance = m_instanceData[i];
+				instance.model = item.transform.GetModelMatrix();
+				instance.color = item.color;
+				instance.uvScale = item.uvScale;
+				instance.materialIndex = item.materialIndex;
+				instance.textureLayer = (item.bUseTexture == true) ? m_pTextureManager->GetTextureLayer(item.textureSlot) : 0;
+			}
+		});
+
+	// the batches only compare neighbours, which is cheap
+	// enough to stay on this thread
+	for (int i = firstEntry; i < m_drawOrder.size(); i++)
+	{
+		const RENDER_ITEM& item = m_renderItems[m_drawOrder[i].itemIndex];
+
+		bool bNewBatch = true;
+		if (m_instanceBatches.size() > 0)
+		{
+			const RENDER_ITEM& first = m_renderItems[m_drawOrder[m_instanceBatches.back().firstItem].itemIndex];
+			bNewBatch =
+				(first.mesh != item.mesh) ||
+				(first.lodLevel != item.lodLevel) ||
+				(first.bUseTexture != item.bUseTexture) ||
+				((item.bUseTexture == true) &&
+				 (m_pTextureManager->GetTextureUnit(first.textureSlot) != m_pTextureManager->GetTextureUnit(item.textureSlot))) ||
+				(first.bTransparent != item.bTransparent);
+		}
+
+		if (bNewBatch == true)
+		{
+			INSTANCE_BATCH batch;
+			batch.firstItem = i;
+			batch.itemCount = 0;
+			m_instanceBatches.push_back(batch);
+			if (item.bTransparent == false)
+			{
+				m_opaqueBatchCount++;
+			}
+		}
+		m_instanceBatches.back().itemCount++;
+	}
+
+	m_pInstancedMeshes->UploadInstances(m_instanceData, firstEntry);
+}
+
+/***********************************************************
+ *  DrawInstanceBatch()
+ *
+ *  This method is used for sending the render values that
+ *  the items of the passed in batch share into the shader,
+ *  and drawing all of them with one instanced draw call. The
+ *  transform, color, UV scale, material index and texture
+ *  layer come from the per-instance values instead.
+ ***********************************************************/
+void SceneManager::DrawInstanceBatch(const INSTANCE_BATCH& batch)
+{
+	const RENDER_ITEM& item = m_renderItems[m_drawOrder[batch.firstItem].itemIndex];
+
+	if (item.bUseTexture == true)
+	{
+		m_pStateCache->SetBoolValue(m_uniforms.useTexture, true);
+		m_pStateCache->SetSampler2DValue(m_uniforms.objectTexture, m_pTextureManager->GetTextureUnit(item.textureSlot));
+	}
+	else
+	{
+		m_pStateCache->SetBoolValue(m_uniforms.useTexture, false);
+	}
+
+	m_pInstancedMeshes->DrawInstances(item.mesh, item.lodLevel, batch.firstItem, batch.itemCount);
+	m_drawCallCount++;
+}
+
+/***********************************************************
+ *  GetBatchTextureUnit()
+ *
+ *  This method is used for getting the texture unit that the
+ *  items of the passed in batch sample, or -1 when they are
+ *  drawn without a texture.
+ ***********************************************************/
+int SceneManager::GetBatchTextureUnit(const INSTANCE_BATCH& batch) const
+{
+	const RENDER_ITEM& item = m_renderItems[m_drawOrder[batch.firstItem].itemIndex];
+
+	if (item.bUseTexture == false)
+	{
+		return(-1);
+	}
+
+	return(m_pTextureManager->GetTextureUnit(item.textureSlot));
+}
+
+/***********************************************************
+ *  GetBatchDepthBucket()
+ *
+ *  This method is used for getting the view depth of the
+ *  nearest item of the passed in batch, rounded down to a
+ *  bucket so that batches at about the same distance keep
+ *  their order.
+ ***********************************************************/
+uint32_t SceneManager::GetBatchDepthBucket(const INSTANCE_BATCH& batch) const
+{
+	uint32_t nearestBits = 0xFFFFFFFF;
+	for (int i = batch.firstItem; i < batch.firstItem + batch.itemCount; i++)
+	{
+		// the view depth bits are the low half of the sort key
+		nearestBits = std::min(nearestBits, (uint32_t)(m_drawOrder[i].sortKey & 0xFFFFFFFF));
+	}
+
+	return(nearestBits >> g_DepthBucketShift);
+}
+
+/***********************************************************
+ *  BuildIndirectCommands()
+ *
+ *  This method is used for writing an indirect command for
+ *  every instanced batch into the persistently mapped
+ *  command buffer. The sampler has to be the same for every
+ *  command of a multi-draw call, so the opaque batches are
+ *  grouped by texture unit, and within a unit go from the
+ *  nearest depth bucket to the farthest, keeping the early
+ *  depth test of the front to back order. The transparent
+ *  batches keep their back to front order and only share a
+ *  group with the neighbours using the same unit. When the
+ *  GPU culls the draws, the opaque commands start with no
+ *  instances and the batches are handed to the cull pass,
+ *  which adds the visible instances back every frame.
+ ***********************************************************/
+void SceneManager::BuildIndirectCommands()
+{
+	bool bGpuCulling = IsGpuCullingActive();
+	std::vector<GpuCuller::CULL_BATCH> cullBatches(m_instanceBatches.size());
+
+	m_indirectCommands.clear();
+	m_indirectGroups.clear();
+
+	std::vector<int> batchOrder(m_instanceBatches.size());
+	for (int i = 0; i < batchOrder.size(); i++)
+	{
+		batchOrder[i] = i;
+	}
+	std::vector<int> batchUnits(m_opaqueBatchCount);
+	std::vector<uint32_t> batchDepths(m_opaqueBatchCount);
+	for (int i = 0; i < m_opaqueBatchCount; i++)
+	{
+		batchUnits[i] = GetBatchTextureUnit(m_instanceBatches[i]);
+		batchDepths[i] = GetBatchDepthBucket(m_instanceBatches[i]);
+	}
+	std::stable_sort(batchOrder.begin(), batchOrder.begin() + m_opaqueBatchCount,
+		[&batchUnits, &batchDepths](int a, int b)
+		{
+			if (batchUnits[a] != batchUnits[b])
+			{
+				return(batchUnits[a] < batchUnits[b]);
+			}
+			return(batchDepths[a] < batchDepths[b]);
+		});
+
+	for (int i = 0; i < batchOrder.size(); i++)
+	{
+		const INSTANCE_BATCH& batch = m_instanceBatches[batchOrder[i]];
+		const RENDER_ITEM& item = m_renderItems[m_drawOrder[batch.firstItem].itemIndex];
+		int textureUnit = GetBatchTextureUnit(batch);
+		bool bTransparent = (batchOrder[i] >= m_opaqueBatchCount);
+
+		if ((m_indirectGroups.size() == 0) ||
+			(m_indirectGroups.back().textureUnit != textureUnit) ||
+			(m_indirectGroups.back().bTransparent != bTransparent))
+		{
+			INDIRECT_GROUP group;
+			group.firstCommand = (int)m_indirectCommands.size();
+			group.commandCount = 0;
+			group.textureUnit = textureUnit;
+			group.bTransparent = bTransparent;
+			m_indirectGroups.push_back(group);
+		}
+
+		GpuCuller::CULL_BATCH& cullBatch = cullBatches[batchOrder[i]];
+		cullBatch.firstInstance = (GLuint)batch.firstItem;
+		cullBatch.instanceCount = (GLuint)batch.itemCount;
+		cullBatch.command = (GLuint)m_indirectCommands.size();
+		cullBatch.flags = (GLuint)item.mesh | ((bTransparent == true) ? GpuCuller::BATCH_TRANSPARENT : 0);
+
+		IndirectCommandBuffer::DRAW_COMMAND command;
+		m_pInstancedMeshes->GetDrawCommand(item.mesh, item.lodLevel, batch.firstItem, batch.itemCount, command);
+		if ((bGpuCulling == true) && (bTransparent == false))
+		{
+			command.instanceCount = 0;
+		}
+		m_indirectCommands.push_back(command);
+		m_indirectGroups.back().commandCount++;
+	}
+
+	if (bGpuCulling == true)
+	{
+		m_pGpuCuller->SetBatches(cullBatches, (int)m_instanceData.size());
+	}
+
+	if (m_indirectCommands.size() == 0)
+	{
+		return;
+	}
+
+	m_indirectOffset = m_pIndirectCommands->Write(m_indirectCommands);
+	if (m_pIndirectCommands->GetBufferID() == 0)
+	{
+		std::cout << "Indirect drawing is not available, falling back to the instanced render path" << std::endl;
+		m_renderPath = RENDER_PATH_INSTANCED;
+	}
+}
+
+/***********************************************************
+ *  CullIndirectCommands()
+ *
+ *  This method is used for picking the command buffer that
+ *  the indirect draws of the current view read. With GPU
+ *  culling the cull pass writes its own copy of the commands
+ *  and the visible instances, which every pass of the view
+ *  draws.
+ ***********************************************************/
+void SceneManager::CullIndirectCommands(bool bOcclusionTest)
+{
+	m_drawCommandBuffer = m_pIndirectCommands->GetBufferID();
+	m_drawCommandOffset = m_indirectOffset;
+
+	if ((IsGpuCullingActive() == true) && (m_indirectCommands.size() > 0))
+	{
+		// the primary view is the one tested against the depth
+		// pyramid, and its visible instances are the ones counted
+		m_pGpuCuller->Cull(
+			m_frustum,
+			m_bFrustumCulling,
+			bOcclusionTest,
+			bOcclusionTest,
+			m_pInstancedMeshes->GetInstanceBufferID(),
+			m_drawCommandBuffer,
+			m_drawCommandOffset,
+			(int)m_indirectCommands.size());
+		m_drawCommandBuffer = m_pGpuCuller->GetCommandBufferID();
+		m_drawCommandOffset = 0;
+	}
+}
+
+/***********************************************************
+ *  DrawIndirectGroups()
+ *
+ *  This method is used for drawing the opaque or the
+ *  transparent instanced batches with one multi-draw-indirect
+ *  call per group, so the CPU cost of a frame depends on the
+ *  number of texture arrays instead of the number of batches.
+ ***********************************************************/
+void SceneManager::DrawIndirectGroups(bool bTransparent)
+{
+	m_pStateCache->SetBoolValue(m_uniforms.useInstancing, true);
+	m_pInstancedMeshes->BeginDraw();
+	for (int i = 0; i < m_indirectGroups.size(); i++)
+	{
+		const INDIRECT_GROUP& group = m_indirectGroups[i];
+		if (group.bTransparent != bTransparent)
+		{
+			continue;
+		}
+
+		if (group.textureUnit >= 0)
+		{
+			m_pStateCache->SetBoolValue(m_uniforms.useTexture, true);
+			m_pStateCache->SetSampler2DValue(m_uniforms.objectTexture, group.textureUnit);
+		}
+		else
+		{
+			m_pStateCache->SetBoolValue(m_uniforms.useTexture, false);
+		}
+
+		m_pInstancedMeshes->DrawIndirect(
+			m_drawCommandBuffer,
+			m_drawCommandOffset + group.firstCommand * sizeof(IndirectCommandBuffer::DRAW_COMMAND),
+			group.commandCount);
+		m_drawCallCount++;
+	}
+	m_pInstancedMeshes->EndDraw();
+	m_pStateCache->SetBoolValue(m_uniforms.useInstancing, false);
+}
+
+/***********************************************************
+ *  FinishIndirectFrame()
+ *
+ *  This method is used for fencing the commands once every
+ *  indirect draw of the frame has been issued, and with GPU
+ *  culling reducing the depth of the finished frame into the
+ *  pyramid that the next cull pass tests against.
+ ***********************************************************/
+void SceneManager::FinishIndirectFrame()
+{
+	// the commands may be rewritten once these draws are done
+	m_pIndirectCommands->FenceRegion();
+
+	if (IsGpuCullingActive() == true)
+	{
+		m_pGpuCuller->BuildDepthPyramid(m_projectionMatrix * m_viewMatrix);
+	}
+}
+
+/***********************************************************
+ *  IsGpuCullingActive()
+ *
+ *  This method is used for checking whether the indirect
+ *  draws of this frame are culled by the GPU.
+ ***********************************************************/
+bool SceneManager::IsGpuCullingActive() const
+{
+	return((m_bGpuCulling == true) &&
+		(m_renderPath == RENDER_PATH_INDIRECT) &&
+		(m_pGpuCuller->IsReady() == true));
+}
+
+/***********************************************************
+ *  GetVisibleItemCount()
+ *
+ *  This method is used for getting the number of render
+ *  items inside the view. When the GPU culls, the instanced
+ *  items are the ones its last finished pass kept for the
+ *  primary view, read back without waiting, and the baked
+ *  items are those of the static batches inside that view.
+ ***********************************************************/
+int SceneManager::GetVisibleItemCount() const
+{
+	if (IsGpuCullingActive() == false)
+	{
+		return(m_visibleItemCount);
+	}
+
+	int visibleCount = std::max(m_pGpuCuller->GetVisibleInstanceCount(), 0);
+	for (int i = 0; i < m_pStaticGeometry->GetBatchCount(); i++)
+	{
+		glm::vec3 boundsMin;
+		glm::vec3 boundsMax;
+		m_pStaticGeometry->GetBatchBounds(i, boundsMin, boundsMax);
+		if ((m_bFrustumCulling == false) || (m_viewFrustums.empty() == true) ||
+			(m_viewFrustums[0].IsBoxVisible(boundsMin, boundsMax) == true))
+		{
+			visibleCount += m_pStaticGeometry->GetBatchObjectCount(i);
+		}
+	}
+	return(visibleCount);
+}
+
+/***********************************************************
+ *  ApplyCullingMode()
+ *
+ *  This method is used for switching the indirect draws over
+ *  to the instances of the cull pass, or back to the uploaded
+ *  ones. The static batches are culled by chunk on the CPU
+ *  on either path, so they are kept as they are.
+ ***********************************************************/
+void SceneManager::ApplyCullingMode()
+{
+	if (IsGpuCullingActive() == true)
+	{
+		m_pInstancedMeshes->SetIndirectInstanceBuffer(m_pGpuCuller->GetInstanceBufferID());
+	}
+	else
+	{
+		m_pInstancedMeshes->SetIndirectInstanceBuffer(0);
+	}
+
+	m_bDrawOrderDirty = true;
+}
+
+/***********************************************************
+ *  BakeStaticGeometry()
+ *
+ *  This method is used for merging the static opaque render
+ *  items into static batches, one for each texture slot and
+ *  chunk of the floor, and marking them so the per-item paths
+ *  and the GPU cull pass skip them. Transparent items keep
+ *  the per-item path, as they have to be blended back to
+ *  front.
+ ***********************************************************/
+void SceneManager::BakeStaticGeometry()
+{
+	std::vector<StaticGeometry::STATIC_OBJECT> objects;
+
+	for (int i = 0; i < m_renderItems.size(); i++)
+	{
+		RENDER_ITEM& item = m_renderItems[i];
+		item.bBaked = (m_bStaticBatching == true) && (item.bStatic == true) && (item.bTransparent == false);
+		if (item.bBaked == false)
+		{
+			continue;
+		}
+
+		StaticGeometry::STATIC_OBJECT object;
+		object.mesh = item.mesh;
+		object.model = item.transform.GetModelMatrix();
+		object.color = item.color;
+		object.uvScale = item.uvScale;
+		object.materialIndex = item.materialIndex;
+		object.textureSlot = (item.bUseTexture == true) ? item.textureSlot : -1;
+		objects.push_back(object);
+	}
+
+	m_pStaticGeometry->Build(objects);
+	m_bStaticGeometryBaked = true;
+	m_bDrawOrderDirty = true;
+}
+
+/***********************************************************
+ *  DrawStaticBatches()
+ *
+ *  This method is used for drawing every static batch whose
+ *  box is inside the view frustum with one draw call each.
+ *  The batches go through the instancing path of the shader,
+ *  with their color and material read per vertex, and the
+ *  current unit and layer of their texture set per batch.
+ ***********************************************************/
+void SceneManager::DrawStaticBatches()
+{
+	if (m_pStaticGeometry->GetBatchCount() == 0)
+	{
+		return;
+	}
+
+	m_pStaticGeometry->BeginDraw();
+	m_pStateCache->SetBoolValue(m_uniforms.useInstancing, true);
+
+	for (int i = 0; i < m_pStaticGeometry->GetBatchCount(); i++)
+	{
+		glm::vec3 boundsMin;
+		glm::vec3 boundsMax;
+		m_pStaticGeometry->GetBatchBounds(i, boundsMin, boundsMax);
+		if ((m_bFrustumCulling == true) && (m_frustum.IsBoxVisible(boundsMin, boundsMax) == false))
+		{
+			continue;
+		}
+
+		int textureSlot = m_pStaticGeometry->GetBatchTextureSlot(i);
+		if (textureSlot >= 0)
+		{
+			m_pStateCache->SetBoolValue(m_uniforms.useTexture, true);
+			m_pStateCache->SetSampler2DValue(m_uniforms.objectTexture, m_pTextureManager->GetTextureUnit(textureSlot));
+			m_pStateCache->SetIntValue(m_uniforms.textureLayer, m_pTextureManager->GetTextureLayer(textureSlot));
+		}
+		else
+		{
+			m_pStateCache->SetBoolValue(m_uniforms.useTexture, false);
+		}
+
+		m_pStaticGeometry->DrawBatch(i);
+		m_drawCallCount++;
+	}
+
+	m_pStateCache->SetBoolValue(m_uniforms.useInstancing, false);
+	m_pStaticGeometry->EndDraw();
+}
+
+/***********************************************************
+ *  SetStaticBatching()
+ *
+ *  This method is used for turning the baking of the static
+ *  opaque items into merged batches on or off.
+ ***********************************************************/
+void SceneManager::SetStaticBatching(bool bEnabled)
+{
+	if (m_bStaticBatching != bEnabled)
+	{
+		m_bStaticBatching = bEnabled;
+		if (m_bStaticGeometryBaked == true)
+		{
+			BakeStaticGeometry();
+		}
+	}
+}
+
+/***********************************************************
+ *  SetRackCount()
+ *
+ *  This method is used for setting how many copies of the
+ *  dumbbell rack are recorded into the render list by the
+ *  next PrepareScene(), so the scene size can be scaled for
+ *  benchmarking.
+ ***********************************************************/
+void SceneManager::SetRackCount(int rackCount)
+{
+	m_rackCount = std::max(rackCount, 1);
+}
+
+/***********************************************************
+ *  SetCeilingLightCount()
+ *
+ *  This method is used for setting how many ceiling fixture
+ *  lights are added by the next PrepareScene(), so the light
+ *  count can be scaled for benchmarking.
+ ***********************************************************/
+void SceneManager::SetCeilingLightCount(int lightCount)
+{
+	m_ceilingLightCount = std::max(lightCount, 0);
+}
+
+/***********************************************************
+ *  ReplicateRenderItems()
+ *
+ *  This method is used for appending copies of a range of
+ *  the render list, each copy moved by the offset from the
+ *  one before it.
+ ***********************************************************/
+void SceneManager::ReplicateRenderItems(int firstItem, int itemCount, int copyCount, glm::vec3 offsetXYZ)
+{
+	if ((firstItem < 0) || (itemCount <= 0) || (firstItem + itemCount > m_renderItems.size()))
+	{
+		return;
+	}
+
+	m_renderItems.reserve(m_renderItems.size() + itemCount * std::max(copyCount, 0));
+	for (int copy = 1; copy <= copyCount; copy++)
+	{
+		for (int i = firstItem; i < firstItem + itemCount; i++)
+		{
+			RENDER_ITEM item = m_renderItems[i];
+			item.transform.SetPosition(item.transform.GetPosition() + offsetXYZ * (float)copy);
+			UpdateRenderItemBounds(item);
+			m_renderItems.push_back(item);
+		}
+	}
+	m_bDrawOrderDirty = true;
+	m_bShadowCastersDirty = true;
+}
+
+/***********************************************************
+ *  SetFrustumCulling()
+ *
+ *  This method is used for turning the skipping of render
+ *  items outside the view frustum on or off.
+ ***********************************************************/
+void SceneManager::SetFrustumCulling(bool bEnabled)
+{
+	if (m_bFrustumCulling != bEnabled)
+	{
+		m_bFrustumCulling = bEnabled;
+		m_bDrawOrderDirty = true;
+	}
+}
+
+/***********************************************************
+ *  SetTextureBudget()
+ *
+ *  This method is used for setting how many bytes of GPU
+ *  memory the scene textures may use. Textures over the
+ *  budget are evicted least recently used first, and loaded
+ *  again when they come back into view.
+ ***********************************************************/
+void SceneManager::SetTextureBudget(size_t bytes)
+{
+	m_pTextureStreamer->SetMemoryBudget(bytes);
+}
+
+/***********************************************************
+ *  SetRenderPath()
+ *
+ *  This method is used for selecting how the render list is
+ *  submitted to the GPU. The instanced and indirect paths are
+ *  only used when the instanced meshes could be loaded.
+ ***********************************************************/
+void SceneManager::SetRenderPath(RENDER_PATH renderPath)
+{
+	if ((renderPath != RENDER_PATH_DIRECT) &&
+		(m_pInstancedMeshes->IsLoaded() == false))
+	{
+		std::cout << "The instanced meshes are not loaded, keeping the direct render path" << std::endl;
+		return;
+	}
+
+	if (m_renderPath != renderPath)
+	{
+		m_renderPath = renderPath;
+		ApplyCullingMode();
+	}
+}
+
+/***********************************************************
+ *  SetGpuCulling()
+ *
+ *  This method is used for turning the culling of the
+ *  indirect draws on the GPU on or off. It only takes effect
+ *  on the indirect render path with compute shader support.
+ ***********************************************************/
+void SceneManager::SetGpuCulling(bool bEnabled)
+{
+	if (m_bGpuCulling != bEnabled)
+	{
+		m_bGpuCulling = bEnabled;
+		ApplyCullingMode();
+	}
+}
+
+/***********************************************************
+ *  ResetRenderValues()
+ *
+ *  This method is used for setting the render values of the
+ *  next recorded item back to their defaults.
+ ***********************************************************/
+void SceneManager::ResetRenderValues()
+{
+	m_currentItem.mesh = MESH_BOX;
+	m_currentItem.transform = SceneTransform();
+	m_currentItem.color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+	m_currentItem.uvScale = glm::vec2(1.0f, 1.0f);
+	m_currentItem.textureSlot = -1;
+	m_currentItem.materialIndex = -1;
+	m_currentItem.bUseTexture = false;
+	m_currentItem.bTransparent = false;
+	m_currentItem.bVisible = true;
+	// nothing in the scene moves yet
+	m_currentItem.bStatic = true;
+	m_currentItem.bBaked = false;
+	m_currentItem.lodLevel = 0;
+}
+
+/***********************************************************
+ *  BuildSceneFileItems()
+ *
+ *  This method is used for recording the objects of the
+ *  opened scene file into the render list, reading them
+ *  straight from the file's records. The tags are resolved
+ *  once per texture and material of the file, and the list
+ *  is sized for every object and rack copy up front, so
+ *  recording an object costs no lookup or allocation.
+ ***********************************************************/
+void SceneManager::BuildSceneFileItems(const SceneFile& sceneFile)
+{
+	m_renderItems.clear();
+	ResetRenderValues();
+
+	std::vector<int> textureSlots(sceneFile.GetTextureCount());
+	const SceneFile::SCENE_TEXTURE* pTextures = sceneFile.GetTextures();
+	for (int i = 0; i < sceneFile.GetTextureCount(); i++)
+	{
+		textureSlots[i] = FindTextureSlot(sceneFile.GetString(pTextures[i].tag));
+	}
+	std::vector<int> materialIndices(sceneFile.GetMaterialCount());
+	const SceneFile::SCENE_MATERIAL* pMaterials = sceneFile.GetMaterials();
+	for (int i = 0; i < sceneFile.GetMaterialCount(); i++)
+	{
+		materialIndices[i] = FindMaterialIndex(sceneFile.GetString(pMaterials[i].tag));
+	}
+
+	const SceneFile::SCENE_RACK* pRacks = sceneFile.GetRacks();
+	size_t itemCount = sceneFile.GetObjectCount();
+	for (int i = 0; i < sceneFile.GetRackCount(); i++)
+	{
+		itemCount += (size_t)pRacks[i].objectCount * (m_rackCount - 1);
+	}
+	m_renderItems.reserve(itemCount);
+
+	const SceneFile::SCENE_OBJECT* pObjects = sceneFile.GetObjects();
+	for (int i = 0; i < sceneFile.GetObjectCount(); i++)
+	{
+		const SceneFile::SCENE_OBJECT& object = pObjects[i];
+		SetTransformations(
+			object.scale,
+			object.rotationDegrees.x,
+			object.rotationDegrees.y,
+			object.rotationDegrees.z,
+			object.position);
+		m_currentItem.color = object.color;
+		m_currentItem.uvScale = object.uvScale;
+		m_currentItem.textureSlot = (object.texture != SceneFile::NO_INDEX) ? textureSlots[object.texture] : -1;
+		m_currentItem.bUseTexture = (m_currentItem.textureSlot >= 0);
+		m_currentItem.materialIndex = (object.material != SceneFile::NO_INDEX) ? materialIndices[object.material] : -1;
+		m_currentItem.bStatic = ((object.flags & SceneFile::OBJECT_MOVING) == 0);
+		AddRenderItem((MESH_TYPE)object.mesh);
+	}
+
+	// stack the extra copies of every rack above it
+	for (int i = 0; i < sceneFile.GetRackCount(); i++)
+	{
+		ReplicateRenderItems(
+			(int)pRacks[i].firstObject,
+			(int)pRacks[i].objectCount,
+			m_rackCount - 1,
+			pRacks[i].offset);
+	}
+
+	// keep the records, so a reload can tell whether the
+	// objects changed
+	m_sceneFileObjects.assign(pObjects, pObjects + sceneFile.GetObjectCount());
+	m_sceneFileRacks.assign(pRacks, pRacks + sceneFile.GetRackCount());
+}
+
+/***********************************************************
+ *  ReloadSceneFile()
+ *
+ *  This method is used for reading the scene file again
+ *  after it has been edited and updating only what changed.
+ *  Textures that are already loaded stay resident and the
+ *  new ones are queued, a changed material only rewrites
+ *  its own entry of the material table, and a changed light
+ *  only its own light. The render list is only recorded
+ *  again when the objects, or the textures and materials
+ *  they refer to by index, have changed. A file that can't
+ *  be read, or that needs more materials than the material
+ *  block holds, keeps the current scene.
+ ***********************************************************/
+bool SceneManager::ReloadSceneFile()
+{
+	if (m_sceneFilename.empty() == true)
+	{
+		return(false);
+	}
+
+	SceneFile sceneFile;
+	if (sceneFile.Open(m_sceneFilename) == false)
+	{
+		std::cout << "Keeping the current scene" << std::endl;
+		return(false);
+	}
+
+	// a file with more materials than the block holds is
+	// turned down before anything changes, the same as at
+	// startup
+	if (HasRoomForMaterials(sceneFile) == false)
+	{
+		std::cout << "Keeping the current scene" << std::endl;
+		return(false);
+	}
+	m_bRedrawNeeded = true;
+
+	std::vector<std::string> previousTextureTags = m_sceneFileTextureTags;
+	LoadSceneFileTextures(sceneFile);
+	bool bItemsDirty = (previousTextureTags != m_sceneFileTextureTags);
+
+	// the materials are found by tag, new ones are added at
+	// the end of the table
+	const SceneFile::SCENE_MATERIAL* pMaterials = sceneFile.GetMaterials();
+	int changedMaterialCount = 0;
+	std::vector<std::string> materialTags(sceneFile.GetMaterialCount());
+	for (int i = 0; i < sceneFile.GetMaterialCount(); i++)
+	{
+		OBJECT_MATERIAL material = ReadSceneFileMaterial(sceneFile, pMaterials[i]);
+		materialTags[i] = material.tag;
+		// the first material of a tag is the one it stands for
+		if (std::find(materialTags.begin(), materialTags.begin() + i, material.tag) != materialTags.begin() + i)
+		{
+			continue;
+		}
+
+		int materialIndex = FindMaterialIndex(material.tag);
+		if (materialIndex < 0)
+		{
+			m_objectMaterials.push_back(material);
+			materialIndex = m_materialTags.Register(material.tag);
+		}
+		else if (IsSameMaterial(m_objectMaterials[materialIndex], material) == true)
+		{
+			continue;
+		}
+		else
+		{
+			// the transparent items are drawn in their own pass
+			if (m_objectMaterials[materialIndex].bTransparent != material.bTransparent)
+			{
+				bItemsDirty = true;
+			}
+			m_objectMaterials[materialIndex] = material;
+		}
+		UploadObjectMaterial(materialIndex);
+		changedMaterialCount++;
+	}
+	if (materialTags != m_sceneFileMaterialTags)
+	{
+		m_sceneFileMaterialTags.swap(materialTags);
+		bItemsDirty = true;
+	}
+
+	// with the same number of lights only the changed ones are
+	// updated, otherwise the ceiling fixtures after them move
+	// and every light is added again
+	int changedLightCount = 0;
+	const SceneFile::SCENE_LIGHT* pLights = sceneFile.GetLights();
+	if ((sceneFile.GetLightCount() == m_sceneFileLightCount) &&
+		(m_sceneFileLightCount <= m_lightSources.size()))
+	{
+		for (int i = 0; i < sceneFile.GetLightCount(); i++)
+		{
+			LIGHT_SOURCE light = ReadSceneFileLight(pLights[i]);
+			if (IsSameLight(m_lightSources[i], light) == false)
+			{
+				SetLightSource(i, light);
+				changedLightCount++;
+			}
+		}
+	}
+	else
+	{
+		ClearLightSources();
+		SetupSceneFileLights(sceneFile);
+		AddCeilingLights();
+		changedLightCount = sceneFile.GetLightCount();
+	}
+
+	if ((sceneFile.GetObjectCount() != m_sceneFileObjects.size()) ||
+		(sceneFile.GetRackCount() != m_sceneFileRacks.size()) ||
+		((m_sceneFileObjects.empty() == false) &&
+			(memcmp(sceneFile.GetObjects(), &m_sceneFileObjects[0], m_sceneFileObjects.size() * sizeof(SceneFile::SCENE_OBJECT)) != 0)) ||
+		((m_sceneFileRacks.empty() == false) &&
+			(memcmp(sceneFile.GetRacks(), &m_sceneFileRacks[0], m_sceneFileRacks.size() * sizeof(SceneFile::SCENE_RACK)) != 0)))
+	{
+		bItemsDirty = true;
+	}
+	if (bItemsDirty == true)
+	{
+		BuildSceneFileItems(sceneFile);
+		BakeStaticGeometry();
+	}
+
+	std::cout << "Reloaded " << m_sceneFilename << ": " << changedMaterialCount << " materials and "
+		<< changedLightCount << " lights changed, objects " << ((bItemsDirty == true) ? "recorded again" : "kept") << std::endl;
+
+	return(true);
+}
+
+/***********************************************************
+ *  RefreshShaderProgram()
+ *
+ *  This method is used for picking up a shader program that
+ *  has been rebuilt from its sources. The uniform locations
+ *  and the values sent to the old program no longer apply,
+ *  and the uniform blocks have to be attached to the new
+ *  program. The textures, meshes and buffers are kept.
+ ***********************************************************/
+void SceneManager::RefreshShaderProgram()
+{
+	if (NULL == m_pShaderManager)
+	{
+		return;
+	}
+
+	m_pStateCache->Reset();
+	m_pLightBlock->AttachToProgram(m_pShaderManager->m_programID, "LightBlock");
+	m_pMaterialBlock->AttachToProgram(m_pShaderManager->m_programID, "MaterialBlock");
+	m_pShaderManager->setBoolValue(g_UseLightingName, (m_lightSources.size() > 0));
+	m_bRedrawNeeded = true;
+}
+
+/***********************************************************
+ *  NeedsRedraw()
+ *
+ *  This method is used for checking whether the next frame
+ *  would differ from the last one. Textures that are still
+ *  loading count as a change, as they replace their
+ *  placeholders or sharper mip levels arrive in later frames.
+ ***********************************************************/
+bool SceneManager::NeedsRedraw() const
+{
+	return((m_bRedrawNeeded == true) || (m_pTextureManager->GetPendingCount() > 0));
+}
+
+/***********************************************************
+ *  BuildRenderItems()
+ *
+ *  This method is used for recording the transformations,
+ *  colors, textures and materials of every basic 3D shape
+ *  in the scene into the render list
+ ***********************************************************/
+void SceneManager::BuildRenderItems()
+{
+	// start from the default render values
+	m_renderItems.clear();
+	ResetRenderValues();
+
+	// declare the variables for the transformations
+	glm::vec3 scaleXYZ;
+	float XrotationDegrees = 0.0f;
+	float YrotationDegrees = 0.0f;
+	float ZrotationDegrees = 0.0f;
+	glm::vec3 positionXYZ;
+	SetTextureUVScale(2.0f, 2.0f);
+
+	/*** Set needed transformations before drawing the basic mesh.  ***/
+	/*** This same ordering of code should be used for transforming ***/
+	/*** and drawing all the basic 3D shapes.						***/
+	/******************************************************************/
+
+	//Floors, walls, and ceilings
+
+	//Ceiling
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(14.0f, 1.0f, 10.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(0.0f, 15.0f, 0.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0, 1, 1, 1);
+	SetShaderTexture("wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+	//Tilted Ceiling
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(14.0f, 1.0f, 6.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = -60.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(0.0f, 15.0f, -6.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0, 1, 0.5, 1);
+	SetShaderTexture("wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+	//Floor
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(14.0f, 1.0f, 10.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(0.0f, 0.0f, 0.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 1, 1, 1);
+	SetShaderTexture("floor");
+	SetShaderMaterial("whiteHardwoodFloor");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+
+	//Wall #1
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(8.0f, 0.0f, 14.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(0.0f, 7.5f, -10.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 1, 1, 1);
+	SetShaderTexture("wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+
+	//Wall #2
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(8.0f, 0.0f, 8.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-13.0f, 7.5f, -4.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 1, 1, 1);
+	SetShaderTexture("wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+
+//This is the little space between the 2 doors and wall
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(1.0f, 0.0f, 8.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-14.0f, 7.5f, 4.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 1, 1, 1);
+	SetShaderTexture("wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+	//Wall #3
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(8.0f, 0.0f, 8.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(13.0f, 7.5f, -4.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 1, 1, 1);
+	SetShaderTexture("wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+	//Slanted part of right wall
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(8.0f, 0.0f, 8.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = -50.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(13.0f, 7.5f, -1.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 1, 1, 1);
+	SetShaderTexture("wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+
+	//Wall #4
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(2.6f, 0.0f, 8.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(7.86f, 7.5f, 7.4f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 1, 1, 1);
+	SetShaderTexture("wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+
+	/********************************************
+	*****************Window**********************
+	*********************************************
+	*********************************************/
+
+	//Window Pane
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(4.0f, 0.0f, 4.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.99f, 7.5f, -2.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 0, 1, 1);
+	SetShaderTexture("window");
+	SetShaderMaterial("Window");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+
+
+	//Window Frame Bottom
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.2f, 0.2f, 8.2f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.8f, 3.5f, -2.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 0, 1, 1);
+	SetShaderTexture("window_wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	//Window Frame Top
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.2f, 0.2f, 8.2f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.8f, 11.5f, -2.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 0, 1, 1);
+	SetShaderTexture("window_wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	//Window Frame Middle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.2f, 0.2f, 8.2f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.8f, 7.5f, -2.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 0, 1, 1);
+	SetShaderTexture("window_wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	//Window Frame Left
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.2f, 0.2f, 8.2f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.8f, 7.5f, 2.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 0, 1, 1);
+	SetShaderTexture("window_wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	//Window Frame Right
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.2f, 0.2f, 8.2f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.8f, 7.5f, -6.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 0, 1, 1);
+	SetShaderTexture("window_wall");
+	SetShaderMaterial("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	/*******************************************
+	********************************************
+	********************************************/
+
+	//Closet Doors
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(6.0f, 0.0f, 6.5f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-14.0f, 6.5f, 4.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 1, 0, 1);
+	SetShaderTexture("double_doors");
+	SetShaderMaterial("whiteDoor");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+	//Small bit of wall above closet doors
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(6.0f, 0.0f, 2.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-14.0f, 14.8f, 4.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 1, 1, 1);
+	SetShaderTexture("wall");
+	SetShaderTexture("whiteWall");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+
+	//weight mats #1
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(1.2f, 1.0f, 2.8f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.7f, 0.1f, 7.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 0.4, 1, 1);
+	SetShaderTexture("weight_mats");
+	SetShaderMaterial("floorMat");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+
+
+	//weight mats #2
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(2.2f, 1.0f, 4.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.0f, 0.1f, -0.4f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 0.4, 1, 1);
+	SetShaderTexture("weight_mats");
+	SetShaderMaterial("floorMat");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+
+
+	//weight mats #3
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(2.2f, 1.0f, 10.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(2.0f, 0.1f, -7.6f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 0.4, 1, 1);
+	SetShaderTexture("weight_mats");
+	SetShaderMaterial("floorMat");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+	/****************************************************************/
+	/*** Set needed transformations before drawing the basic mesh.  ***/
+	/*** This same ordering of code should be used for transforming ***/
+	/*** and drawing all the basic 3D shapes.						***/
+	/******************************************************************/
+
+
+	/*******************************************************************/
+	/*This is for the kickboxing stand*/
+	/*******************************************************************/
+	//Base
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(2.0f, 2.0f, 1.5f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.0f, 0.0f, -7.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	//SetShaderColor(1, 0, 1, 1);
+	SetShaderTexture("kickstand");
+	SetShaderMaterial("KickStand");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_TAPERED_CYLINDER);
+
+	
+	
+	//Cone
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.8f, 2.0f, 0.5f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.0f, 1.6f, -7.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(1, 0, 0, 1);
+	SetShaderTexture("kickstand");
+	SetShaderMaterial("KickStand");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CONE);
+
+	
+	
+	//Cyllander for kickbox stand
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(1.0f, 5.0f, 1.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.0f, 2.6f, -7.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	//SetShaderColor(0, 1, 0, 1);
+	SetShaderTexture("kickbag");
+	SetShaderMaterial("redKick");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	/**********************************************
+	***********************************************
+	* This part is for one off things like the TV
+	* And mirrors
+	***********************************************/
+
+	//Mirror #1
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(7.0f, 1.0f, 4.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-1.0f, 5.0f, -9.8f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0, 1, 1, 1);
+	SetShaderTexture("window");
+	SetShaderMaterial("glassMirror");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+	//Mirror #2
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(3.2f, 1.0f, 4.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(12.9f, 5.0f, -4.6f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0, 1, 1, 1);
+	SetShaderTexture("window");
+	SetShaderMaterial("glassMirror");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_PLANE);
+
+
+	//TV
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(5.0f, 3.3f, 0.2f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 10.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-10.6f, 8.5f, -8.5f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("tv");
+	SetShaderMaterial("blackTVScreen");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	//Wall Mat
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(2.5f, 10.0f, 0.2f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(7.8f, 6.0f, 7.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("wall_mat");
+	SetShaderMaterial("floorMat");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	/*************************************
+	* ************Corner Weights**********
+	* ************************************
+	* ************************************
+	* */
+	//Biggest Weight
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(1.0f, 1.0f, 1.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(11.0f, 0.2f, -6.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.7, 0.7, 0.7, 1);
+	SetShaderTexture("dumbell_steel_white");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_TORUS);
+
+
+	//Middle Weight
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.8f, 0.8f, 1.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(11.0f, 0.4f, -6.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.5, 0.5, 0.5, 1);
+	SetShaderTexture("dumbell_steel_white");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_TORUS);
+
+
+	//Smallest Weight
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.6f, 0.6f, 1.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(11.0f, 0.6f, -6.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.3, 0.3, 0.3, 1);
+	SetShaderTexture("dumbell_steel_white");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_TORUS);
+
+
+	//Middle part of Smallest Weight
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.3f, 1.0f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(11.0f, 0.6f, -6.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.3, 0.3, 0.3, 1);
+	SetShaderTexture("dumbell_steel_white");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_TORUS);
+
+
+
+	/*************************************
+	***************Kettlebells************************
+	**************************************
+	**************************************/
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.4f, 0.5f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.0f, 1.0f, -0.7f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_TORUS);
+
+
+	//Weight
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.5f, 0.5f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.0f, 0.4f, -0.7f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("kettlebell_blue");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_SPHERE);
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.4f, 0.5f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.0f, 1.0f, -2.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_TORUS);
+
+
+	//Weight
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.5f, 0.5f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.0f, 0.4f, -2.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("kettlebell_blue");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_SPHERE);
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.4f, 0.5f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.0f, 1.0f, -3.3f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_TORUS);
+
+
+	//Weight
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.5f, 0.5f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.0f, 0.4f, -3.3f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("kettlebell_blue");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_SPHERE);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.4f, 0.5f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.0f, 1.0f, -4.5f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_TORUS);
+
+
+	//Weight
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.5f, 0.5f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.0f, 0.4f, -4.5f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("kettlebell_blue");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_SPHERE);
+
+	// the dumbbell rack is everything recorded from here on,
+	// which can be replicated to scale the scene size
+	int rackFirstItem = (int)m_renderItems.size();
+
+	/*************************************
+	***************Dumbells************************
+	**************************************
+	**************************************/
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.3f, 0.4f, 7.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.3f, 0.4f, 7.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-13.3f, 0.4f, 7.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.3f, 0.4f, 7.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-13.3f, 0.4f, 7.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+	
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.3f, 0.4f, 9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.3f, 0.4f, 9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-13.3f, 0.4f, 9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.3f, 0.4f, 8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.3f, 0.4f, 8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-13.3f, 0.4f, 8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.3f, 0.4f, 6.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.3f, 0.4f, 6.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-13.3f, 0.4f, 6.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.3f, 0.4f, 3.8f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_orange");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.3f, 0.4f, 3.8f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_orange");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.2f, 0.4f, 3.8f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_orange");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.3f, 0.4f, 3.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_orange");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.3f, 0.4f, 3.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_orange");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.2f, 0.4f, 3.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_orange");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.3f, 0.4f, 2.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_pink");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.3f, 0.4f, 2.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_pink");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.2f, 0.4f, 2.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_pink");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.08f, 0.8f, 0.06f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 90.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.3f, 0.4f, 1.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_grey");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-11.3f, 0.4f, 1.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_grey");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.3f, 0.4f, 0.4f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 0.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-12.2f, 0.4f, 1.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_grey");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-6.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-6.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-6.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-5.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-5.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-5.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-4.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-4.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-4.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-3.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-3.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-3.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-2.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-2.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-2.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-1.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-1.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-1.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-0.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-0.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(-0.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(1.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(1.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(1.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(2.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(2.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(2.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(3.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(3.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(3.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(4.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(4.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(4.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(5.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(5.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(5.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(6.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(6.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(6.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_steel");
+	SetShaderMaterial("darkMetallicDumbbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(7.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_orange");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(7.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_orange");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(7.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_orange");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+
+	//Handle
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.12f, 1.0f, 0.08f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 90.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(8.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_orange");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_CYLINDER);
+
+	//Weights
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(8.3f, 0.4f, -9.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_orange");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+
+	// set the XYZ scale for the mesh
+	scaleXYZ = glm::vec3(0.5f, 0.6f, 0.6f);
+
+	// set the XYZ rotation for the mesh
+	XrotationDegrees = 0.0f;
+	YrotationDegrees = 90.0f;
+	ZrotationDegrees = 0.0f;
+
+	// set the XYZ position for the mesh
+	positionXYZ = glm::vec3(8.3f, 0.4f, -8.0f);
+
+	// set the transformations into memory to be used on the drawn meshes
+	SetTransformations(
+		scaleXYZ,
+		XrotationDegrees,
+		YrotationDegrees,
+		ZrotationDegrees,
+		positionXYZ);
+
+	SetShaderColor(0.2, 0.2, 0.2, 1);
+	SetShaderTexture("dumbell_orange");
+	SetShaderMaterial("rubberDumbell");
+
+	// record the mesh with the transformation values
+	AddRenderItem(MESH_BOX);
+
+	// stack the extra copies of the rack as tiers above it
+	ReplicateRenderItems(
+		rackFirstItem,
+		(int)m_renderItems.size() - rackFirstItem,
+		m_rackCount - 1,
+		glm::vec3(0.0f, g_RackTierSpacing, 0.0f));
+}
@@ -1,113 +1,593 @@
-///////////////////////////////////////////////////////////////////////////////
-// shadermanager.h
-// ============
-// manage the loading and rendering of 3D scenes
-//
-//  AUTHOR: Brian Battersby - SNHU Instructor / Computer Science
-//	Created for CS-330-Computational Graphics and Visualization, Nov. 1st, 2023
-///////////////////////////////////////////////////////////////////////////////
-
-#pragma once
-
-#include "ShaderManager.h"
-#include "ShapeMeshes.h"
-
-#include <string>
-#include <vector>
-
-/***********************************************************
- *  SceneManager
- *
- *  This class contains the code for preparing and rendering
- *  3D scenes, including the shader settings.
- ***********************************************************/
-class SceneManager
-{
-public:
-	// constructor
-	SceneManager(ShaderManager* pShaderManager);
-	// destructor
-	~SceneManager();
-
-	struct TEXTURE_INFO
-	{
-		std::string tag;
-		uint32_t ID;
-	};
-
-	struct OBJECT_MATERIAL
-	{
-		float ambientStrength;
-		glm::vec3 ambientColor;
-		glm::vec3 diffuseColor;
-		glm::vec3 specularColor;
-		float shininess;
-		std::string tag;
-	};
-
-private:
-	// pointer to shader manager object
-	ShaderManager* m_pShaderManager;
-	// pointer to basic shapes object
-	ShapeMeshes* m_basicMeshes;
-	// total number of loaded textures
-	int m_loadedTextures;
-	// loaded textures info
-	TEXTURE_INFO m_textureIDs[16];
-	// defined object materials
-	std::vector<OBJECT_MATERIAL> m_objectMaterials;
-
-	// load texture images and convert to OpenGL texture data
-	bool CreateGLTexture(const char* filename, std::string tag);
-	// bind loaded OpenGL textures to slots in memory
-	void BindGLTextures();
-	// free the loaded OpenGL textures
-	void DestroyGLTextures();
-	// find a loaded texture by tag
-	int FindTextureID(std::string tag);
-	int FindTextureSlot(std::string tag);
-	// find a defined material by tag
-	bool FindMaterial(std::string tag, OBJECT_MATERIAL& material);
-
-	// set the transformation values 
-	// into the transform buffer
-	void SetTransformations(
-		glm::vec3 scaleXYZ,
-		float XrotationDegrees,
-		float YrotationDegrees,
-		float ZrotationDegrees,
-		glm::vec3 positionXYZ);
-
-	// set the color values into the shader
-	void SetShaderColor(
-		float redColorValue,
-		float greenColorValue,
-		float blueColorValue,
-		float alphaValue);
-
-	// set the texture data into the shader
-	void SetShaderTexture(
-		std::string textureTag);
-
-	// set the UV scale for the texture mapping
-	void SetTextureUVScale(
-		float u, float v);
-
-	// set the object material into the shader
-	void SetShaderMaterial(
-		std::string materialTag);
-
-public:
-
-	// The following methods are for the students to 
-	// customize for their own 3D scene
-	void PrepareScene();
-	void RenderScene();
-	// loads textures from image files
-	void LoadSceneTextures();
-
-	// pre-set light sources for 3D scene
-	void SetupSceneLights();
-	// pre-define the object materials for lighting
-	void DefineObjectMaterials();
+///////////////////////////////////////////////////////////////////////////////
+// shadermanager.h
+// ============
+// manage the loading and rendering of 3D scenes
+//
+//  AUTHOR: Brian Battersby - SNHU Instructor / Computer Science
+//	Created for CS-330-Computational Graphics and Visualization, Nov. 1st, 2023
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Frustum.h"
+#include "GpuCuller.h"
+#include "IndirectCommandBuffer.h"
+#include "InstancedMeshes.h"
+#include "JobSystem.h"
+#include "LightClusters.h"
+#include "ShaderManager.h"
+#include "ShaderStateCache.h"
+#include "ShadowMaps.h"
+#include "ShapeMeshes.h"
+#include "StaticGeometry.h"
+#include "SceneFile.h"
+#include "SceneTransform.h"
+#include "TagRegistry.h"
+#include "TextureManager.h"
+#include "TextureStreamer.h"
+#include "UniformBlock.h"
+
+#include <string>
+#include <vector>
+
+/***********************************************************
+ *  SceneManager
+ *
+ *  This class contains the code for preparing and rendering
+ *  3D scenes, including the shader settings.
+ ***********************************************************/
+class SceneManager
+{
+public:
+	// constructor
+	SceneManager(ShaderManager* pShaderManager);
+	// destructor
+	~SceneManager();
+
+	struct OBJECT_MATERIAL
+	{
+		float ambientStrength;
+		glm::vec3 ambientColor;
+		glm::vec3 diffuseColor;
+		glm::vec3 specularColor;
+		float shininess;
+		std::string tag;
+		// drawn back to front after all the opaque objects
+		bool bTransparent = false;
+	};
+
+	// view values of one camera of the frame, and the part of
+	// the window it is drawn into - a viewport width of 0
+	// draws into the viewport that is already set
+	struct SCENE_VIEW
+	{
+		glm::mat4 view;
+		glm::mat4 projection;
+		glm::vec3 viewPosition;
+		int viewportX;
+		int viewportY;
+		int viewportWidth;
+		int viewportHeight;
+	};
+
+	// values of one light source of the 3D scene
+	struct LIGHT_SOURCE
+	{
+		glm::vec3 position;
+		glm::vec3 ambientColor;
+		glm::vec3 diffuseColor;
+		glm::vec3 specularColor;
+		float focalStrength;
+		float specularIntensity;
+		// distance the light fades out at, 0 for a light that
+		// reaches the whole scene
+		float range;
+	};
+
+	// ways of submitting the render list to the GPU
+	enum RENDER_PATH
+	{
+		// one draw call per render item
+		RENDER_PATH_DIRECT = 0,
+		// one instanced draw call per batch of render items
+		// that share the same mesh and texture array
+		RENDER_PATH_INSTANCED,
+		// one multi-draw-indirect call per texture array, with
+		// a command for every instanced batch
+		RENDER_PATH_INDIRECT
+	};
+
+	// everything needed to submit one object of the 3D scene
+	struct RENDER_ITEM
+	{
+		MESH_TYPE mesh;
+		SceneTransform transform;
+		glm::vec4 color;
+		glm::vec2 uvScale;
+		int textureSlot;
+		int materialIndex;
+		bool bUseTexture;
+		bool bTransparent;
+		// world space bounds of the transformed mesh
+		glm::vec3 boundsMin;
+		glm::vec3 boundsMax;
+		glm::vec3 boundsCenter;
+		float boundsRadius;
+		// true when the item passed the last culling pass
+		bool bVisible;
+		// the item never moves, so it can be baked
+		bool bStatic;
+		// the item is drawn as part of a static batch
+		bool bBaked;
+		// tessellation level the item is drawn with
+		int lodLevel;
+	};
+
+	// position of a render item in the sorted draw order
+	struct DRAW_ORDER_ENTRY
+	{
+		uint64_t sortKey;
+		int itemIndex;
+	};
+
+	// run of render items in the draw order that share the
+	// same shader state and are drawn with one instanced call
+	struct INSTANCE_BATCH
+	{
+		int firstItem;
+		int itemCount;
+	};
+
+	// run of indirect commands drawn with one multi-draw call,
+	// as the texture array has to be the same for all of them
+	struct INDIRECT_GROUP
+	{
+		int firstCommand;
+		int commandCount;
+		// texture unit of the batches, or -1 when untextured
+		int textureUnit;
+		bool bTransparent;
+	};
+
+	// IDs of the shader uniforms that are set for every draw
+	struct SHADER_UNIFORMS
+	{
+		int model;
+		int objectColor;
+		int objectTexture;
+		int textureLayer;
+		int useTexture;
+		int UVscale;
+		int materialIndex;
+		int useInstancing;
+		// set once per pass
+		int depthOnly;
+		int useShadows;
+		int shadowMaps;
+		int shadowLightCount;
+		int shadowDepthRange;
+		int useClusters;
+		int clusterViewport;
+		int clusterSliceScaleBias;
+	};
+
+	// get the redundant uniform update filter
+	const ShaderStateCache* GetShaderStateCache() const { return(m_pStateCache); }
+	// get the number of draw calls issued by the last RenderScene()
+	int GetDrawCallCount() const { return(m_drawCallCount); }
+	// get the number of render items inside and outside the view
+	// frustum at the last culling pass - with GPU culling the
+	// count of its pass arrives a frame or two late
+	int GetVisibleItemCount() const;
+	int GetCulledItemCount() const { return((int)m_renderItems.size() - GetVisibleItemCount()); }
+	// get the number of uniform updates sent by the last RenderScene()
+	unsigned int GetUniformUploadCount() const { return(m_pStateCache->GetIssuedCount()); }
+	// get the number of texture sampler switches in the last RenderScene()
+	unsigned int GetTextureBindCount() const { return(m_pStateCache->GetIssuedCount(m_uniforms.objectTexture)); }
+
+private:
+	// pointer to shader manager object
+	ShaderManager* m_pShaderManager;
+	// filter for skipping redundant uniform updates
+	ShaderStateCache* m_pStateCache;
+	// registered IDs of the per draw uniforms
+	SHADER_UNIFORMS m_uniforms;
+	// uniform buffer holding the light sources
+	UniformBlock* m_pLightBlock;
+	// uniform buffer holding the object material table
+	UniformBlock* m_pMaterialBlock;
+	// light sources of the 3D scene, in light block order
+	std::vector<LIGHT_SOURCE> m_lightSources;
+	// pointer to basic shapes object
+	ShapeMeshes* m_basicMeshes;
+	// pointer to the instanced basic shapes object
+	InstancedMeshes* m_pInstancedMeshes;
+	// how the render list is submitted to the GPU
+	RENDER_PATH m_renderPath;
+	// persistently mapped commands of the indirect path
+	IndirectCommandBuffer* m_pIndirectCommands;
+	// one command per instanced batch, grouped by texture unit
+	std::vector<IndirectCommandBuffer::DRAW_COMMAND> m_indirectCommands;
+	std::vector<INDIRECT_GROUP> m_indirectGroups;
+	// byte offset of the current commands in the buffer
+	size_t m_indirectOffset;
+	// compute pass culling the indirect draws on the GPU
+	GpuCuller* m_pGpuCuller;
+	// true when the GPU culls the indirect draws if it can
+	bool m_bGpuCulling;
+	// worker threads splitting the stages of the draw list
+	JobSystem* m_pJobSystem;
+	// worker threads to start, or -1 for one per spare core
+	int m_workerThreadCount;
+	// draw order entries collected by each thread
+	std::vector<std::vector<DRAW_ORDER_ENTRY>> m_threadDrawOrders;
+	// true when only the transparent items need sorting again,
+	// as the GPU culls the rest for the new view
+	bool m_bTransparentOrderDirty;
+	// true when a view has moved while the GPU culls, so the
+	// texture demand is worked out again without a full cull
+	bool m_bTextureDemandDirty;
+	// every light source and the lights of each view cluster
+	LightClusters* m_pLightClusters;
+	// true when the lit passes use the clusters if they can
+	bool m_bClusteredLighting;
+	// number of ceiling fixture lights added to the scene
+	int m_ceilingLightCount;
+	// depth cube maps of the shadow casting lights
+	ShadowMaps* m_pShadowMaps;
+	// the static opaque items merged without textures, drawn
+	// into the static shadow maps
+	StaticGeometry* m_pShadowCasters;
+	// opaque items that move, drawn into the maps every frame
+	std::vector<int> m_movingCasters;
+	// true when the lights cast shadows
+	bool m_bShadows;
+	// true when the moving items cast shadows too, which
+	// needs a second set of maps as large as the static ones
+	bool m_bMovingShadows;
+	// true when the static shadow casters have to be merged
+	// again, or the static maps drawn again
+	bool m_bShadowCastersDirty;
+	bool m_bShadowMapsDirty;
+	// number of times the static shadow maps were drawn
+	int m_shadowMapRenderCount;
+	// true when the opaque items are drawn depth only first
+	bool m_bDepthPrepass;
+	// buffer and byte offset the indirect draws of this frame
+	// read their commands from
+	GLuint m_drawCommandBuffer;
+	size_t m_drawCommandOffset;
+	// merged buffers of the static opaque items
+	StaticGeometry* m_pStaticGeometry;
+	// true when static items are baked into batches
+	bool m_bStaticBatching;
+	bool m_bStaticGeometryBaked;
+	// background loader and owner of the scene textures
+	TextureManager* m_pTextureManager;
+	// keeper of the texture memory budget
+	TextureStreamer* m_pTextureStreamer;
+	// first mip level each texture slot needs for the visible
+	// items, or -1 when no visible item uses it
+	std::vector<int> m_textureDemand;
+	// defined object materials
+	std::vector<OBJECT_MATERIAL> m_objectMaterials;
+	// material tags resolved to material handles
+	TagRegistry m_materialTags;
+	// retained list of scene objects, filled once in PrepareScene()
+	std::vector<RENDER_ITEM> m_renderItems;
+	// render values collected for the next recorded item
+	RENDER_ITEM m_currentItem;
+	// render items sorted by shader state, opaque items first
+	std::vector<DRAW_ORDER_ENTRY> m_drawOrder;
+	// number of opaque items at the start of the draw order
+	int m_opaqueItemCount;
+	// true when the draw order needs to be sorted again
+	bool m_bDrawOrderDirty;
+	// true when something shown has changed since the last
+	// RenderScene()
+	bool m_bRedrawNeeded;
+	// per-instance values of the render items, in draw order
+	std::vector<InstancedMeshes::INSTANCE_DATA> m_instanceData;
+	// batches of the draw order, opaque batches first
+	std::vector<INSTANCE_BATCH> m_instanceBatches;
+	// number of opaque batches at the start of the batch list
+	int m_opaqueBatchCount;
+	// number of draw calls issued by the last rendered frame
+	int m_drawCallCount;
+	// number of copies of the dumbbell rack in the scene
+	int m_rackCount;
+	// clip planes of the view being rendered
+	Frustum m_frustum;
+	// true when items outside the view frustum are skipped
+	bool m_bFrustumCulling;
+	// number of items that passed the last culling pass
+	int m_visibleItemCount;
+	// scene file read by PrepareScene() instead of the built
+	// in scene, when it is set
+	std::string m_sceneFilename;
+	// what was last read from the scene file, which a reload
+	// is compared against to find what changed
+	std::vector<std::string> m_sceneFileTextureTags;
+	std::vector<std::string> m_sceneFileMaterialTags;
+	int m_sceneFileLightCount;
+	std::vector<SceneFile::SCENE_OBJECT> m_sceneFileObjects;
+	std::vector<SceneFile::SCENE_RACK> m_sceneFileRacks;
+	// view values of the primary camera of the frame, which
+	// the draw list is sorted and its LODs picked for
+	glm::mat4 m_viewMatrix;
+	glm::mat4 m_projectionMatrix;
+	glm::vec3 m_viewPosition;
+	// every camera of the frame, the primary one first
+	std::vector<SCENE_VIEW> m_sceneViews;
+	// clip planes of every camera, an item any of them can see
+	// is kept in the shared draw list
+	std::vector<Frustum> m_viewFrustums;
+
+	// load texture images and convert to OpenGL texture data
+	bool CreateGLTexture(const char* filename, const std::string& tag);
+	// bind loaded OpenGL textures to slots in memory
+	void BindGLTextures();
+	// free the loaded OpenGL textures
+	void DestroyGLTextures();
+	// find a loaded texture by tag
+	int FindTextureID(const std::string& tag);
+	int FindTextureSlot(const std::string& tag);
+	// find a defined material by tag
+	bool FindMaterial(const std::string& tag, OBJECT_MATERIAL& material);
+	int FindMaterialIndex(const std::string& tag);
+	// resolve the defined material tags to handles
+	void RegisterObjectMaterials();
+	// register the per draw uniforms with the state cache
+	void RegisterShaderUniforms();
+	// create the light and material uniform buffers
+	void CreateUniformBlocks();
+	// copy the defined materials into the material table
+	void UploadObjectMaterials();
+	// copy one object material into the material table
+	void UploadObjectMaterial(int materialIndex);
+	// copy one light source into the light block
+	void UploadLightSource(int lightIndex);
+
+	// record the current render values for the passed in mesh
+	void AddRenderItem(MESH_TYPE mesh);
+	// start the next recorded item from the default render values
+	void ResetRenderValues();
+	// fill the render list with all the objects of the 3D scene
+	void BuildRenderItems();
+	// add the evenly spread ceiling fixture lights
+	void AddCeilingLights();
+	// take the textures, materials, lights and objects of the
+	// scene from an opened scene file instead
+	void LoadSceneFileTextures(const SceneFile& sceneFile);
+	void DefineSceneFileMaterials(const SceneFile& sceneFile);
+	// true when the materials of a scene file fit the block
+	bool HasRoomForMaterials(const SceneFile& sceneFile);
+	void SetupSceneFileLights(const SceneFile& sceneFile);
+	void BuildSceneFileItems(const SceneFile& sceneFile);
+	// append moved copies of a range of the render list
+	void ReplicateRenderItems(int firstItem, int itemCount, int copyCount, glm::vec3 offsetXYZ);
+	// draw the basic mesh associated with the passed in type
+	void DrawMesh(MESH_TYPE mesh);
+	// send the render values of an item and draw its mesh
+	void DrawRenderItem(RENDER_ITEM& item);
+	// compute the world space bounds of a render item
+	void UpdateRenderItemBounds(RENDER_ITEM& item);
+	// mark the render items that are inside the view frustum
+	void CullRenderItems();
+	// set up the frustum of every view of the frame
+	void UpdateViewFrustums();
+	// work out the mip level each texture needs for the
+	// on-screen size of the visible items using it
+	void UpdateTextureDemand();
+	// get the height in pixels the bounds of an item cover
+	float GetProjectedPixels(const RENDER_ITEM& item, float pixelsPerUnit, bool bPerspective) const;
+	// pick the tessellation level of every drawn item from its
+	// size on screen, returning how many items changed level
+	int UpdateLodLevels();
+	// lower the texture demand of the passed in item's texture
+	void UpdateItemTextureDemand(
+		const RENDER_ITEM& item,
+		float pixelsPerUnit,
+		bool bPerspective,
+		bool bTestFrustums,
+		std::vector<int>& demand) const;
+	// sort the visible render items by shader state and depth
+	void SortRenderItems();
+	// get the draw order key of an item
+	uint64_t GetSortKey(RENDER_ITEM& item);
+	// sort a range of the draw order on all threads
+	void SortDrawOrder(int first, int last);
+	// sort the transparent tail of the draw order back to front
+	void SortTransparentItems();
+	// get the view depth of an item as sortable bits
+	uint32_t GetViewDepthBits(RENDER_ITEM& item);
+	// group the sorted render items from the passed in draw
+	// order entry onwards into instanced batches
+	void BuildInstanceBatches(int firstEntry);
+	// merge the static opaque items into static batches
+	void BakeStaticGeometry();
+	// draw the static batches inside the view frustum
+	void DrawStaticBatches();
+	// send the shared render values of a batch and draw it
+	void DrawInstanceBatch(const INSTANCE_BATCH& batch);
+	// get the texture unit of a batch, or -1 when untextured
+	int GetBatchTextureUnit(const INSTANCE_BATCH& batch) const;
+	// get the coarse view depth of the nearest item of a batch
+	uint32_t GetBatchDepthBucket(const INSTANCE_BATCH& batch) const;
+	// write an indirect command for every instanced batch
+	void BuildIndirectCommands();
+	// draw every instanced batch with the indirect commands
+	void DrawIndirectGroups(bool bTransparent);
+	// pick the commands the indirect draws of the current view
+	// read, culling them on the GPU when it is active
+	void CullIndirectCommands(bool bOcclusionTest);
+	// fence the commands and build the depth pyramid once
+	// every indirect draw of the frame is done
+	void FinishIndirectFrame();
+	// draw the opaque or the transparent part of the draw list
+	// through the current render path
+	void DrawOpaquePass();
+	void DrawTransparentPass();
+	// set the primary view values, marking what they change
+	void UpdatePrimaryView(
+		const glm::mat4& view,
+		const glm::mat4& projection,
+		const glm::vec3& viewPosition);
+	// set the viewport, frustum and view uniforms of a camera
+	void BeginSceneView(int viewIndex);
+	// cull and draw the passes of the camera that was begun
+	void DrawSceneView(int viewIndex);
+	// true when a drawn item is inside the current camera, when
+	// the shared draw list was culled for more than one
+	bool IsItemInSceneView(const RENDER_ITEM& item) const;
+	// draw the shadow maps that are out of date, and set the
+	// shadow uniforms of the lit passes
+	void UpdateShadowMaps();
+	// merge the static casters and collect the moving ones
+	void BakeShadowCasters();
+	// assign the lights to the clusters of a view, and set the
+	// cluster uniforms of the lit passes
+	void UpdateLightClusters(const glm::mat4& view, const glm::mat4& projection);
+	bool IsClusteredLightingActive() const;
+	// draw the static or the moving casters into one face of
+	// a light's cube map
+	void DrawShadowCasters(int light, int face, bool bStatic);
+	// true when the GPU culls the indirect draws this frame
+	bool IsGpuCullingActive() const;
+	// switch the buffers and baking over to the culling mode
+	void ApplyCullingMode();
+
+	// set the transformation values 
+	// for the next recorded item
+	void SetTransformations(
+		glm::vec3 scaleXYZ,
+		float XrotationDegrees,
+		float YrotationDegrees,
+		float ZrotationDegrees,
+		glm::vec3 positionXYZ);
+	// send the cached model matrix of the transform into the shader
+	void SetTransformations(
+		SceneTransform& transform);
+
+	// set the color values for the next recorded item
+	void SetShaderColor(
+		float redColorValue,
+		float greenColorValue,
+		float blueColorValue,
+		float alphaValue);
+
+	// set the texture for the next recorded item
+	void SetShaderTexture(
+		const std::string& textureTag);
+	// set the texture data of a texture handle into the shader
+	void SetShaderTexture(
+		int textureHandle);
+
+	// set the UV scale for the next recorded item
+	void SetTextureUVScale(
+		float u, float v);
+
+	// set whether the next recorded items never move
+	void SetObjectStatic(
+		bool bStatic);
+
+	// set the object material for the next recorded item
+	void SetShaderMaterial(
+		const std::string& materialTag);
+	// set the material table index of a material handle into the shader
+	void SetShaderMaterial(
+		int materialHandle);
+
+public:
+
+	// The following methods are for the students to 
+	// customize for their own 3D scene
+	void PrepareScene();
+	void RenderScene();
+	// set the view values of the frame to be rendered
+	void SetSceneView(
+		const glm::mat4& view,
+		const glm::mat4& projection,
+		const glm::vec3& viewPosition);
+	// set several cameras for the frame, each drawn into its
+	// own viewport from one shared draw list - the first one
+	// is the primary view
+	void SetSceneViews(const std::vector<SCENE_VIEW>& views);
+	int GetSceneViewCount() const { return((int)m_sceneViews.size()); }
+	// set how many copies of the dumbbell rack are recorded
+	// by the next PrepareScene(), for scaling the scene size
+	void SetRackCount(int rackCount);
+	int GetRenderItemCount() const { return((int)m_renderItems.size()); }
+	// turn skipping the items outside the view frustum on or off
+	void SetFrustumCulling(bool bEnabled);
+	// turn baking the static items into merged batches on or off
+	void SetStaticBatching(bool bEnabled);
+	// set the worker threads that build the draw list, -1 for
+	// one per spare core - read when the scene is prepared
+	void SetWorkerThreadCount(int workerCount) { m_workerThreadCount = workerCount; }
+	// turn culling the indirect draws on the GPU on or off
+	void SetGpuCulling(bool bEnabled);
+	bool GetGpuCulling() const { return(IsGpuCullingActive()); }
+	// turn drawing the depth of the opaque items before
+	// shading them on or off
+	void SetDepthPrepass(bool bEnabled) { m_bDepthPrepass = bEnabled; }
+	bool GetDepthPrepass() const { return(m_bDepthPrepass); }
+	// set the layout the instanced shape vertices are stored
+	// in - read when the scene is prepared
+	void SetVertexFormat(InstancedMeshes::VERTEX_FORMAT format) { m_pInstancedMeshes->SetVertexFormat(format); }
+	// turn the shadow maps of the lights on or off
+	void SetShadows(bool bEnabled);
+	bool GetShadows() const { return(m_bShadows); }
+	// turn the shadows of the moving items, and the per frame
+	// maps they are drawn into, on or off
+	void SetMovingShadows(bool bEnabled);
+	bool GetMovingShadows() const { return(m_bMovingShadows); }
+	int GetShadowMapRenderCount() const { return(m_shadowMapRenderCount); }
+	// turn evaluating only the lights of each fragment's
+	// cluster on or off
+	void SetClusteredLighting(bool bEnabled) { m_bClusteredLighting = bEnabled; }
+	bool GetClusteredLighting() const { return(IsClusteredLightingActive()); }
+	int GetLightClusterUpdateCount() const { return(m_pLightClusters->GetUpdateCount()); }
+	// set the ceiling fixture lights added by the next
+	// PrepareScene(), for scaling the light count
+	void SetCeilingLightCount(int lightCount);
+	// read the scene of the next PrepareScene() from a scene
+	// file, compiled or text, instead of the built in scene
+	void SetSceneFile(const std::string& filename) { m_sceneFilename = filename; }
+	// read the scene file again and update only what changed,
+	// keeping the textures and meshes that are already loaded
+	bool ReloadSceneFile();
+	// look the uniforms up again and attach the uniform blocks
+	// after the shader program has been rebuilt
+	void RefreshShaderProgram();
+	// true when the next frame would not look the same as the
+	// last one, because the view or the scene has changed or
+	// textures are still arriving
+	bool NeedsRedraw() const;
+	// have the next frame drawn even if nothing has changed
+	void RequestRedraw() { m_bRedrawNeeded = true; }
+	int GetStaticBatchCount() const { return(m_pStaticGeometry->GetBatchCount()); }
+	// block until every requested texture has been uploaded
+	void WaitForTextures();
+	// set the bytes of GPU memory the scene textures may use
+	void SetTextureBudget(size_t bytes);
+	size_t GetResidentTextureBytes() const { return(m_pTextureManager->GetResidentBytes()); }
+	int GetTextureEvictionCount() const { return(m_pTextureStreamer->GetEvictionCount()); }
+	// select how the render list is submitted to the GPU
+	void SetRenderPath(RENDER_PATH renderPath);
+	RENDER_PATH GetRenderPath() const { return(m_renderPath); }
+	// loads textures from image files
+	void LoadSceneTextures();
+
+	// pre-set light sources for 3D scene
+	void SetupSceneLights();
+	// add a light source to the light block, returning its index
+	int AddLightSource(const LIGHT_SOURCE& light);
+	// change a light source with a single buffer update
+	void SetLightSource(int lightIndex, const LIGHT_SOURCE& light);
+	int GetLightSourceCount() const { return((int)m_lightSources.size()); }
+	// remove every light source
+	void ClearLightSources();
+	// pre-define the object materials for lighting
+	void DefineObjectMaterials();
 };
\ No newline at end of file
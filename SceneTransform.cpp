@@ -0,0 +1,190 @@
+///////////////////////////////////////////////////////////////////////////////
+// scenetransform.cpp
+// ============
+// cache the composed model matrix of a 3D scene object
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "SceneTransform.h"
+
+#include <cmath>
+
+/***********************************************************
+ *  SceneTransform()
+ *
+ *  The default constructor, which starts from the identity
+ *  transformation.
+ ***********************************************************/
+SceneTransform::SceneTransform()
+{
+	m_scaleXYZ = glm::vec3(1.0f, 1.0f, 1.0f);
+	m_rotationDegrees = glm::vec3(0.0f, 0.0f, 0.0f);
+	m_positionXYZ = glm::vec3(0.0f, 0.0f, 0.0f);
+	m_modelMatrix = glm::mat4(1.0f);
+	m_bDirty = false;
+}
+
+/***********************************************************
+ *  SceneTransform()
+ *
+ *  The constructor for the passed in transformation values.
+ ***********************************************************/
+SceneTransform::SceneTransform(
+	glm::vec3 scaleXYZ,
+	float XrotationDegrees,
+	float YrotationDegrees,
+	float ZrotationDegrees,
+	glm::vec3 positionXYZ)
+{
+	Set(scaleXYZ, XrotationDegrees, YrotationDegrees, ZrotationDegrees, positionXYZ);
+}
+
+/***********************************************************
+ *  Set()
+ *
+ *  This method is used for setting all of the transformation
+ *  values and marking the cached model matrix as dirty.
+ ***********************************************************/
+void SceneTransform::Set(
+	glm::vec3 scaleXYZ,
+	float XrotationDegrees,
+	float YrotationDegrees,
+	float ZrotationDegrees,
+	glm::vec3 positionXYZ)
+{
+	m_scaleXYZ = scaleXYZ;
+	m_rotationDegrees = glm::vec3(XrotationDegrees, YrotationDegrees, ZrotationDegrees);
+	m_positionXYZ = positionXYZ;
+	m_bDirty = true;
+}
+
+/***********************************************************
+ *  SetScale()
+ *
+ *  This method is used for changing the scale, if it differs
+ *  from the current one.
+ ***********************************************************/
+void SceneTransform::SetScale(glm::vec3 scaleXYZ)
+{
+	if (scaleXYZ != m_scaleXYZ)
+	{
+		m_scaleXYZ = scaleXYZ;
+		m_bDirty = true;
+	}
+}
+
+/***********************************************************
+ *  SetRotation()
+ *
+ *  This method is used for changing the rotation, if it
+ *  differs from the current one.
+ ***********************************************************/
+void SceneTransform::SetRotation(
+	float XrotationDegrees,
+	float YrotationDegrees,
+	float ZrotationDegrees)
+{
+	glm::vec3 rotationDegrees(XrotationDegrees, YrotationDegrees, ZrotationDegrees);
+
+	if (rotationDegrees != m_rotationDegrees)
+	{
+		m_rotationDegrees = rotationDegrees;
+		m_bDirty = true;
+	}
+}
+
+/***********************************************************
+ *  SetPosition()
+ *
+ *  This method is used for changing the position, if it
+ *  differs from the current one.
+ ***********************************************************/
+void SceneTransform::SetPosition(glm::vec3 positionXYZ)
+{
+	if (positionXYZ != m_positionXYZ)
+	{
+		m_positionXYZ = positionXYZ;
+		m_bDirty = true;
+	}
+}
+
+/***********************************************************
+ *  GetModelMatrix()
+ *
+ *  This method is used for getting the composed model matrix.
+ *  The matrix is only rebuilt when one of the transformation
+ *  values has changed since the last call.
+ ***********************************************************/
+const glm::mat4& SceneTransform::GetModelMatrix()
+{
+	if (m_bDirty == true)
+	{
+		m_modelMatrix = ComposeTRS(
+			m_scaleXYZ,
+			m_rotationDegrees.x,
+			m_rotationDegrees.y,
+			m_rotationDegrees.z,
+			m_positionXYZ);
+		m_bDirty = false;
+	}
+
+	return(m_modelMatrix);
+}
+
+/***********************************************************
+ *  ComposeTRS()
+ *
+ *  This method is used for composing the model matrix
+ *  translation * rotationX * rotationY * rotationZ * scale
+ *  in closed form. The rotation part is written out from the
+ *  sines and cosines of the three angles, each column is
+ *  multiplied by its scale factor and the position becomes
+ *  the last column, which gives the same result as the five
+ *  separate glm matrices.
+ ***********************************************************/
+glm::mat4 SceneTransform::ComposeTRS(
+	glm::vec3 scaleXYZ,
+	float XrotationDegrees,
+	float YrotationDegrees,
+	float ZrotationDegrees,
+	glm::vec3 positionXYZ)
+{
+	const float xRadians = glm::radians(XrotationDegrees);
+	const float yRadians = glm::radians(YrotationDegrees);
+	const float zRadians = glm::radians(ZrotationDegrees);
+
+	const float cx = std::cos(xRadians);
+	const float sx = std::sin(xRadians);
+	const float cy = std::cos(yRadians);
+	const float sy = std::sin(yRadians);
+	const float cz = std::cos(zRadians);
+	const float sz = std::sin(zRadians);
+
+	glm::mat4 model;
+
+	// first column - rotated X axis scaled by X
+	model[0][0] = cy * cz * scaleXYZ.x;
+	model[0][1] = (cx * sz + sx * sy * cz) * scaleXYZ.x;
+	model[0][2] = (sx * sz - cx * sy * cz) * scaleXYZ.x;
+	model[0][3] = 0.0f;
+
+	// second column - rotated Y axis scaled by Y
+	model[1][0] = -cy * sz * scaleXYZ.y;
+	model[1][1] = (cx * cz - sx * sy * sz) * scaleXYZ.y;
+	model[1][2] = (sx * cz + cx * sy * sz) * scaleXYZ.y;
+	model[1][3] = 0.0f;
+
+	// third column - rotated Z axis scaled by Z
+	model[2][0] = sy * scaleXYZ.z;
+	model[2][1] = -sx * cy * scaleXYZ.z;
+	model[2][2] = cx * cy * scaleXYZ.z;
+	model[2][3] = 0.0f;
+
+	// fourth column - translation
+	model[3][0] = positionXYZ.x;
+	model[3][1] = positionXYZ.y;
+	model[3][2] = positionXYZ.z;
+	model[3][3] = 1.0f;
+
+	return(model);
+}
@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////////////////////
+// scenetransform.h
+// ============
+// cache the composed model matrix of a 3D scene object
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <glm/glm.hpp>
+
+/***********************************************************
+ *  SceneTransform
+ *
+ *  This class holds the scale, rotation and position of a
+ *  scene object along with the composed model matrix, which
+ *  is only rebuilt after one of those values has changed.
+ ***********************************************************/
+class SceneTransform
+{
+public:
+	// constructors
+	SceneTransform();
+	SceneTransform(
+		glm::vec3 scaleXYZ,
+		float XrotationDegrees,
+		float YrotationDegrees,
+		float ZrotationDegrees,
+		glm::vec3 positionXYZ);
+
+	// set all of the transformation values at once
+	void Set(
+		glm::vec3 scaleXYZ,
+		float XrotationDegrees,
+		float YrotationDegrees,
+		float ZrotationDegrees,
+		glm::vec3 positionXYZ);
+	// set the individual transformation values
+	void SetScale(glm::vec3 scaleXYZ);
+	void SetRotation(float XrotationDegrees, float YrotationDegrees, float ZrotationDegrees);
+	void SetPosition(glm::vec3 positionXYZ);
+
+	glm::vec3 GetScale() const { return(m_scaleXYZ); }
+	glm::vec3 GetRotation() const { return(m_rotationDegrees); }
+	glm::vec3 GetPosition() const { return(m_positionXYZ); }
+
+	// get the composed model matrix, rebuilding it if needed
+	const glm::mat4& GetModelMatrix();
+	// true when the cached model matrix is out of date
+	bool IsDirty() const { return(m_bDirty); }
+
+	// compose translation * rotationX * rotationY * rotationZ * scale
+	// directly, without building and multiplying the separate matrices
+	static glm::mat4 ComposeTRS(
+		glm::vec3 scaleXYZ,
+		float XrotationDegrees,
+		float YrotationDegrees,
+		float ZrotationDegrees,
+		glm::vec3 positionXYZ);
+
+private:
+	glm::vec3 m_scaleXYZ;
+	// X, Y and Z rotation in degrees
+	glm::vec3 m_rotationDegrees;
+	glm::vec3 m_positionXYZ;
+	// cached composed model matrix
+	glm::mat4 m_modelMatrix;
+	bool m_bDirty;
+};
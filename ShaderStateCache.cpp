@@ -0,0 +1,308 @@
+///////////////////////////////////////////////////////////////////////////////
+// shaderstatecache.cpp
+// ============
+// filter out redundant shader uniform updates
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ShaderStateCache.h"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <cstring>
+
+/***********************************************************
+ *  ShaderStateCache()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+ShaderStateCache::ShaderStateCache(ShaderManager* pShaderManager)
+{
+	m_pShaderManager = pShaderManager;
+	m_issuedCount = 0;
+	m_skippedCount = 0;
+}
+
+/***********************************************************
+ *  ~ShaderStateCache()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+ShaderStateCache::~ShaderStateCache()
+{
+	m_pShaderManager = NULL;
+}
+
+/***********************************************************
+ *  FindUniformLocation()
+ *
+ *  This method is used for getting the location of the named
+ *  uniform from the shader program.
+ ***********************************************************/
+GLint ShaderStateCache::FindUniformLocation(const std::string& name)
+{
+	if (NULL == m_pShaderManager)
+	{
+		return(-1);
+	}
+
+	return(glGetUniformLocation(m_pShaderManager->m_programID, name.c_str()));
+}
+
+/***********************************************************
+ *  RegisterUniform()
+ *
+ *  This method is used for registering the named uniform and
+ *  returning the ID that is passed to the setters. Names that
+ *  are already registered keep their first ID.
+ ***********************************************************/
+int ShaderStateCache::RegisterUniform(const std::string& name)
+{
+	std::unordered_map<std::string, int>::const_iterator found = m_uniformIDs.find(name);
+	if (found != m_uniformIDs.end())
+	{
+		return(found->second);
+	}
+
+	UNIFORM_STATE uniform;
+	uniform.name = name;
+	uniform.location = FindUniformLocation(name);
+	uniform.bHasValue = false;
+	uniform.intValue = 0;
+	uniform.issuedCount = 0;
+	memset(uniform.floatValues, 0, sizeof(uniform.floatValues));
+
+	int uniformID = (int)m_uniforms.size();
+	m_uniforms.push_back(uniform);
+	m_uniformIDs[name] = uniformID;
+
+	return(uniformID);
+}
+
+/***********************************************************
+ *  Reset()
+ *
+ *  This method is used for looking up the locations of all
+ *  the registered uniforms again and forgetting the values
+ *  that were sent before.
+ ***********************************************************/
+void ShaderStateCache::Reset()
+{
+	for (int i = 0; i < m_uniforms.size(); i++)
+	{
+		m_uniforms[i].location = FindUniformLocation(m_uniforms[i].name);
+	}
+	Invalidate();
+}
+
+/***********************************************************
+ *  Invalidate()
+ *
+ *  This method is used for forgetting the values that were
+ *  sent before, so the next value of each uniform is always
+ *  sent to the shader.
+ ***********************************************************/
+void ShaderStateCache::Invalidate()
+{
+	for (int i = 0; i < m_uniforms.size(); i++)
+	{
+		m_uniforms[i].bHasValue = false;
+	}
+}
+
+/***********************************************************
+ *  ResetCounters()
+ *
+ *  This method is used for clearing the issued and skipped
+ *  uniform update counters, including the per uniform ones.
+ ***********************************************************/
+void ShaderStateCache::ResetCounters()
+{
+	m_issuedCount = 0;
+	m_skippedCount = 0;
+	for (int i = 0; i < m_uniforms.size(); i++)
+	{
+		m_uniforms[i].issuedCount = 0;
+	}
+}
+
+/***********************************************************
+ *  GetIssuedCount()
+ *
+ *  This method is used for getting the number of updates of
+ *  one registered uniform that were sent to the shader since
+ *  the counters were last cleared.
+ ***********************************************************/
+unsigned int ShaderStateCache::GetIssuedCount(int uniformID) const
+{
+	if ((uniformID < 0) || (uniformID >= m_uniforms.size()))
+	{
+		return(0);
+	}
+
+	return(m_uniforms[uniformID].issuedCount);
+}
+
+/***********************************************************
+ *  StoreInt()
+ *
+ *  This method is used for remembering the passed in integer
+ *  value. It returns true when the value needs to be sent.
+ ***********************************************************/
+bool ShaderStateCache::StoreInt(int uniformID, int value)
+{
+	if ((uniformID < 0) || (uniformID >= m_uniforms.size()))
+	{
+		return(false);
+	}
+
+	UNIFORM_STATE& uniform = m_uniforms[uniformID];
+	if ((uniform.location < 0) ||
+		((uniform.bHasValue == true) && (uniform.intValue == value)))
+	{
+		m_skippedCount++;
+		return(false);
+	}
+
+	uniform.intValue = value;
+	uniform.bHasValue = true;
+	uniform.issuedCount++;
+	m_issuedCount++;
+
+	return(true);
+}
+
+/***********************************************************
+ *  StoreFloats()
+ *
+ *  This method is used for remembering the passed in float
+ *  values. It returns true when the values need to be sent.
+ ***********************************************************/
+bool ShaderStateCache::StoreFloats(int uniformID, const float* values, int count)
+{
+	if ((uniformID < 0) || (uniformID >= m_uniforms.size()))
+	{
+		return(false);
+	}
+
+	UNIFORM_STATE& uniform = m_uniforms[uniformID];
+	if ((uniform.location < 0) ||
+		((uniform.bHasValue == true) &&
+		 (memcmp(uniform.floatValues, values, count * sizeof(float)) == 0)))
+	{
+		m_skippedCount++;
+		return(false);
+	}
+
+	memcpy(uniform.floatValues, values, count * sizeof(float));
+	uniform.bHasValue = true;
+	uniform.issuedCount++;
+	m_issuedCount++;
+
+	return(true);
+}
+
+/***********************************************************
+ *  SetBoolValue()
+ *
+ *  This method is used for setting a bool uniform value.
+ ***********************************************************/
+void ShaderStateCache::SetBoolValue(int uniformID, bool value)
+{
+	if (StoreInt(uniformID, (int)value) == true)
+	{
+		glUniform1i(m_uniforms[uniformID].location, (int)value);
+	}
+}
+
+/***********************************************************
+ *  SetIntValue()
+ *
+ *  This method is used for setting an int uniform value.
+ ***********************************************************/
+void ShaderStateCache::SetIntValue(int uniformID, int value)
+{
+	if (StoreInt(uniformID, value) == true)
+	{
+		glUniform1i(m_uniforms[uniformID].location, value);
+	}
+}
+
+/***********************************************************
+ *  SetSampler2DValue()
+ *
+ *  This method is used for setting the texture unit of a
+ *  sampler uniform.
+ ***********************************************************/
+void ShaderStateCache::SetSampler2DValue(int uniformID, int value)
+{
+	if (StoreInt(uniformID, value) == true)
+	{
+		glUniform1i(m_uniforms[uniformID].location, value);
+	}
+}
+
+/***********************************************************
+ *  SetFloatValue()
+ *
+ *  This method is used for setting a float uniform value.
+ ***********************************************************/
+void ShaderStateCache::SetFloatValue(int uniformID, float value)
+{
+	if (StoreFloats(uniformID, &value, 1) == true)
+	{
+		glUniform1f(m_uniforms[uniformID].location, value);
+	}
+}
+
+/***********************************************************
+ *  SetVec2Value()
+ *
+ *  This method is used for setting a vec2 uniform value.
+ ***********************************************************/
+void ShaderStateCache::SetVec2Value(int uniformID, const glm::vec2& value)
+{
+	if (StoreFloats(uniformID, glm::value_ptr(value), 2) == true)
+	{
+		glUniform2fv(m_uniforms[uniformID].location, 1, glm::value_ptr(value));
+	}
+}
+
+/***********************************************************
+ *  SetVec3Value()
+ *
+ *  This method is used for setting a vec3 uniform value.
+ ***********************************************************/
+void ShaderStateCache::SetVec3Value(int uniformID, const glm::vec3& value)
+{
+	if (StoreFloats(uniformID, glm::value_ptr(value), 3) == true)
+	{
+		glUniform3fv(m_uniforms[uniformID].location, 1, glm::value_ptr(value));
+	}
+}
+
+/***********************************************************
+ *  SetVec4Value()
+ *
+ *  This method is used for setting a vec4 uniform value.
+ ***********************************************************/
+void ShaderStateCache::SetVec4Value(int uniformID, const glm::vec4& value)
+{
+	if (StoreFloats(uniformID, glm::value_ptr(value), 4) == true)
+	{
+		glUniform4fv(m_uniforms[uniformID].location, 1, glm::value_ptr(value));
+	}
+}
+
+/***********************************************************
+ *  SetMat4Value()
+ *
+ *  This method is used for setting a mat4 uniform value.
+ ***********************************************************/
+void ShaderStateCache::SetMat4Value(int uniformID, const glm::mat4& value)
+{
+	if (StoreFloats(uniformID, glm::value_ptr(value), 16) == true)
+	{
+		glUniformMatrix4fv(m_uniforms[uniformID].location, 1, GL_FALSE, glm::value_ptr(value));
+	}
+}
@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+// shaderstatecache.h
+// ============
+// filter out redundant shader uniform updates
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ShaderManager.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/***********************************************************
+ *  ShaderStateCache
+ *
+ *  This class sits between the scene code and the shader
+ *  manager. Uniforms are registered once to get an integer
+ *  ID with a cached uniform location, and every setter
+ *  remembers the last value that was sent, so the glUniform
+ *  call is skipped when the value has not changed.
+ ***********************************************************/
+class ShaderStateCache
+{
+public:
+	// constructor
+	ShaderStateCache(ShaderManager* pShaderManager);
+	// destructor
+	~ShaderStateCache();
+
+	// register a uniform by name and get its ID - the
+	// uniform location is only looked up here
+	int RegisterUniform(const std::string& name);
+	// look the uniform locations up again and forget all the
+	// remembered values, e.g. after the shader was relinked
+	void Reset();
+	// forget all the remembered values, so that the next
+	// value of every uniform is sent to the shader
+	void Invalidate();
+
+	// set uniform values by ID, skipping unchanged values
+	void SetBoolValue(int uniformID, bool value);
+	void SetIntValue(int uniformID, int value);
+	void SetSampler2DValue(int uniformID, int value);
+	void SetFloatValue(int uniformID, float value);
+	void SetVec2Value(int uniformID, const glm::vec2& value);
+	void SetVec3Value(int uniformID, const glm::vec3& value);
+	void SetVec4Value(int uniformID, const glm::vec4& value);
+	void SetMat4Value(int uniformID, const glm::mat4& value);
+
+	// number of glUniform calls that were sent to the shader
+	unsigned int GetIssuedCount() const { return(m_issuedCount); }
+	// number of glUniform calls sent for one registered uniform
+	unsigned int GetIssuedCount(int uniformID) const;
+	// number of uniform updates skipped as redundant
+	unsigned int GetSkippedCount() const { return(m_skippedCount); }
+	// clear the issued and skipped counters
+	void ResetCounters();
+
+private:
+	struct UNIFORM_STATE
+	{
+		std::string name;
+		GLint location;
+		// true once a value has been sent since the last reset
+		bool bHasValue;
+		int intValue;
+		float floatValues[16];
+		// glUniform calls sent since the counters were cleared
+		unsigned int issuedCount;
+	};
+
+	// pointer to shader manager object
+	ShaderManager* m_pShaderManager;
+	// registered uniforms indexed by ID
+	std::vector<UNIFORM_STATE> m_uniforms;
+	// uniform ID for each registered name
+	std::unordered_map<std::string, int> m_uniformIDs;
+	unsigned int m_issuedCount;
+	unsigned int m_skippedCount;
+
+	// get the uniform location from the shader program
+	GLint FindUniformLocation(const std::string& name);
+	// remember the passed in values, returning true when they
+	// differ from the last ones that were sent
+	bool StoreInt(int uniformID, int value);
+	bool StoreFloats(int uniformID, const float* values, int count);
+};
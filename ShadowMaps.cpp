@@ -0,0 +1,305 @@
+///////////////////////////////////////////////////////////////////////////////
+// shadowmaps.cpp
+// ============
+// render and keep the depth cube maps of the shadow casting lights
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ShadowMaps.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <iostream>
+
+// declaration of the global variables
+namespace
+{
+	// depth range of the light projections - the far plane
+	// covers every rack of the benchmark scene
+	const float g_ShadowNearPlane = 0.1f;
+	const float g_ShadowFarPlane = 100.0f;
+	// slope and constant depth offset of the drawn casters,
+	// keeping lit surfaces from shadowing themselves
+	const float g_PolygonOffsetFactor = 2.0f;
+	const float g_PolygonOffsetUnits = 4.0f;
+
+	// looking direction and up vector of every cube map face,
+	// as the cube map lookup expects them
+	const glm::vec3 g_FaceDirections[ShadowMaps::FACE_COUNT] =
+	{
+		glm::vec3(1.0f, 0.0f, 0.0f),
+		glm::vec3(-1.0f, 0.0f, 0.0f),
+		glm::vec3(0.0f, 1.0f, 0.0f),
+		glm::vec3(0.0f, -1.0f, 0.0f),
+		glm::vec3(0.0f, 0.0f, 1.0f),
+		glm::vec3(0.0f, 0.0f, -1.0f)
+	};
+	const glm::vec3 g_FaceUpVectors[ShadowMaps::FACE_COUNT] =
+	{
+		glm::vec3(0.0f, -1.0f, 0.0f),
+		glm::vec3(0.0f, -1.0f, 0.0f),
+		glm::vec3(0.0f, 0.0f, 1.0f),
+		glm::vec3(0.0f, 0.0f, -1.0f),
+		glm::vec3(0.0f, -1.0f, 0.0f),
+		glm::vec3(0.0f, -1.0f, 0.0f)
+	};
+}
+
+/***********************************************************
+ *  ShadowMaps()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+ShadowMaps::ShadowMaps()
+{
+	m_framebuffer = 0;
+	m_lightCount = 0;
+	m_resolution = 0;
+	m_nearPlane = g_ShadowNearPlane;
+	m_farPlane = g_ShadowFarPlane;
+	m_savedFramebuffer = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		m_savedViewport[i] = 0;
+	}
+}
+
+/***********************************************************
+ *  ~ShadowMaps()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+ShadowMaps::~ShadowMaps()
+{
+	Destroy();
+	m_emptyMaps.Destroy();
+}
+
+/***********************************************************
+ *  Create()
+ *
+ *  This method is used for creating the static cube maps of
+ *  the passed in number of lights and the framebuffer they
+ *  are drawn through. The per frame maps are only created
+ *  once the first moving object has to be added.
+ ***********************************************************/
+bool ShadowMaps::Create(int lightCount, int resolution)
+{
+	Destroy();
+
+	if ((lightCount <= 0) || (resolution <= 0))
+	{
+		return(false);
+	}
+
+	m_lightCount = std::min(lightCount, MAX_SHADOW_LIGHTS);
+	m_resolution = resolution;
+	CreateMaps(m_staticMaps);
+
+	glGenFramebuffers(1, &m_framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffer);
+	glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_staticMaps.GetID(), 0, 0);
+	glDrawBuffer(GL_NONE);
+	glReadBuffer(GL_NONE);
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	if (status != GL_FRAMEBUFFER_COMPLETE)
+	{
+		std::cout << "Shadow map framebuffer is incomplete: " << status << std::endl;
+		Destroy();
+		return(false);
+	}
+
+	return(true);
+}
+
+/***********************************************************
+ *  Destroy()
+ *
+ *  This method is used for freeing the cube maps and the
+ *  framebuffer.
+ ***********************************************************/
+void ShadowMaps::Destroy()
+{
+	if (m_framebuffer != 0)
+	{
+		glDeleteFramebuffers(1, &m_framebuffer);
+		m_framebuffer = 0;
+	}
+	m_staticMaps.Destroy();
+	m_frameMaps.Destroy();
+	m_lightCount = 0;
+	m_resolution = 0;
+}
+
+/***********************************************************
+ *  CreateMaps()
+ *
+ *  This method is used for creating a depth cube map array
+ *  with a cube for every light. Sampling it compares against
+ *  the stored depth, and the linear filter blends the four
+ *  nearest comparisons for softer edges.
+ ***********************************************************/
+void ShadowMaps::CreateMaps(GpuTexture& maps)
+{
+	maps.Create();
+	glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, maps.GetID());
+	glTexStorage3D(GL_TEXTURE_CUBE_MAP_ARRAY, 1, GL_DEPTH_COMPONENT32F,
+		m_resolution, m_resolution, m_lightCount * FACE_COUNT);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+	glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+	glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, 0);
+	maps.SetSize((size_t)m_resolution * m_resolution * m_lightCount * FACE_COUNT * sizeof(float));
+}
+
+/***********************************************************
+ *  GetFaceView()
+ *
+ *  This method is used for getting the view matrix looking
+ *  out of the passed in light position through one face of
+ *  its cube map.
+ ***********************************************************/
+glm::mat4 ShadowMaps::GetFaceView(const glm::vec3& lightPosition, int face) const
+{
+	return(glm::lookAt(lightPosition, lightPosition + g_FaceDirections[face], g_FaceUpVectors[face]));
+}
+
+/***********************************************************
+ *  GetFaceProjection()
+ *
+ *  This method is used for getting the projection that every
+ *  face is drawn with, a square 90 degree frustum so the six
+ *  faces cover every direction.
+ ***********************************************************/
+glm::mat4 ShadowMaps::GetFaceProjection() const
+{
+	return(glm::perspective(glm::radians(90.0f), 1.0f, m_nearPlane, m_farPlane));
+}
+
+/***********************************************************
+ *  BeginRender()
+ *
+ *  This method is used for saving the framebuffer and the
+ *  viewport of the scene and turning on the depth offset of
+ *  the casters. The maps are unbound from the passed in
+ *  texture unit they are sampled from, as they must not be
+ *  read while they are drawn into.
+ ***********************************************************/
+void ShadowMaps::BeginRender(GLint textureUnit)
+{
+	glActiveTexture(GL_TEXTURE0 + textureUnit);
+	glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, 0);
+	glActiveTexture(GL_TEXTURE0);
+
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &m_savedFramebuffer);
+	glGetIntegerv(GL_VIEWPORT, m_savedViewport);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffer);
+	glViewport(0, 0, m_resolution, m_resolution);
+	glEnable(GL_POLYGON_OFFSET_FILL);
+	glPolygonOffset(g_PolygonOffsetFactor, g_PolygonOffsetUnits);
+}
+
+/***********************************************************
+ *  BeginFace()
+ *
+ *  This method is used for attaching one face of a light's
+ *  static or per frame cube map as the depth target.
+ ***********************************************************/
+void ShadowMaps::BeginFace(int light, int face, bool bStatic)
+{
+	const GpuTexture& maps = (bStatic == true) ? m_staticMaps : m_frameMaps;
+	glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, maps.GetID(), 0, light * FACE_COUNT + face);
+
+	if (bStatic == true)
+	{
+		glClear(GL_DEPTH_BUFFER_BIT);
+	}
+}
+
+/***********************************************************
+ *  CopyStaticToFrame()
+ *
+ *  This method is used for starting the per frame maps from
+ *  the static ones, with a copy on the GPU that is far
+ *  cheaper than drawing the static objects again.
+ ***********************************************************/
+void ShadowMaps::CopyStaticToFrame()
+{
+	if (m_frameMaps.GetID() == 0)
+	{
+		CreateMaps(m_frameMaps);
+	}
+
+	glCopyImageSubData(
+		m_staticMaps.GetID(), GL_TEXTURE_CUBE_MAP_ARRAY, 0, 0, 0, 0,
+		m_frameMaps.GetID(), GL_TEXTURE_CUBE_MAP_ARRAY, 0, 0, 0, 0,
+		m_resolution, m_resolution, m_lightCount * FACE_COUNT);
+}
+
+/***********************************************************
+ *  EndRender()
+ *
+ *  This method is used for restoring the framebuffer and the
+ *  viewport saved by BeginRender().
+ ***********************************************************/
+void ShadowMaps::EndRender()
+{
+	glDisable(GL_POLYGON_OFFSET_FILL);
+	glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)m_savedFramebuffer);
+	glViewport(m_savedViewport[0], m_savedViewport[1], m_savedViewport[2], m_savedViewport[3]);
+}
+
+/***********************************************************
+ *  Bind()
+ *
+ *  This method is used for binding the static or the per
+ *  frame cube maps to the passed in texture unit.
+ ***********************************************************/
+void ShadowMaps::Bind(GLint textureUnit, bool bFrameMaps) const
+{
+	const GpuTexture& maps = ((bFrameMaps == true) && (m_frameMaps.GetID() != 0)) ? m_frameMaps : m_staticMaps;
+	glActiveTexture(GL_TEXTURE0 + textureUnit);
+	glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, maps.GetID());
+	glActiveTexture(GL_TEXTURE0);
+}
+
+/***********************************************************
+ *  BindEmpty()
+ *
+ *  This method is used for binding a cube map array of one
+ *  1x1 cube to the passed in texture unit while the shadows
+ *  are off. Its faces hold the far depth, so nothing it is
+ *  compared against is in shadow, and the shadow sampler
+ *  never shares its unit with a sampler of another type.
+ ***********************************************************/
+void ShadowMaps::BindEmpty(GLint textureUnit)
+{
+	if (m_emptyMaps.GetID() == 0)
+	{
+		const float farDepth[FACE_COUNT] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+
+		m_emptyMaps.Create();
+		glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, m_emptyMaps.GetID());
+		glTexStorage3D(GL_TEXTURE_CUBE_MAP_ARRAY, 1, GL_DEPTH_COMPONENT32F, 1, 1, FACE_COUNT);
+		glTexSubImage3D(GL_TEXTURE_CUBE_MAP_ARRAY, 0, 0, 0, 0, 1, 1, FACE_COUNT,
+			GL_DEPTH_COMPONENT, GL_FLOAT, farDepth);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+		glTexParameteri(GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+		glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, 0);
+		m_emptyMaps.SetSize(FACE_COUNT * sizeof(float));
+	}
+
+	glActiveTexture(GL_TEXTURE0 + textureUnit);
+	glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, m_emptyMaps.GetID());
+	glActiveTexture(GL_TEXTURE0);
+}
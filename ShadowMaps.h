@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////
+// shadowmaps.h
+// ============
+// render and keep the depth cube maps of the shadow casting lights
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GpuResource.h"
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+/***********************************************************
+ *  ShadowMaps
+ *
+ *  This class owns one depth cube map per shadow casting
+ *  point light, stored as layers of a cube map array. The
+ *  static cube maps only hold the objects that never move,
+ *  so they are rendered once and kept until a light or a
+ *  static object changes. Objects that move are drawn every
+ *  frame into a copy of the static maps, so the lights never
+ *  render the static scene again for them.
+ *
+ *  Each set of maps takes resolution x resolution x 4 bytes
+ *  x 6 faces x lights of video memory - 96 MB for four
+ *  lights at 1024. The per frame copy doubles that, so it is
+ *  only created once a moving object is drawn into it, and
+ *  can be freed again when the moving objects stop casting.
+ ***********************************************************/
+class ShadowMaps
+{
+public:
+	// constructor
+	ShadowMaps();
+	// destructor
+	~ShadowMaps();
+
+	// lights that get a cube map, the others are unshadowed
+	static const int MAX_SHADOW_LIGHTS = 4;
+	// faces of one cube map, in the +X -X +Y -Y +Z -Z order
+	// of the cube map layers
+	static const int FACE_COUNT = 6;
+
+	// create the cube maps of the passed in number of lights,
+	// each face the passed in size
+	bool Create(int lightCount, int resolution);
+	// free the textures and the framebuffer
+	void Destroy();
+	bool IsCreated() const { return(m_framebuffer != 0); }
+	int GetLightCount() const { return(m_lightCount); }
+
+	// view and projection of a face of a light's cube map
+	glm::mat4 GetFaceView(const glm::vec3& lightPosition, int face) const;
+	glm::mat4 GetFaceProjection() const;
+	// depth range of the face projections, which the shader
+	// needs to turn a distance into a stored depth
+	float GetNearPlane() const { return(m_nearPlane); }
+	float GetFarPlane() const { return(m_farPlane); }
+
+	// save the bound framebuffer and viewport and set up the
+	// state for drawing depth into the cube maps, unbinding
+	// them from the texture unit they are sampled from
+	void BeginRender(GLint textureUnit);
+	// draw into one face of the static or the per frame maps,
+	// clearing it first when it is a static face
+	void BeginFace(int light, int face, bool bStatic);
+	// start the per frame maps of this frame from the static ones
+	void CopyStaticToFrame();
+	// free the per frame maps until they are copied into again
+	void DestroyFrameMaps() { m_frameMaps.Destroy(); }
+	// restore the state saved by BeginRender()
+	void EndRender();
+
+	// bind the static or the per frame maps for sampling
+	void Bind(GLint textureUnit, bool bFrameMaps) const;
+	// bind a single unshadowed cube map in place of the maps,
+	// so the shadow sampler always reads a cube map array
+	// while the shadows are off
+	void BindEmpty(GLint textureUnit);
+
+private:
+	GLuint m_framebuffer;
+	// maps holding only the static objects, and the per frame
+	// maps with the moving objects added
+	GpuTexture m_staticMaps;
+	GpuTexture m_frameMaps;
+	// one cube of 1x1 faces at the far plane, bound while
+	// there are no maps, kept when the maps are destroyed
+	GpuTexture m_emptyMaps;
+	int m_lightCount;
+	int m_resolution;
+	float m_nearPlane;
+	float m_farPlane;
+	// state replaced while the maps are drawn
+	GLint m_savedFramebuffer;
+	GLint m_savedViewport[4];
+
+	// create one cube map array texture of the current size
+	void CreateMaps(GpuTexture& maps);
+};
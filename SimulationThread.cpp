@@ -0,0 +1,305 @@
+///////////////////////////////////////////////////////////////////////////////
+// simulationthread.cpp
+// ============
+// step the camera at a fixed rate on its own thread, apart from rendering
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "SimulationThread.h"
+
+#include "GLFW/glfw3.h"
+
+#include <algorithm>
+
+// declaration of the global variables
+namespace
+{
+	// camera movements a held key can ask for
+	const Camera_Movement g_Movements[] = { FORWARD, BACKWARD, LEFT, RIGHT, UP, DOWN };
+
+	// steps that are skipped instead of caught up with once
+	// the thread falls this far behind, such as after a stall
+	const int g_MaxCatchUpSteps = 5;
+}
+
+/***********************************************************
+ *  SimulationThread()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+SimulationThread::SimulationThread()
+{
+	m_pCamera = NULL;
+	m_stepDuration = CLOCK::duration::zero();
+	m_bStop = false;
+	m_heldMovement = 0;
+	m_mouseOffsetX = 0.0f;
+	m_mouseOffsetY = 0.0f;
+	m_scrollOffset = 0.0f;
+	m_bCameraMoved.store(false);
+}
+
+/***********************************************************
+ *  ~SimulationThread()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+SimulationThread::~SimulationThread()
+{
+	Stop();
+}
+
+/***********************************************************
+ *  Start()
+ *
+ *  This method is used for starting the thread that steps
+ *  the passed in camera. Both published states start out at
+ *  the camera as it is, so the first frames show it still.
+ ***********************************************************/
+void SimulationThread::Start(Camera* pCamera, double stepsPerSecond)
+{
+	Stop();
+	if ((pCamera == NULL) || (stepsPerSecond <= 0.0))
+	{
+		return;
+	}
+
+	m_pCamera = pCamera;
+	m_stepDuration = std::chrono::duration_cast<CLOCK::duration>(std::chrono::duration<double>(1.0 / stepsPerSecond));
+	m_bStop = false;
+	m_heldMovement = 0;
+	m_mouseOffsetX = 0.0f;
+	m_mouseOffsetY = 0.0f;
+	m_scrollOffset = 0.0f;
+
+	m_currentState = ReadCamera();
+	m_previousState = m_currentState;
+	m_currentStepTime = CLOCK::now();
+	m_bCameraMoved.store(false);
+
+	m_thread = std::thread(&SimulationThread::Run, this);
+}
+
+/***********************************************************
+ *  Stop()
+ *
+ *  This method is used for stopping the thread. It wakes
+ *  the thread out of its wait between steps, so the call
+ *  returns without waiting for the next step.
+ ***********************************************************/
+void SimulationThread::Stop()
+{
+	if (m_thread.joinable() == false)
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_inputMutex);
+		m_bStop = true;
+	}
+	m_stopRequested.notify_all();
+	m_thread.join();
+}
+
+/***********************************************************
+ *  SetHeldMovement()
+ *
+ *  This method is used for setting the camera movements of
+ *  the keys that are held down, which every step until the
+ *  next call applies.
+ ***********************************************************/
+void SimulationThread::SetHeldMovement(unsigned int movementMask)
+{
+	std::lock_guard<std::mutex> lock(m_inputMutex);
+	m_heldMovement = movementMask;
+}
+
+/***********************************************************
+ *  AddMouseMovement()
+ *
+ *  This method is used for adding mouse movement, which the
+ *  next step applies all at once.
+ ***********************************************************/
+void SimulationThread::AddMouseMovement(float xOffset, float yOffset)
+{
+	std::lock_guard<std::mutex> lock(m_inputMutex);
+	m_mouseOffsetX += xOffset;
+	m_mouseOffsetY += yOffset;
+}
+
+/***********************************************************
+ *  AddMouseScroll()
+ *
+ *  This method is used for adding mouse wheel scrolling,
+ *  which the next step applies all at once.
+ ***********************************************************/
+void SimulationThread::AddMouseScroll(float yOffset)
+{
+	std::lock_guard<std::mutex> lock(m_inputMutex);
+	m_scrollOffset += yOffset;
+}
+
+/***********************************************************
+ *  GetCameraState()
+ *
+ *  This method is used for getting the camera blended
+ *  between the last two steps. The blend follows how far
+ *  the current time is past the newer step, so the camera
+ *  is shown one step behind and moves evenly between them.
+ ***********************************************************/
+SimulationThread::CAMERA_STATE SimulationThread::GetCameraState() const
+{
+	std::lock_guard<std::mutex> lock(m_stateMutex);
+
+	if (m_stepDuration <= CLOCK::duration::zero())
+	{
+		return(m_currentState);
+	}
+
+	float blend = (float)((double)(CLOCK::now() - m_currentStepTime).count() / (double)m_stepDuration.count());
+	blend = std::max(0.0f, std::min(blend, 1.0f));
+
+	CAMERA_STATE state;
+	state.position = glm::mix(m_previousState.position, m_currentState.position, blend);
+	state.up = glm::mix(m_previousState.up, m_currentState.up, blend);
+	state.zoom = glm::mix(m_previousState.zoom, m_currentState.zoom, blend);
+	state.front = glm::mix(m_previousState.front, m_currentState.front, blend);
+	if (glm::length(state.front) > 0.0f)
+	{
+		state.front = glm::normalize(state.front);
+	}
+	else
+	{
+		state.front = m_currentState.front;
+	}
+
+	return(state);
+}
+
+/***********************************************************
+ *  Run()
+ *
+ *  This method is the main function of the thread. Steps
+ *  are scheduled from a fixed start time, so waking late for
+ *  one step does not move the ones after it, and a thread
+ *  that falls far behind skips ahead instead of running a
+ *  burst of steps. The shown camera moves while the step
+ *  is new or the two published steps still differ, so those
+ *  steps mark the camera moved and post an empty event to
+ *  wake a main thread waiting for input.
+ ***********************************************************/
+void SimulationThread::Run()
+{
+	const float stepSeconds = std::chrono::duration<float>(m_stepDuration).count();
+	CLOCK::time_point nextStep = CLOCK::now() + m_stepDuration;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_inputMutex);
+			if (m_stopRequested.wait_until(lock, nextStep, [this]() { return(m_bStop); }) == true)
+			{
+				return;
+			}
+		}
+
+		Step(stepSeconds);
+
+		CAMERA_STATE state = ReadCamera();
+		bool bMoved = false;
+		{
+			std::lock_guard<std::mutex> lock(m_stateMutex);
+			bMoved = (IsSameState(state, m_currentState) == false) ||
+				(IsSameState(m_previousState, m_currentState) == false);
+			m_previousState = m_currentState;
+			m_currentState = state;
+			m_currentStepTime = CLOCK::now();
+		}
+		if (bMoved == true)
+		{
+			m_bCameraMoved.store(true);
+			glfwPostEmptyEvent();
+		}
+
+		nextStep += m_stepDuration;
+		CLOCK::time_point now = CLOCK::now();
+		if (now - nextStep > m_stepDuration * g_MaxCatchUpSteps)
+		{
+			nextStep = now + m_stepDuration;
+		}
+	}
+}
+
+/***********************************************************
+ *  Step()
+ *
+ *  This method is used for moving the camera by one step.
+ *  The held keys move it for the length of the step, and
+ *  the mouse input gathered since the last step is taken
+ *  out and applied.
+ ***********************************************************/
+void SimulationThread::Step(float stepSeconds)
+{
+	unsigned int heldMovement = 0;
+	float mouseOffsetX = 0.0f;
+	float mouseOffsetY = 0.0f;
+	float scrollOffset = 0.0f;
+	{
+		std::lock_guard<std::mutex> lock(m_inputMutex);
+		heldMovement = m_heldMovement;
+		mouseOffsetX = m_mouseOffsetX;
+		mouseOffsetY = m_mouseOffsetY;
+		scrollOffset = m_scrollOffset;
+		m_mouseOffsetX = 0.0f;
+		m_mouseOffsetY = 0.0f;
+		m_scrollOffset = 0.0f;
+	}
+
+	for (int i = 0; i < sizeof(g_Movements) / sizeof(g_Movements[0]); i++)
+	{
+		if ((heldMovement & (1u << g_Movements[i])) != 0)
+		{
+			m_pCamera->ProcessKeyboard(g_Movements[i], stepSeconds);
+		}
+	}
+	if ((mouseOffsetX != 0.0f) || (mouseOffsetY != 0.0f))
+	{
+		m_pCamera->ProcessMouseMovement(mouseOffsetX, mouseOffsetY);
+	}
+	if (scrollOffset != 0.0f)
+	{
+		m_pCamera->ProcessMouseScroll(scrollOffset);
+	}
+}
+
+/***********************************************************
+ *  ReadCamera()
+ *
+ *  This method is used for copying the values of the camera
+ *  that the view is built from.
+ ***********************************************************/
+SimulationThread::CAMERA_STATE SimulationThread::ReadCamera() const
+{
+	CAMERA_STATE state;
+	state.position = m_pCamera->Position;
+	state.front = m_pCamera->Front;
+	state.up = m_pCamera->Up;
+	state.zoom = m_pCamera->Zoom;
+
+	return(state);
+}
+
+/***********************************************************
+ *  IsSameState()
+ *
+ *  This method is used for checking whether two camera
+ *  values would show the same view.
+ ***********************************************************/
+bool SimulationThread::IsSameState(const CAMERA_STATE& first, const CAMERA_STATE& second)
+{
+	return((first.position == second.position) &&
+		(first.front == second.front) &&
+		(first.up == second.up) &&
+		(first.zoom == second.zoom));
+}
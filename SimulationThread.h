@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+// simulationthread.h
+// ============
+// step the camera at a fixed rate on its own thread, apart from rendering
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "camera.h"
+
+#include <glm/glm.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/***********************************************************
+ *  SimulationThread
+ *
+ *  This class moves the camera in fixed time steps on a
+ *  thread of its own, so its speed does not depend on how
+ *  long a frame takes to render. The main thread, which is
+ *  the only one allowed to read the GLFW input, passes the
+ *  held keys and the mouse movement in, and the renderer
+ *  reads the camera blended between the last two steps, so
+ *  the motion stays smooth at any frame rate. A step that
+ *  moves the camera wakes the main thread, so a loop that
+ *  waits for events still draws the camera where it ends.
+ ***********************************************************/
+class SimulationThread
+{
+public:
+	// constructor
+	SimulationThread();
+	// destructor
+	~SimulationThread();
+
+	// camera values published after every step
+	struct CAMERA_STATE
+	{
+		glm::vec3 position;
+		glm::vec3 front;
+		glm::vec3 up;
+		float zoom;
+	};
+
+	// start stepping the passed in camera at the passed in
+	// rate - the camera must not be used elsewhere until the
+	// thread is stopped
+	void Start(Camera* pCamera, double stepsPerSecond);
+	// finish the current step and stop the thread
+	void Stop();
+	bool IsRunning() const { return(m_thread.joinable()); }
+
+	// set the camera movements whose keys are held down, one
+	// bit per Camera_Movement value
+	void SetHeldMovement(unsigned int movementMask);
+	// add mouse movement and scrolling for the next step
+	void AddMouseMovement(float xOffset, float yOffset);
+	void AddMouseScroll(float yOffset);
+
+	// get the camera between the last two steps, at the point
+	// the current time has reached past the newer one
+	CAMERA_STATE GetCameraState() const;
+	// true when a step has moved the camera, or finished the
+	// blend towards it, since the flag was last cleared
+	bool HasCameraMoved() const { return(m_bCameraMoved.load()); }
+	void ClearCameraMoved() { m_bCameraMoved.store(false); }
+
+private:
+	typedef std::chrono::steady_clock CLOCK;
+
+	Camera* m_pCamera;
+	CLOCK::duration m_stepDuration;
+	std::thread m_thread;
+
+	// input for the next step, and the flag stopping the thread
+	std::mutex m_inputMutex;
+	std::condition_variable m_stopRequested;
+	bool m_bStop;
+	unsigned int m_heldMovement;
+	float m_mouseOffsetX;
+	float m_mouseOffsetY;
+	float m_scrollOffset;
+
+	// the last two published steps and when the newer ran
+	mutable std::mutex m_stateMutex;
+	CAMERA_STATE m_previousState;
+	CAMERA_STATE m_currentState;
+	CLOCK::time_point m_currentStepTime;
+	std::atomic<bool> m_bCameraMoved;
+
+	// main function of the thread
+	void Run();
+	// move the camera by one step of the gathered input
+	void Step(float stepSeconds);
+	// copy the values of the camera
+	CAMERA_STATE ReadCamera() const;
+	// true when two camera values are the same
+	static bool IsSameState(const CAMERA_STATE& first, const CAMERA_STATE& second);
+};
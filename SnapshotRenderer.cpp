@@ -0,0 +1,647 @@
+///////////////////////////////////////////////////////////////////////////////
+// snapshotrenderer.cpp
+// ============
+// render the scene into an offscreen image and write it to a file without
+// waiting for the GPU
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "SnapshotRenderer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// declaration of the global variables
+namespace
+{
+	// field of view of a shot that does not give one
+	const float g_DefaultFieldOfView = 45.0f;
+	// nanoseconds a wait for a readback fence blocks before it
+	// checks again
+	const GLuint64 g_ReadbackWaitNanoseconds = 1000000000;
+	// largest stored block of the uncompressed zlib stream
+	const size_t g_MaxStoredBlock = 65535;
+
+	// table of the CRC-32 that ends every PNG chunk
+	struct CRC_TABLE
+	{
+		uint32_t values[256];
+
+		CRC_TABLE()
+		{
+			for (uint32_t i = 0; i < 256; i++)
+			{
+				uint32_t crc = i;
+				for (int bit = 0; bit < 8; bit++)
+				{
+					crc = (crc & 1) ? (0xEDB88320u ^ (crc >> 1)) : (crc >> 1);
+				}
+				values[i] = crc;
+			}
+		}
+	};
+
+	/***********************************************************
+	 *  GetCrcTable()
+	 *
+	 *  This function returns the CRC-32 table, built by the
+	 *  first encoding thread that needs it.
+	 ***********************************************************/
+	const uint32_t* GetCrcTable()
+	{
+		static const CRC_TABLE table;
+		return(table.values);
+	}
+
+	/***********************************************************
+	 *  AppendBigEndian()
+	 *
+	 *  This function appends a 32 bit value with its highest
+	 *  byte first, as PNG stores them.
+	 ***********************************************************/
+	void AppendBigEndian(std::vector<unsigned char>& bytes, uint32_t value)
+	{
+		bytes.push_back((unsigned char)(value >> 24));
+		bytes.push_back((unsigned char)(value >> 16));
+		bytes.push_back((unsigned char)(value >> 8));
+		bytes.push_back((unsigned char)value);
+	}
+
+	/***********************************************************
+	 *  AppendChunk()
+	 *
+	 *  This function appends one PNG chunk - its length, type,
+	 *  data and the CRC of the type and data.
+	 ***********************************************************/
+	void AppendChunk(std::vector<unsigned char>& png, const char* type, const std::vector<unsigned char>& data)
+	{
+		const uint32_t* crcTable = GetCrcTable();
+
+		AppendBigEndian(png, (uint32_t)data.size());
+		size_t typeStart = png.size();
+		png.insert(png.end(), type, type + 4);
+		png.insert(png.end(), data.begin(), data.end());
+
+		uint32_t crc = 0xFFFFFFFFu;
+		for (size_t i = typeStart; i < png.size(); i++)
+		{
+			crc = crcTable[(crc ^ png[i]) & 0xFF] ^ (crc >> 8);
+		}
+		AppendBigEndian(png, crc ^ 0xFFFFFFFFu);
+	}
+}
+
+/***********************************************************
+ *  SnapshotRenderer()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+SnapshotRenderer::SnapshotRenderer()
+{
+	m_width = 0;
+	m_height = 0;
+	m_sampleCount = 0;
+	m_multisampleFramebuffer = 0;
+	m_resolveFramebuffer = 0;
+	m_savedFramebuffer = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		m_savedViewport[i] = 0;
+	}
+	m_bInImage = false;
+	for (int i = 0; i < READBACK_SLOT_COUNT; i++)
+	{
+		m_slots[i].fence = 0;
+	}
+	m_nextSlot = 0;
+	m_activeCount = 0;
+	m_bStopEncoders = false;
+	m_writtenCount = 0;
+	m_failedCount = 0;
+}
+
+/***********************************************************
+ *  ~SnapshotRenderer()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+SnapshotRenderer::~SnapshotRenderer()
+{
+	Destroy();
+}
+
+/***********************************************************
+ *  LoadJobList()
+ *
+ *  This method is used for reading the images of a batch
+ *  from a text file. A "scene <file>" line loads the scene
+ *  file for the shots after it, and every
+ *  "shot <image> <x y z> <target x y z> [field of view]"
+ *  line adds one image, seen from the position towards the
+ *  target. Everything after a # is a comment.
+ ***********************************************************/
+bool SnapshotRenderer::LoadJobList(const std::string& filename, std::vector<SNAPSHOT_JOB>& jobs)
+{
+	jobs.clear();
+
+	std::ifstream file(filename.c_str());
+	if (file.is_open() == false)
+	{
+		std::cout << "Could not open snapshot list: " << filename << std::endl;
+		return(false);
+	}
+
+	std::string sceneFilename;
+	std::string line;
+	int lineNumber = 0;
+	while (std::getline(file, line))
+	{
+		lineNumber++;
+		size_t comment = line.find('#');
+		if (comment != std::string::npos)
+		{
+			line.erase(comment);
+		}
+
+		std::istringstream stream(line);
+		std::string keyword;
+		if (!(stream >> keyword))
+		{
+			continue;
+		}
+
+		if (keyword == "scene")
+		{
+			if (!(stream >> sceneFilename))
+			{
+				std::cout << filename << "(" << lineNumber << "): scene is missing its file" << std::endl;
+				return(false);
+			}
+		}
+		else if (keyword == "shot")
+		{
+			SNAPSHOT_JOB job;
+			job.sceneFilename = sceneFilename;
+			job.fieldOfView = g_DefaultFieldOfView;
+			if (!(stream >> job.imageFilename
+				>> job.position.x >> job.position.y >> job.position.z
+				>> job.target.x >> job.target.y >> job.target.z))
+			{
+				std::cout << filename << "(" << lineNumber << "): shot needs an image file, a position and a target" << std::endl;
+				return(false);
+			}
+
+			float fieldOfView = 0.0f;
+			if ((stream >> fieldOfView) && (fieldOfView > 0.0f))
+			{
+				job.fieldOfView = fieldOfView;
+			}
+			jobs.push_back(job);
+		}
+		else
+		{
+			std::cout << filename << "(" << lineNumber << "): unexpected '" << keyword << "'" << std::endl;
+			return(false);
+		}
+	}
+
+	return(true);
+}
+
+/***********************************************************
+ *  Create()
+ *
+ *  This method is used for creating the multisampled
+ *  framebuffer the images are drawn into, the framebuffer
+ *  they are resolved into and the readback buffers, and for
+ *  starting the encoding threads. The samples are limited to
+ *  what the driver supports.
+ ***********************************************************/
+bool SnapshotRenderer::Create(int width, int height, int sampleCount, int encoderCount)
+{
+	Destroy();
+
+	if ((width <= 0) || (height <= 0))
+	{
+		return(false);
+	}
+
+	GLint maxSamples = 1;
+	glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+	m_width = width;
+	m_height = height;
+	m_sampleCount = std::max(std::min(sampleCount, (int)maxSamples), 1);
+
+	m_colorTexture.Create();
+	glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, m_colorTexture.GetID());
+	glTexStorage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, m_sampleCount, GL_RGBA8, width, height, GL_TRUE);
+	m_colorTexture.SetSize((size_t)width * height * 4 * m_sampleCount);
+
+	m_depthTexture.Create();
+	glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, m_depthTexture.GetID());
+	glTexStorage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, m_sampleCount, GL_DEPTH_COMPONENT24, width, height, GL_TRUE);
+	m_depthTexture.SetSize((size_t)width * height * 4 * m_sampleCount);
+	glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, 0);
+
+	m_resolveTexture.Create();
+	glBindTexture(GL_TEXTURE_2D, m_resolveTexture.GetID());
+	glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+	m_resolveTexture.SetSize((size_t)width * height * 4);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glGenFramebuffers(1, &m_multisampleFramebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, m_multisampleFramebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D_MULTISAMPLE, m_colorTexture.GetID(), 0);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D_MULTISAMPLE, m_depthTexture.GetID(), 0);
+	GLenum multisampleStatus = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+
+	glGenFramebuffers(1, &m_resolveFramebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, m_resolveFramebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_resolveTexture.GetID(), 0);
+	glReadBuffer(GL_COLOR_ATTACHMENT0);
+	GLenum resolveStatus = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	if ((multisampleStatus != GL_FRAMEBUFFER_COMPLETE) || (resolveStatus != GL_FRAMEBUFFER_COMPLETE))
+	{
+		std::cout << "Snapshot framebuffer is incomplete: " << multisampleStatus << " " << resolveStatus << std::endl;
+		Destroy();
+		return(false);
+	}
+
+	size_t imageBytes = (size_t)width * height * 4;
+	for (int i = 0; i < READBACK_SLOT_COUNT; i++)
+	{
+		m_slots[i].buffer.Create(GpuResourceTracker::RESOURCE_READBACK_BUFFER);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, m_slots[i].buffer.GetID());
+		glBufferData(GL_PIXEL_PACK_BUFFER, imageBytes, NULL, GL_STREAM_READ);
+		m_slots[i].buffer.SetSize(imageBytes);
+		m_slots[i].fence = 0;
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	m_nextSlot = 0;
+
+	if (encoderCount < 0)
+	{
+		encoderCount = (int)std::thread::hardware_concurrency() - 1;
+	}
+	encoderCount = std::max(encoderCount, 1);
+
+	m_bStopEncoders = false;
+	m_activeCount = 0;
+	m_writtenCount = 0;
+	m_failedCount = 0;
+	for (int i = 0; i < encoderCount; i++)
+	{
+		m_encoders.push_back(std::thread(&SnapshotRenderer::EncoderLoop, this));
+	}
+
+	return(true);
+}
+
+/***********************************************************
+ *  Destroy()
+ *
+ *  This method is used for writing the images that are still
+ *  on their way, stopping the encoding threads and freeing
+ *  the framebuffers and readback buffers.
+ ***********************************************************/
+void SnapshotRenderer::Destroy()
+{
+	if (m_encoders.size() > 0)
+	{
+		Finish();
+
+		{
+			std::lock_guard<std::mutex> lock(m_queueMutex);
+			m_bStopEncoders = true;
+		}
+		m_jobReady.notify_all();
+		for (int i = 0; i < m_encoders.size(); i++)
+		{
+			m_encoders[i].join();
+		}
+		m_encoders.clear();
+	}
+
+	for (int i = 0; i < READBACK_SLOT_COUNT; i++)
+	{
+		if (m_slots[i].fence != 0)
+		{
+			glDeleteSync(m_slots[i].fence);
+			m_slots[i].fence = 0;
+		}
+		m_slots[i].buffer.Destroy();
+	}
+
+	if (m_multisampleFramebuffer != 0)
+	{
+		glDeleteFramebuffers(1, &m_multisampleFramebuffer);
+		m_multisampleFramebuffer = 0;
+	}
+	if (m_resolveFramebuffer != 0)
+	{
+		glDeleteFramebuffers(1, &m_resolveFramebuffer);
+		m_resolveFramebuffer = 0;
+	}
+	m_colorTexture.Destroy();
+	m_depthTexture.Destroy();
+	m_resolveTexture.Destroy();
+	m_width = 0;
+	m_height = 0;
+	m_sampleCount = 0;
+	m_bInImage = false;
+}
+
+/***********************************************************
+ *  BeginImage()
+ *
+ *  This method is used for drawing into the multisampled
+ *  image instead of the window, with the viewport covering
+ *  the whole image, and clearing it. The window framebuffer
+ *  and viewport are saved the first time, so an image that
+ *  is started over still goes back to the window afterwards.
+ ***********************************************************/
+void SnapshotRenderer::BeginImage(const glm::vec4& clearColor)
+{
+	if (IsCreated() == false)
+	{
+		return;
+	}
+
+	if (m_bInImage == false)
+	{
+		glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &m_savedFramebuffer);
+		glGetIntegerv(GL_VIEWPORT, m_savedViewport);
+		m_bInImage = true;
+	}
+
+	glBindFramebuffer(GL_FRAMEBUFFER, m_multisampleFramebuffer);
+	glViewport(0, 0, m_width, m_height);
+	glClearColor(clearColor.r, clearColor.g, clearColor.b, clearColor.a);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+/***********************************************************
+ *  EndImage()
+ *
+ *  This method is used for resolving the samples of the
+ *  image and reading it into the next readback buffer. The
+ *  read only queues the copy, and a fence tells when it is
+ *  done, so nothing waits for the GPU here unless all of the
+ *  buffers are still in use. The images that have arrived
+ *  since are handed to the encoding threads.
+ ***********************************************************/
+void SnapshotRenderer::EndImage(const std::string& imageFilename)
+{
+	if (m_bInImage == false)
+	{
+		return;
+	}
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, m_multisampleFramebuffer);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_resolveFramebuffer);
+	glBlitFramebuffer(0, 0, m_width, m_height, 0, 0, m_width, m_height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+	// the oldest image has to be out of its buffer before the
+	// buffer takes the new one
+	READBACK_SLOT& slot = m_slots[m_nextSlot];
+	if (slot.fence != 0)
+	{
+		CollectReadback(m_nextSlot, true);
+	}
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, m_resolveFramebuffer);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer.GetID());
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	glReadPixels(0, 0, m_width, m_height, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	slot.imageFilename = imageFilename;
+	m_nextSlot = (m_nextSlot + 1) % READBACK_SLOT_COUNT;
+
+	glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)m_savedFramebuffer);
+	glViewport(m_savedViewport[0], m_savedViewport[1], m_savedViewport[2], m_savedViewport[3]);
+	m_bInImage = false;
+
+	for (int i = 0; i < READBACK_SLOT_COUNT; i++)
+	{
+		CollectReadback((m_nextSlot + i) % READBACK_SLOT_COUNT, false);
+	}
+}
+
+/***********************************************************
+ *  Finish()
+ *
+ *  This method is used for waiting until every image has
+ *  been read back, oldest first, and every file has been
+ *  written by the encoding threads.
+ ***********************************************************/
+int SnapshotRenderer::Finish()
+{
+	for (int i = 0; i < READBACK_SLOT_COUNT; i++)
+	{
+		CollectReadback((m_nextSlot + i) % READBACK_SLOT_COUNT, true);
+	}
+
+	std::unique_lock<std::mutex> lock(m_queueMutex);
+	m_jobDone.wait(lock, [this]() { return((m_encodeJobs.empty() == true) && (m_activeCount == 0)); });
+
+	return(m_writtenCount.load());
+}
+
+/***********************************************************
+ *  CollectReadback()
+ *
+ *  This method is used for copying a read back image out of
+ *  its buffer once its fence has passed, so the buffer can
+ *  take the next image, and queueing the copy for the
+ *  encoding threads. Without waiting it returns false while
+ *  the image is still on its way.
+ ***********************************************************/
+bool SnapshotRenderer::CollectReadback(int slotIndex, bool bWait)
+{
+	READBACK_SLOT& slot = m_slots[slotIndex];
+	if (slot.fence == 0)
+	{
+		return(true);
+	}
+
+	// the first check also flushes, so the fence is sure to
+	// reach the GPU
+	GLuint64 timeout = (bWait == true) ? g_ReadbackWaitNanoseconds : 0;
+	GLenum result = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+	while ((bWait == true) && (result == GL_TIMEOUT_EXPIRED))
+	{
+		result = glClientWaitSync(slot.fence, 0, timeout);
+	}
+	if (result == GL_TIMEOUT_EXPIRED)
+	{
+		return(false);
+	}
+	glDeleteSync(slot.fence);
+	slot.fence = 0;
+
+	ENCODE_JOB job;
+	job.width = m_width;
+	job.height = m_height;
+	job.imageFilename = slot.imageFilename;
+	if (result != GL_WAIT_FAILED)
+	{
+		size_t imageBytes = (size_t)m_width * m_height * 4;
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer.GetID());
+		const unsigned char* pPixels = (const unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, imageBytes, GL_MAP_READ_BIT);
+		if (pPixels != NULL)
+		{
+			job.pixels.assign(pPixels, pPixels + imageBytes);
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		}
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	}
+	if (job.pixels.empty() == true)
+	{
+		std::cout << "Could not read back the snapshot " << job.imageFilename << std::endl;
+		m_failedCount++;
+		return(true);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_encodeJobs.push_back(std::move(job));
+	}
+	m_jobReady.notify_one();
+
+	return(true);
+}
+
+/***********************************************************
+ *  EncoderLoop()
+ *
+ *  This method is run by every encoding thread. It takes the
+ *  read back images from the queue and writes them into
+ *  their files until the threads are stopped.
+ ***********************************************************/
+void SnapshotRenderer::EncoderLoop()
+{
+	while (true)
+	{
+		ENCODE_JOB job;
+		{
+			std::unique_lock<std::mutex> lock(m_queueMutex);
+			m_jobReady.wait(lock, [this]() { return((m_bStopEncoders == true) || (m_encodeJobs.empty() == false)); });
+			if (m_bStopEncoders == true)
+			{
+				return;
+			}
+			job = std::move(m_encodeJobs.front());
+			m_encodeJobs.pop_front();
+			m_activeCount++;
+		}
+
+		if (WritePNG(job.imageFilename, job.pixels.data(), job.width, job.height) == true)
+		{
+			m_writtenCount++;
+		}
+		else
+		{
+			m_failedCount++;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_queueMutex);
+			m_activeCount--;
+		}
+		m_jobDone.notify_all();
+	}
+}
+
+/***********************************************************
+ *  WritePNG()
+ *
+ *  This method is used for writing an image into an 8 bit
+ *  RGB PNG file. The rows are turned top side up and the
+ *  alpha is left out, as blended items leave it below one.
+ *  There is no zlib in the project, so the pixels are kept
+ *  in stored deflate blocks - the files are larger than a
+ *  compressed PNG, but any viewer can read them.
+ ***********************************************************/
+bool SnapshotRenderer::WritePNG(const std::string& filename, const unsigned char* pPixels, int width, int height)
+{
+	// every row starts with its filter type, 0 for none
+	size_t rowBytes = (size_t)width * 3 + 1;
+	std::vector<unsigned char> rows(rowBytes * height);
+	for (int y = 0; y < height; y++)
+	{
+		const unsigned char* pSource = pPixels + (size_t)(height - 1 - y) * width * 4;
+		unsigned char* pRow = &rows[(size_t)y * rowBytes];
+		pRow[0] = 0;
+		for (int x = 0; x < width; x++)
+		{
+			pRow[1 + x * 3 + 0] = pSource[x * 4 + 0];
+			pRow[1 + x * 3 + 1] = pSource[x * 4 + 1];
+			pRow[1 + x * 3 + 2] = pSource[x * 4 + 2];
+		}
+	}
+
+	// zlib stream of stored blocks, ended by the Adler-32 of
+	// the rows
+	std::vector<unsigned char> compressed;
+	compressed.reserve(rows.size() + (rows.size() / g_MaxStoredBlock + 1) * 5 + 6);
+	compressed.push_back(0x78);
+	compressed.push_back(0x01);
+	size_t offset = 0;
+	do
+	{
+		size_t blockBytes = std::min(rows.size() - offset, g_MaxStoredBlock);
+		bool bLast = (offset + blockBytes == rows.size());
+		compressed.push_back(bLast ? 1 : 0);
+		compressed.push_back((unsigned char)(blockBytes & 0xFF));
+		compressed.push_back((unsigned char)(blockBytes >> 8));
+		compressed.push_back((unsigned char)(~blockBytes & 0xFF));
+		compressed.push_back((unsigned char)((~blockBytes >> 8) & 0xFF));
+		compressed.insert(compressed.end(), rows.begin() + offset, rows.begin() + offset + blockBytes);
+		offset += blockBytes;
+	} while (offset < rows.size());
+
+	uint32_t adlerLow = 1;
+	uint32_t adlerHigh = 0;
+	for (size_t i = 0; i < rows.size(); i++)
+	{
+		adlerLow = (adlerLow + rows[i]) % 65521;
+		adlerHigh = (adlerHigh + adlerLow) % 65521;
+	}
+	AppendBigEndian(compressed, (adlerHigh << 16) | adlerLow);
+
+	std::vector<unsigned char> header;
+	AppendBigEndian(header, (uint32_t)width);
+	AppendBigEndian(header, (uint32_t)height);
+	// 8 bits per channel, RGB, deflate, adaptive filtering and
+	// no interlacing
+	header.push_back(8);
+	header.push_back(2);
+	header.push_back(0);
+	header.push_back(0);
+	header.push_back(0);
+
+	static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	std::vector<unsigned char> png(signature, signature + 8);
+	AppendChunk(png, "IHDR", header);
+	AppendChunk(png, "IDAT", compressed);
+	AppendChunk(png, "IEND", std::vector<unsigned char>());
+
+	std::ofstream file(filename.c_str(), std::ios::binary);
+	if (file.is_open() == true)
+	{
+		file.write((const char*)png.data(), png.size());
+	}
+	if ((file.is_open() == false) || (file.good() == false))
+	{
+		std::cout << "Could not write snapshot: " << filename << std::endl;
+		return(false);
+	}
+
+	return(true);
+}
@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+// snapshotrenderer.h
+// ============
+// render the scene into an offscreen image and write it to a file without
+// waiting for the GPU
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GpuResource.h"
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/***********************************************************
+ *  SnapshotRenderer
+ *
+ *  This class owns a multisampled framebuffer of any size
+ *  that the scene is drawn into in place of the window. A
+ *  finished image is resolved and read into one of a ring of
+ *  pixel pack buffers, with a fence instead of a wait, and
+ *  copied out once the fence has passed - usually while the
+ *  next image is being drawn. Writing the image files is
+ *  left to encoding threads, so neither the copy from the GPU
+ *  nor the file writing holds up the drawing.
+ ***********************************************************/
+class SnapshotRenderer
+{
+public:
+	// constructor
+	SnapshotRenderer();
+	// destructor
+	~SnapshotRenderer();
+
+	// pixel pack buffers an image can be read back through
+	// while the ones before it are still on their way
+	static const int READBACK_SLOT_COUNT = 3;
+
+	// one image of a batch, the scene file it shows and the
+	// camera it is seen from
+	struct SNAPSHOT_JOB
+	{
+		// scene file the image shows, empty for the scene that
+		// was loaded at startup
+		std::string sceneFilename;
+		glm::vec3 position;
+		glm::vec3 target;
+		// vertical field of view in degrees
+		float fieldOfView;
+		std::string imageFilename;
+	};
+
+	// read the images of a batch from a text file
+	static bool LoadJobList(const std::string& filename, std::vector<SNAPSHOT_JOB>& jobs);
+
+	// create the framebuffers and readback buffers for images
+	// of the passed in size and number of samples, and start
+	// the encoding threads - one per spare core when negative
+	bool Create(int width, int height, int sampleCount, int encoderCount);
+	// wait for the images still on their way, then free the
+	// framebuffers and buffers and stop the encoding threads
+	void Destroy();
+	bool IsCreated() const { return(m_multisampleFramebuffer != 0); }
+
+	int GetWidth() const { return(m_width); }
+	int GetHeight() const { return(m_height); }
+
+	// draw into the offscreen image from here on, cleared to
+	// the passed in color - calling it again starts the image
+	// over
+	void BeginImage(const glm::vec4& clearColor);
+	// resolve the image and start reading it back, to be
+	// written to the passed in PNG file once it has arrived,
+	// and go back to drawing into the window
+	void EndImage(const std::string& imageFilename);
+	// wait until every image has been read back and written,
+	// returning the number of files written so far
+	int Finish();
+
+	int GetWrittenCount() const { return(m_writtenCount.load()); }
+	int GetFailedCount() const { return(m_failedCount.load()); }
+
+private:
+	// one pixel pack buffer and the image being read into it
+	struct READBACK_SLOT
+	{
+		GpuBuffer buffer;
+		GLsync fence;
+		std::string imageFilename;
+	};
+
+	// read back image waiting for an encoding thread, in rows
+	// from the bottom up as OpenGL returns them
+	struct ENCODE_JOB
+	{
+		std::vector<unsigned char> pixels;
+		int width;
+		int height;
+		std::string imageFilename;
+	};
+
+	int m_width;
+	int m_height;
+	int m_sampleCount;
+	// multisampled image the scene is drawn into, and the
+	// single sampled image it is resolved into for reading
+	GLuint m_multisampleFramebuffer;
+	GLuint m_resolveFramebuffer;
+	GpuTexture m_colorTexture;
+	GpuTexture m_depthTexture;
+	GpuTexture m_resolveTexture;
+	// window framebuffer and viewport to go back to after the
+	// image, saved by the first BeginImage() of an image
+	GLint m_savedFramebuffer;
+	GLint m_savedViewport[4];
+	bool m_bInImage;
+
+	READBACK_SLOT m_slots[READBACK_SLOT_COUNT];
+	int m_nextSlot;
+
+	// encoding threads and the queue they share with the GL thread
+	std::vector<std::thread> m_encoders;
+	std::mutex m_queueMutex;
+	std::condition_variable m_jobReady;
+	std::condition_variable m_jobDone;
+	std::deque<ENCODE_JOB> m_encodeJobs;
+	// jobs taken from the queue and not written yet
+	int m_activeCount;
+	bool m_bStopEncoders;
+	std::atomic<int> m_writtenCount;
+	std::atomic<int> m_failedCount;
+
+	// copy a read back image out of its buffer once its fence
+	// has passed, waiting for it when asked to, and queue it
+	// for encoding - false while it is still on its way
+	bool CollectReadback(int slotIndex, bool bWait);
+	// main function of the encoding threads
+	void EncoderLoop();
+	// write RGBA rows, bottom row first, into an RGB PNG file
+	static bool WritePNG(const std::string& filename, const unsigned char* pPixels, int width, int height);
+};
@@ -0,0 +1,241 @@
+///////////////////////////////////////////////////////////////////////////////
+// staticgeometry.cpp
+// ============
+// bake the objects that never move into merged vertex buffers
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "StaticGeometry.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+
+// declaration of the global variables
+namespace
+{
+	// width of the square chunks of the floor plane that the
+	// objects are merged by, so a batch never spans much more
+	// than one chunk unless one of its objects does
+	const float g_ChunkSize = 16.0f;
+}
+
+/***********************************************************
+ *  StaticGeometry()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+StaticGeometry::StaticGeometry()
+{
+	m_bMeshDataBuilt = false;
+}
+
+/***********************************************************
+ *  Build()
+ *
+ *  This method is used for baking the passed in objects. The
+ *  objects are grouped by texture slot and by the chunk of
+ *  the floor plane their origin stands in, and every vertex is
+ *  transformed into world space with the object's model
+ *  matrix, its normal with the inverse transpose, and its
+ *  texture coordinate scaled by the object's UV scale. The
+ *  arena keeps its buffers from the last build, so baking
+ *  the same objects again allocates nothing on the GPU.
+ ***********************************************************/
+void StaticGeometry::Build(const std::vector<STATIC_OBJECT>& objects)
+{
+	m_batches.clear();
+	if (m_arena.IsCreated() == false)
+	{
+		// the model matrix and UV scale attributes stay
+		// disabled, so the shader reads the values set by
+		// BeginDraw() for every vertex
+		const GeometryArena::VERTEX_ATTRIBUTE attributes[] =
+		{
+			{ 0, 3, GL_FLOAT, false, false, offsetof(STATIC_VERTEX, position) },
+			{ 1, 3, GL_FLOAT, false, false, offsetof(STATIC_VERTEX, normal) },
+			{ 2, 2, GL_FLOAT, false, false, offsetof(STATIC_VERTEX, textureCoordinate) },
+			{ 7, 4, GL_FLOAT, false, false, offsetof(STATIC_VERTEX, color) },
+			{ 9, 2, GL_INT, true, false, offsetof(STATIC_VERTEX, materialIndex) },
+		};
+		m_arena.Create(sizeof(STATIC_VERTEX), attributes, 5);
+	}
+	m_arena.Reset();
+
+	if (m_bMeshDataBuilt == false)
+	{
+		for (int i = 0; i < MESH_COUNT; i++)
+		{
+			PrimitiveGeometry::BuildMesh((MESH_TYPE)i, m_meshData[i]);
+			PrimitiveGeometry::OptimizeVertexCache(m_meshData[i]);
+		}
+		m_bMeshDataBuilt = true;
+	}
+
+	// chunk of every object, from the translation of its
+	// model matrix
+	std::vector<glm::ivec2> chunks(objects.size());
+	for (int i = 0; i < objects.size(); i++)
+	{
+		const glm::vec4& origin = objects[i].model[3];
+		chunks[i] = glm::ivec2(
+			(int)std::floor(origin.x / g_ChunkSize),
+			(int)std::floor(origin.z / g_ChunkSize));
+	}
+
+	// visit the objects in texture slot and chunk order,
+	// keeping the recorded order within each batch
+	std::vector<int> order(objects.size());
+	for (int i = 0; i < objects.size(); i++)
+	{
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(),
+		[&objects, &chunks](int a, int b)
+		{
+			if (objects[a].textureSlot != objects[b].textureSlot)
+			{
+				return(objects[a].textureSlot < objects[b].textureSlot);
+			}
+			if (chunks[a].x != chunks[b].x)
+			{
+				return(chunks[a].x < chunks[b].x);
+			}
+			return(chunks[a].y < chunks[b].y);
+		});
+
+	std::vector<STATIC_VERTEX> vertices;
+	std::vector<uint32_t> indices;
+	int start = 0;
+	while (start < order.size())
+	{
+		int textureSlot = objects[order[start]].textureSlot;
+		glm::ivec2 chunk = chunks[order[start]];
+
+		STATIC_BATCH batch;
+		batch.textureSlot = textureSlot;
+		batch.objectCount = 0;
+		batch.boundsMin = glm::vec3(FLT_MAX);
+		batch.boundsMax = glm::vec3(-FLT_MAX);
+		vertices.clear();
+		indices.clear();
+
+		int end = start;
+		while ((end < order.size()) &&
+			(objects[order[end]].textureSlot == textureSlot) &&
+			(chunks[order[end]] == chunk))
+		{
+			const STATIC_OBJECT& object = objects[order[end]];
+			const PrimitiveGeometry::MESH_DATA& data = m_meshData[object.mesh];
+			glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(object.model)));
+			uint32_t baseVertex = (uint32_t)vertices.size();
+
+			for (int i = 0; i < data.vertices.size(); i++)
+			{
+				const PrimitiveGeometry::VERTEX& source = data.vertices[i];
+
+				STATIC_VERTEX vertex;
+				vertex.position = glm::vec3(object.model * glm::vec4(source.position, 1.0f));
+				vertex.normal = normalMatrix * source.normal;
+				vertex.textureCoordinate = source.textureCoordinate * object.uvScale;
+				vertex.color = object.color;
+				vertex.materialIndex = object.materialIndex;
+				vertex.textureLayer = BATCH_TEXTURE_LAYER;
+				vertices.push_back(vertex);
+
+				batch.boundsMin = glm::min(batch.boundsMin, vertex.position);
+				batch.boundsMax = glm::max(batch.boundsMax, vertex.position);
+			}
+			for (int i = 0; i < data.indices.size(); i++)
+			{
+				indices.push_back(baseVertex + data.indices[i]);
+			}
+			batch.objectCount++;
+			end++;
+		}
+
+		batch.range = m_arena.Add(
+			vertices.data(), (GLuint)vertices.size(),
+			indices.data(), (GLuint)indices.size());
+		m_batches.push_back(batch);
+		start = end;
+	}
+}
+
+/***********************************************************
+ *  Destroy()
+ *
+ *  This method is used for freeing the batches and the
+ *  arena holding them.
+ ***********************************************************/
+void StaticGeometry::Destroy()
+{
+	m_batches.clear();
+	m_arena.Destroy();
+}
+
+/***********************************************************
+ *  GetBatchBounds()
+ *
+ *  This method is used for getting the world space box
+ *  around every object of a batch.
+ ***********************************************************/
+void StaticGeometry::GetBatchBounds(int batch, glm::vec3& boundsMin, glm::vec3& boundsMax) const
+{
+	boundsMin = m_batches[batch].boundsMin;
+	boundsMax = m_batches[batch].boundsMax;
+}
+
+/***********************************************************
+ *  BeginDraw()
+ *
+ *  This method is used for binding the vertex array of the
+ *  batches and setting the values of the attributes that
+ *  the baked vertices leave out - an identity model matrix
+ *  and a UV scale of one, as the vertices are already in
+ *  world space with scaled texture coordinates.
+ ***********************************************************/
+void StaticGeometry::BeginDraw()
+{
+	m_arena.Bind();
+	glVertexAttrib4f(3, 1.0f, 0.0f, 0.0f, 0.0f);
+	glVertexAttrib4f(4, 0.0f, 1.0f, 0.0f, 0.0f);
+	glVertexAttrib4f(5, 0.0f, 0.0f, 1.0f, 0.0f);
+	glVertexAttrib4f(6, 0.0f, 0.0f, 0.0f, 1.0f);
+	glVertexAttrib2f(8, 1.0f, 1.0f);
+}
+
+/***********************************************************
+ *  EndDraw()
+ *
+ *  This method is used for unbinding the vertex array of the
+ *  batches once they are drawn.
+ ***********************************************************/
+void StaticGeometry::EndDraw()
+{
+	glBindVertexArray(0);
+}
+
+/***********************************************************
+ *  DrawBatch()
+ *
+ *  This method is used for drawing all the objects of a
+ *  batch with one draw call from its range of the arena.
+ *  BeginDraw() has to be called first.
+ ***********************************************************/
+void StaticGeometry::DrawBatch(int batch)
+{
+	if ((batch < 0) || (batch >= m_batches.size()))
+	{
+		return;
+	}
+
+	const GeometryArena::ARENA_RANGE& range = m_batches[batch].range;
+	glDrawElementsBaseVertex(
+		GL_TRIANGLES,
+		range.indexCount,
+		GL_UNSIGNED_INT,
+		GeometryArena::GetIndexOffset(range),
+		range.baseVertex);
+}
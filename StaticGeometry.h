@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////
+// staticgeometry.h
+// ============
+// bake the objects that never move into merged vertex buffers
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GeometryArena.h"
+#include "PrimitiveGeometry.h"
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+/***********************************************************
+ *  StaticGeometry
+ *
+ *  This class pre-transforms the basic shapes of objects
+ *  that never move into world space, and merges the objects
+ *  that sample the same texture and stand in the same chunk
+ *  of the floor into one batch, so each batch is drawn with
+ *  a single call and the chunks outside a view can still be
+ *  skipped. All the batches are
+ *  ranges of one geometry arena and share its vertex array.
+ *  The color and material index of every object are stored
+ *  per vertex at the shader attribute locations the
+ *  instanced path reads per instance. The texture unit and
+ *  layer are looked up for the batch when it is drawn, so
+ *  the streaming of textures never needs a new bake.
+ ***********************************************************/
+class StaticGeometry
+{
+public:
+	// constructor
+	StaticGeometry();
+
+	// render values of one object to bake
+	struct STATIC_OBJECT
+	{
+		MESH_TYPE mesh;
+		glm::mat4 model;
+		glm::vec4 color;
+		glm::vec2 uvScale;
+		int materialIndex;
+		// texture slot, -1 for untextured
+		int textureSlot;
+	};
+
+	// baked vertex layout - matches the shader attribute
+	// locations 0 = position, 1 = normal, 2 = pre-scaled
+	// texture coordinate, 7 = color and 9 = material index
+	// and texture layer, which is always BATCH_TEXTURE_LAYER
+	struct STATIC_VERTEX
+	{
+		glm::vec3 position;
+		glm::vec3 normal;
+		glm::vec2 textureCoordinate;
+		glm::vec4 color;
+		int32_t materialIndex;
+		int32_t textureLayer;
+	};
+
+	// texture layer of the baked vertices, telling the shader
+	// to take the layer of the batch from its uniform
+	static const int32_t BATCH_TEXTURE_LAYER = -1;
+
+	// replace the batches with the passed in objects merged
+	// by texture and chunk
+	void Build(const std::vector<STATIC_OBJECT>& objects);
+	// free the batches
+	void Destroy();
+
+	int GetBatchCount() const { return((int)m_batches.size()); }
+	// texture slot sampled by a batch, or -1 for untextured
+	int GetBatchTextureSlot(int batch) const { return(m_batches[batch].textureSlot); }
+	// number of objects merged into a batch
+	int GetBatchObjectCount(int batch) const { return(m_batches[batch].objectCount); }
+	// world space box around every object of a batch
+	void GetBatchBounds(int batch, glm::vec3& boundsMin, glm::vec3& boundsMax) const;
+	// bind the vertex array of the batches and set the shader
+	// attributes the baked vertices leave out, before drawing
+	// any batch, and unbind it once they are drawn
+	void BeginDraw();
+	void EndDraw();
+	// draw all the objects of a batch with one call
+	void DrawBatch(int batch);
+
+private:
+	struct STATIC_BATCH
+	{
+		GeometryArena::ARENA_RANGE range;
+		int textureSlot;
+		int objectCount;
+		glm::vec3 boundsMin;
+		glm::vec3 boundsMax;
+	};
+
+	std::vector<STATIC_BATCH> m_batches;
+	// baked vertices and indices of every batch
+	GeometryArena m_arena;
+	// object space mesh data of the basic shapes, built once
+	PrimitiveGeometry::MESH_DATA m_meshData[MESH_COUNT];
+	bool m_bMeshDataBuilt;
+};
@@ -0,0 +1,88 @@
+///////////////////////////////////////////////////////////////////////////////
+// tagregistry.cpp
+// ============
+// resolve string tags to compact integer handles
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "TagRegistry.h"
+
+/***********************************************************
+ *  Register()
+ *
+ *  This method is used for registering the passed in tag and
+ *  returning its handle. Tags that are already registered
+ *  keep the handle they were first given.
+ ***********************************************************/
+int TagRegistry::Register(const std::string& tag)
+{
+	std::unordered_map<std::string, int>::const_iterator found = m_handles.find(tag);
+	if (found != m_handles.end())
+	{
+		return(found->second);
+	}
+
+	int handle = (int)m_tags.size();
+	m_handles[tag] = handle;
+	m_tags.push_back(tag);
+
+	return(handle);
+}
+
+/***********************************************************
+ *  Find()
+ *
+ *  This method is used for getting the handle of the passed
+ *  in tag, or INVALID_HANDLE when it was never registered.
+ ***********************************************************/
+int TagRegistry::Find(const std::string& tag) const
+{
+	std::unordered_map<std::string, int>::const_iterator found = m_handles.find(tag);
+	if (found == m_handles.end())
+	{
+		return(INVALID_HANDLE);
+	}
+
+	return(found->second);
+}
+
+/***********************************************************
+ *  GetTag()
+ *
+ *  This method is used for getting the tag associated with
+ *  the passed in handle.
+ ***********************************************************/
+const std::string& TagRegistry::GetTag(int handle) const
+{
+	static const std::string emptyTag;
+
+	if (IsValid(handle) == false)
+	{
+		return(emptyTag);
+	}
+
+	return(m_tags[handle]);
+}
+
+/***********************************************************
+ *  IsValid()
+ *
+ *  This method is used for checking whether the passed in
+ *  handle belongs to a registered tag.
+ ***********************************************************/
+bool TagRegistry::IsValid(int handle) const
+{
+	return((handle >= 0) && (handle < (int)m_tags.size()));
+}
+
+/***********************************************************
+ *  Clear()
+ *
+ *  This method is used for removing all of the registered
+ *  tags.
+ ***********************************************************/
+void TagRegistry::Clear()
+{
+	m_handles.clear();
+	m_tags.clear();
+}
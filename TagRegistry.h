@@ -0,0 +1,47 @@
+///////////////////////////////////////////////////////////////////////////////
+// tagregistry.h
+// ============
+// resolve string tags to compact integer handles
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/***********************************************************
+ *  TagRegistry
+ *
+ *  This class hands out compact integer handles for string
+ *  tags, in the order they are registered. The lookups are
+ *  meant to happen while a scene is being built, so that
+ *  only the handles are used while rendering.
+ ***********************************************************/
+class TagRegistry
+{
+public:
+	// handle returned for tags that were never registered
+	static const int INVALID_HANDLE = -1;
+
+	// register a tag and get its handle - an already
+	// registered tag keeps its original handle
+	int Register(const std::string& tag);
+	// find the handle of a registered tag
+	int Find(const std::string& tag) const;
+	// get the tag associated with a handle
+	const std::string& GetTag(int handle) const;
+	// true when the handle belongs to a registered tag
+	bool IsValid(int handle) const;
+	// total number of registered tags
+	int Count() const { return((int)m_tags.size()); }
+	// remove all of the registered tags
+	void Clear();
+
+private:
+	// handle for each registered tag
+	std::unordered_map<std::string, int> m_handles;
+	// registered tags indexed by handle
+	std::vector<std::string> m_tags;
+};
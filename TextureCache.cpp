@@ -0,0 +1,575 @@
+///////////////////////////////////////////////////////////////////////////////
+// texturecache.cpp
+// ============
+// convert texture images to block compressed mip chains and cache them
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "TextureCache.h"
+
+#include <GL/glew.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+// declaration of the global variables
+namespace
+{
+	const char g_CacheMagic[4] = { 'T', 'X', 'C', '1' };
+	const uint32_t g_CacheVersion = 1;
+	// alignment of the image data inside a cache file
+	const uint32_t g_DataAlignment = 16;
+
+	// fixed size header at the start of every cache file
+	struct CACHE_HEADER
+	{
+		char magic[4];
+		uint32_t version;
+		uint32_t format;
+		uint32_t width;
+		uint32_t height;
+		uint32_t levelCount;
+		uint64_t sourceModifiedTime;
+		uint64_t sourceSize;
+		uint32_t pathLength;
+		uint32_t dataOffset;
+	};
+
+	std::string g_CacheDirectory = "texture_cache";
+	// serializes writes so two workers never share a temporary file
+	std::mutex g_SaveMutex;
+
+	/***********************************************************
+	 *  GetSourceInfo()
+	 *
+	 *  This function gets the modified time and size of a
+	 *  source image file.
+	 ***********************************************************/
+	bool GetSourceInfo(const std::string& filename, uint64_t& modifiedTime, uint64_t& size)
+	{
+#ifdef _WIN32
+		struct _stat64 info;
+		if (_stat64(filename.c_str(), &info) != 0)
+		{
+			return(false);
+		}
+#else
+		struct stat info;
+		if (stat(filename.c_str(), &info) != 0)
+		{
+			return(false);
+		}
+#endif
+		modifiedTime = (uint64_t)info.st_mtime;
+		size = (uint64_t)info.st_size;
+		return(true);
+	}
+
+	/***********************************************************
+	 *  MakeDirectory()
+	 *
+	 *  This function creates a directory if it does not
+	 *  already exist.
+	 ***********************************************************/
+	void MakeDirectory(const std::string& directory)
+	{
+#ifdef _WIN32
+		_mkdir(directory.c_str());
+#else
+		mkdir(directory.c_str(), 0755);
+#endif
+	}
+
+	/***********************************************************
+	 *  PackColor565()
+	 *
+	 *  This function packs an 8 bit per channel color into
+	 *  the 5:6:5 format used by BC1 endpoints.
+	 ***********************************************************/
+	uint16_t PackColor565(const unsigned char* color)
+	{
+		return((uint16_t)(((color[0] >> 3) << 11) | ((color[1] >> 2) << 5) | (color[2] >> 3)));
+	}
+
+	/***********************************************************
+	 *  UnpackColor565()
+	 *
+	 *  This function expands a 5:6:5 color back to 8 bits
+	 *  per channel, the way the hardware decodes it.
+	 ***********************************************************/
+	void UnpackColor565(uint16_t packed, int* color)
+	{
+		int red = (packed >> 11) & 0x1F;
+		int green = (packed >> 5) & 0x3F;
+		int blue = packed & 0x1F;
+		color[0] = (red << 3) | (red >> 2);
+		color[1] = (green << 2) | (green >> 4);
+		color[2] = (blue << 3) | (blue >> 2);
+	}
+}
+
+/***********************************************************
+ *  COMPRESSED_IMAGE::GetData()
+ *
+ *  This method returns the start of the image data, either
+ *  the owned copy or the mapped cache file.
+ ***********************************************************/
+const unsigned char* TextureCache::COMPRESSED_IMAGE::GetData() const
+{
+	if (pMapping != nullptr)
+	{
+		return(pMapping->GetData() + mappedOffset);
+	}
+	if (ownedData.empty() == true)
+	{
+		return(NULL);
+	}
+	return(ownedData.data());
+}
+
+/***********************************************************
+ *  SetCacheDirectory()
+ *
+ *  This method sets the directory that holds the cache
+ *  files.
+ ***********************************************************/
+void TextureCache::SetCacheDirectory(const std::string& directory)
+{
+	g_CacheDirectory = directory;
+}
+
+/***********************************************************
+ *  GetCachePath()
+ *
+ *  This method builds the cache file path of a source image
+ *  from a 64 bit FNV-1a hash of the source path.
+ ***********************************************************/
+std::string TextureCache::GetCachePath(const std::string& sourceFilename)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < sourceFilename.size(); i++)
+	{
+		hash ^= (unsigned char)sourceFilename[i];
+		hash *= 1099511628211ULL;
+	}
+
+	char name[32];
+	snprintf(name, sizeof(name), "%016llx", (unsigned long long)hash);
+	return(g_CacheDirectory + "/" + name + ".texcache");
+}
+
+/***********************************************************
+ *  Load()
+ *
+ *  This method maps the cache file of a source image and
+ *  validates it against the source modified time and size.
+ ***********************************************************/
+bool TextureCache::Load(const std::string& sourceFilename, COMPRESSED_IMAGE& image)
+{
+	uint64_t modifiedTime = 0;
+	uint64_t sourceSize = 0;
+	if (GetSourceInfo(sourceFilename, modifiedTime, sourceSize) == false)
+	{
+		return(false);
+	}
+
+	std::shared_ptr<MappedFile> pMapping = std::make_shared<MappedFile>();
+	if (pMapping->Open(GetCachePath(sourceFilename)) == false)
+	{
+		return(false);
+	}
+
+	const unsigned char* pData = pMapping->GetData();
+	size_t fileSize = pMapping->GetSize();
+	if (fileSize < sizeof(CACHE_HEADER))
+	{
+		return(false);
+	}
+
+	CACHE_HEADER header;
+	memcpy(&header, pData, sizeof(header));
+	if ((memcmp(header.magic, g_CacheMagic, sizeof(g_CacheMagic)) != 0) ||
+		(header.version != g_CacheVersion) ||
+		(header.sourceModifiedTime != modifiedTime) ||
+		(header.sourceSize != sourceSize) ||
+		(header.levelCount == 0))
+	{
+		return(false);
+	}
+
+	// the stored path guards against hash collisions
+	size_t levelTableOffset = sizeof(CACHE_HEADER) + header.pathLength;
+	size_t levelTableSize = header.levelCount * sizeof(MIP_LEVEL);
+	if ((levelTableOffset + levelTableSize > fileSize) ||
+		(header.dataOffset > fileSize) ||
+		(sourceFilename.compare(0, std::string::npos,
+			(const char*)pData + sizeof(CACHE_HEADER), header.pathLength) != 0))
+	{
+		return(false);
+	}
+
+	image.levels.resize(header.levelCount);
+	memcpy(image.levels.data(), pData + levelTableOffset, levelTableSize);
+
+	size_t dataSize = fileSize - header.dataOffset;
+	for (size_t i = 0; i < image.levels.size(); i++)
+	{
+		if ((size_t)image.levels[i].offset + image.levels[i].size > dataSize)
+		{
+			return(false);
+		}
+	}
+
+	image.format = header.format;
+	image.width = header.width;
+	image.height = header.height;
+	image.ownedData.clear();
+	image.pMapping = pMapping;
+	image.mappedOffset = header.dataOffset;
+	image.dataSize = dataSize;
+
+	return(true);
+}
+
+/***********************************************************
+ *  Save()
+ *
+ *  This method writes the cache file of a source image. The
+ *  file is written under a temporary name and renamed so a
+ *  partial file is never picked up.
+ ***********************************************************/
+bool TextureCache::Save(const std::string& sourceFilename, const COMPRESSED_IMAGE& image)
+{
+	CACHE_HEADER header;
+	memcpy(header.magic, g_CacheMagic, sizeof(g_CacheMagic));
+	header.version = g_CacheVersion;
+	header.format = image.format;
+	header.width = image.width;
+	header.height = image.height;
+	header.levelCount = (uint32_t)image.levels.size();
+	if (GetSourceInfo(sourceFilename, header.sourceModifiedTime, header.sourceSize) == false)
+	{
+		return(false);
+	}
+	header.pathLength = (uint32_t)sourceFilename.size();
+
+	uint32_t tableEnd = (uint32_t)(sizeof(CACHE_HEADER) + header.pathLength +
+		header.levelCount * sizeof(MIP_LEVEL));
+	header.dataOffset = (tableEnd + g_DataAlignment - 1) & ~(g_DataAlignment - 1);
+
+	std::lock_guard<std::mutex> lock(g_SaveMutex);
+
+	MakeDirectory(g_CacheDirectory);
+	std::string cachePath = GetCachePath(sourceFilename);
+	std::string tempPath = cachePath + ".tmp";
+
+	FILE* pFile = fopen(tempPath.c_str(), "wb");
+	if (pFile == NULL)
+	{
+		std::cout << "Could not write texture cache file:" << tempPath << std::endl;
+		return(false);
+	}
+
+	const char padding[g_DataAlignment] = { 0 };
+	bool bSuccess =
+		(fwrite(&header, sizeof(header), 1, pFile) == 1) &&
+		(fwrite(sourceFilename.data(), 1, header.pathLength, pFile) == header.pathLength) &&
+		(fwrite(image.levels.data(), sizeof(MIP_LEVEL), header.levelCount, pFile) == header.levelCount) &&
+		(fwrite(padding, 1, header.dataOffset - tableEnd, pFile) == header.dataOffset - tableEnd) &&
+		(fwrite(image.GetData(), 1, image.dataSize, pFile) == image.dataSize);
+	fclose(pFile);
+
+	if (bSuccess == true)
+	{
+		remove(cachePath.c_str());
+		bSuccess = (rename(tempPath.c_str(), cachePath.c_str()) == 0);
+	}
+	if (bSuccess == false)
+	{
+		remove(tempPath.c_str());
+		std::cout << "Could not write texture cache file:" << cachePath << std::endl;
+	}
+
+	return(bSuccess);
+}
+
+/***********************************************************
+ *  Compress()
+ *
+ *  This method builds the box filtered mip chain of a 3 or 4
+ *  channel image and block compresses every level - BC1 for
+ *  RGB images and BC3 for RGBA images.
+ ***********************************************************/
+bool TextureCache::Compress(
+	const unsigned char* pixels,
+	int width,
+	int height,
+	int colorChannels,
+	COMPRESSED_IMAGE& image)
+{
+	if ((pixels == NULL) || (width <= 0) || (height <= 0) ||
+		((colorChannels != 3) && (colorChannels != 4)))
+	{
+		return(false);
+	}
+
+	bool bAlpha = (colorChannels == 4);
+	size_t blockBytes = (bAlpha == true) ? 16 : 8;
+
+	image.format = (bAlpha == true) ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+	image.width = (uint32_t)width;
+	image.height = (uint32_t)height;
+	image.levels.clear();
+	image.ownedData.clear();
+	image.pMapping.reset();
+	image.mappedOffset = 0;
+
+	// expand the top level to RGBA so every level is encoded
+	// from the same layout
+	std::vector<unsigned char> level((size_t)width * height * 4);
+	for (size_t i = 0; i < (size_t)width * height; i++)
+	{
+		level[i * 4 + 0] = pixels[i * colorChannels + 0];
+		level[i * 4 + 1] = pixels[i * colorChannels + 1];
+		level[i * 4 + 2] = pixels[i * colorChannels + 2];
+		level[i * 4 + 3] = (bAlpha == true) ? pixels[i * colorChannels + 3] : 255;
+	}
+
+	int levelWidth = width;
+	int levelHeight = height;
+	std::vector<unsigned char> nextLevel;
+	while (true)
+	{
+		int blocksWide = (levelWidth + 3) / 4;
+		int blocksHigh = (levelHeight + 3) / 4;
+
+		MIP_LEVEL mip;
+		mip.width = (uint32_t)levelWidth;
+		mip.height = (uint32_t)levelHeight;
+		mip.offset = (uint32_t)image.ownedData.size();
+		mip.size = (uint32_t)(blocksWide * blocksHigh * blockBytes);
+		image.levels.push_back(mip);
+		image.ownedData.resize(image.ownedData.size() + mip.size);
+
+		unsigned char* pOutput = image.ownedData.data() + mip.offset;
+		for (int blockY = 0; blockY < blocksHigh; blockY++)
+		{
+			for (int blockX = 0; blockX < blocksWide; blockX++)
+			{
+				// gather the block, clamping at the edges of
+				// levels that are not a multiple of four
+				unsigned char block[16][4];
+				for (int y = 0; y < 4; y++)
+				{
+					int sourceY = std::min(blockY * 4 + y, levelHeight - 1);
+					for (int x = 0; x < 4; x++)
+					{
+						int sourceX = std::min(blockX * 4 + x, levelWidth - 1);
+						memcpy(block[y * 4 + x],
+							&level[((size_t)sourceY * levelWidth + sourceX) * 4], 4);
+					}
+				}
+
+				if (bAlpha == true)
+				{
+					EncodeAlphaBlock(block, pOutput);
+					pOutput += 8;
+				}
+				EncodeColorBlock(block, pOutput);
+				pOutput += 8;
+			}
+		}
+
+		if ((levelWidth == 1) && (levelHeight == 1))
+		{
+			break;
+		}
+
+		Downsample(level, levelWidth, levelHeight, nextLevel);
+		level.swap(nextLevel);
+		levelWidth = std::max(1, levelWidth / 2);
+		levelHeight = std::max(1, levelHeight / 2);
+	}
+
+	image.dataSize = image.ownedData.size();
+
+	return(true);
+}
+
+/***********************************************************
+ *  EncodeColorBlock()
+ *
+ *  This method encodes a block as BC1 using the inset
+ *  bounding box of its colors as the two endpoints and the
+ *  four color palette.
+ ***********************************************************/
+void TextureCache::EncodeColorBlock(const unsigned char block[16][4], unsigned char* pOutput)
+{
+	unsigned char minColor[3] = { 255, 255, 255 };
+	unsigned char maxColor[3] = { 0, 0, 0 };
+	for (int i = 0; i < 16; i++)
+	{
+		for (int channel = 0; channel < 3; channel++)
+		{
+			minColor[channel] = std::min(minColor[channel], block[i][channel]);
+			maxColor[channel] = std::max(maxColor[channel], block[i][channel]);
+		}
+	}
+
+	// pull the endpoints in by a sixteenth of the range, which
+	// lowers the error of the interpolated palette entries
+	for (int channel = 0; channel < 3; channel++)
+	{
+		int inset = (maxColor[channel] - minColor[channel]) >> 4;
+		minColor[channel] = (unsigned char)std::min(255, minColor[channel] + inset);
+		maxColor[channel] = (unsigned char)std::max(0, maxColor[channel] - inset);
+	}
+
+	// the max endpoint packs to a value no smaller than the
+	// min endpoint, which selects the four color mode
+	uint16_t color0 = PackColor565(maxColor);
+	uint16_t color1 = PackColor565(minColor);
+	uint32_t indices = 0;
+
+	if (color0 != color1)
+	{
+		int palette[4][3];
+		UnpackColor565(color0, palette[0]);
+		UnpackColor565(color1, palette[1]);
+		for (int channel = 0; channel < 3; channel++)
+		{
+			palette[2][channel] = (2 * palette[0][channel] + palette[1][channel]) / 3;
+			palette[3][channel] = (palette[0][channel] + 2 * palette[1][channel]) / 3;
+		}
+
+		for (int i = 0; i < 16; i++)
+		{
+			int bestIndex = 0;
+			int bestDistance = 0x7FFFFFFF;
+			for (int entry = 0; entry < 4; entry++)
+			{
+				int distance = 0;
+				for (int channel = 0; channel < 3; channel++)
+				{
+					int delta = block[i][channel] - palette[entry][channel];
+					distance += delta * delta;
+				}
+				if (distance < bestDistance)
+				{
+					bestDistance = distance;
+					bestIndex = entry;
+				}
+			}
+			indices |= (uint32_t)bestIndex << (i * 2);
+		}
+	}
+
+	pOutput[0] = (unsigned char)(color0 & 0xFF);
+	pOutput[1] = (unsigned char)(color0 >> 8);
+	pOutput[2] = (unsigned char)(color1 & 0xFF);
+	pOutput[3] = (unsigned char)(color1 >> 8);
+	pOutput[4] = (unsigned char)(indices & 0xFF);
+	pOutput[5] = (unsigned char)((indices >> 8) & 0xFF);
+	pOutput[6] = (unsigned char)((indices >> 16) & 0xFF);
+	pOutput[7] = (unsigned char)(indices >> 24);
+}
+
+/***********************************************************
+ *  EncodeAlphaBlock()
+ *
+ *  This method encodes the alpha of a block as BC3 alpha,
+ *  with the alpha range as endpoints and the eight value
+ *  interpolated palette.
+ ***********************************************************/
+void TextureCache::EncodeAlphaBlock(const unsigned char block[16][4], unsigned char* pOutput)
+{
+	int alpha0 = 0;
+	int alpha1 = 255;
+	for (int i = 0; i < 16; i++)
+	{
+		alpha0 = std::max(alpha0, (int)block[i][3]);
+		alpha1 = std::min(alpha1, (int)block[i][3]);
+	}
+
+	int palette[8];
+	palette[0] = alpha0;
+	palette[1] = alpha1;
+	for (int entry = 2; entry < 8; entry++)
+	{
+		palette[entry] = ((8 - entry) * alpha0 + (entry - 1) * alpha1) / 7;
+	}
+
+	uint64_t indices = 0;
+	if (alpha0 != alpha1)
+	{
+		for (int i = 0; i < 16; i++)
+		{
+			int bestIndex = 0;
+			int bestDistance = 256;
+			for (int entry = 0; entry < 8; entry++)
+			{
+				int distance = std::abs(block[i][3] - palette[entry]);
+				if (distance < bestDistance)
+				{
+					bestDistance = distance;
+					bestIndex = entry;
+				}
+			}
+			indices |= (uint64_t)bestIndex << (i * 3);
+		}
+	}
+
+	pOutput[0] = (unsigned char)alpha0;
+	pOutput[1] = (unsigned char)alpha1;
+	for (int i = 0; i < 6; i++)
+	{
+		pOutput[2 + i] = (unsigned char)((indices >> (i * 8)) & 0xFF);
+	}
+}
+
+/***********************************************************
+ *  Downsample()
+ *
+ *  This method halves an RGBA image with a 2x2 box filter,
+ *  repeating the last row or column of odd sized levels.
+ ***********************************************************/
+void TextureCache::Downsample(
+	const std::vector<unsigned char>& source,
+	int width,
+	int height,
+	std::vector<unsigned char>& destination)
+{
+	int halfWidth = std::max(1, width / 2);
+	int halfHeight = std::max(1, height / 2);
+	destination.resize((size_t)halfWidth * halfHeight * 4);
+
+	for (int y = 0; y < halfHeight; y++)
+	{
+		int y0 = std::min(y * 2, height - 1);
+		int y1 = std::min(y * 2 + 1, height - 1);
+		for (int x = 0; x < halfWidth; x++)
+		{
+			int x0 = std::min(x * 2, width - 1);
+			int x1 = std::min(x * 2 + 1, width - 1);
+			for (int channel = 0; channel < 4; channel++)
+			{
+				int sum =
+					source[((size_t)y0 * width + x0) * 4 + channel] +
+					source[((size_t)y0 * width + x1) * 4 + channel] +
+					source[((size_t)y1 * width + x0) * 4 + channel] +
+					source[((size_t)y1 * width + x1) * 4 + channel];
+				destination[((size_t)y * halfWidth + x) * 4 + channel] = (unsigned char)((sum + 2) / 4);
+			}
+		}
+	}
+}
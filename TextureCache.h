@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////
+// texturecache.h
+// ============
+// convert texture images to block compressed mip chains and cache them
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "MappedFile.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/***********************************************************
+ *  TextureCache
+ *
+ *  This class converts decoded texture images into BC1 (RGB)
+ *  or BC3 (RGBA) block compressed mip chains, and keeps them
+ *  in cache files keyed by the source image path. A cache
+ *  file is only used while the modified time and size of its
+ *  source image still match, and it is mapped into memory so
+ *  the mip data can be uploaded in place.
+ ***********************************************************/
+class TextureCache
+{
+public:
+	// one mip level of a compressed image
+	struct MIP_LEVEL
+	{
+		uint32_t width;
+		uint32_t height;
+		// byte offset into the image data
+		uint32_t offset;
+		uint32_t size;
+	};
+
+	// block compressed image with its whole mip chain
+	struct COMPRESSED_IMAGE
+	{
+		// OpenGL compressed internal format
+		uint32_t format;
+		uint32_t width;
+		uint32_t height;
+		std::vector<MIP_LEVEL> levels;
+		// the image data is either owned here or read in place
+		// from a mapped cache file
+		std::vector<unsigned char> ownedData;
+		std::shared_ptr<MappedFile> pMapping;
+		size_t mappedOffset;
+		size_t dataSize;
+
+		const unsigned char* GetData() const;
+	};
+
+	// set the directory that holds the cache files - must be
+	// set before any texture is loaded
+	static void SetCacheDirectory(const std::string& directory);
+	// get the cache file path for a source image
+	static std::string GetCachePath(const std::string& sourceFilename);
+
+	// load the cached image of a source image, returning false
+	// when there is no cache file or it is out of date
+	static bool Load(const std::string& sourceFilename, COMPRESSED_IMAGE& image);
+	// write the cache file of a source image
+	static bool Save(const std::string& sourceFilename, const COMPRESSED_IMAGE& image);
+
+	// compress 3 or 4 channel pixels into a full mip chain
+	static bool Compress(
+		const unsigned char* pixels,
+		int width,
+		int height,
+		int colorChannels,
+		COMPRESSED_IMAGE& image);
+
+private:
+	// encode the colors of a 4x4 block of RGBA pixels as BC1
+	static void EncodeColorBlock(const unsigned char block[16][4], unsigned char* pOutput);
+	// encode the alpha of a 4x4 block of RGBA pixels as BC3 alpha
+	static void EncodeAlphaBlock(const unsigned char block[16][4], unsigned char* pOutput);
+	// halve an RGBA image with a box filter
+	static void Downsample(
+		const std::vector<unsigned char>& source,
+		int width,
+		int height,
+		std::vector<unsigned char>& destination);
+};
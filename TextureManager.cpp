@@ -0,0 +1,1039 @@
+///////////////////////////////////////////////////////////////////////////////
+// texturemanager.cpp
+// ============
+// load scene textures in the background and upload them to the GPU
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "TextureManager.h"
+
+#ifndef STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+// declaration of global variables
+namespace
+{
+	// size of each of the two upload buffer segments - fits
+	// one 2048x2048 RGBA image, or several smaller ones
+	const size_t g_UploadSegmentBytes = 2048 * 2048 * 4;
+	// color shown while a texture is still loading
+	const unsigned char g_PlaceholderColor[4] = { 128, 128, 128, 255 };
+
+	/***********************************************************
+	 *  GetStorageBytes()
+	 *
+	 *  This function estimates the bytes of GPU memory taken by
+	 *  the mip chain of every layer of an array texture. RGB
+	 *  textures are counted at four bytes per texel, the way
+	 *  drivers store them.
+	 ***********************************************************/
+	size_t GetStorageBytes(GLenum internalFormat, int width, int height, int levelCount, int layerCount)
+	{
+		size_t bytes = 0;
+		for (int level = 0; level < levelCount; level++)
+		{
+			size_t levelWidth = std::max(width >> level, 1);
+			size_t levelHeight = std::max(height >> level, 1);
+			size_t blocks = ((levelWidth + 3) / 4) * ((levelHeight + 3) / 4);
+
+			if (internalFormat == GL_COMPRESSED_RGB_S3TC_DXT1_EXT)
+			{
+				bytes += blocks * 8;
+			}
+			else if (internalFormat == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT)
+			{
+				bytes += blocks * 16;
+			}
+			else
+			{
+				bytes += levelWidth * levelHeight * 4;
+			}
+		}
+		return(bytes * layerCount);
+	}
+}
+
+/***********************************************************
+ *  TextureManager()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+TextureManager::TextureManager()
+{
+	m_maxArrayLayers = 0;
+	m_residentBytes = 0;
+	m_pendingCount = 0;
+	m_bInitialized = false;
+	m_bUseTextureCache = false;
+	m_bStopWorkers = false;
+	m_pUploadMemory = NULL;
+	m_currentSegment = 0;
+	for (int i = 0; i < 2; i++)
+	{
+		m_segments[i].offset = i * g_UploadSegmentBytes;
+		m_segments[i].fence = 0;
+	}
+}
+
+/***********************************************************
+ *  ~TextureManager()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+TextureManager::~TextureManager()
+{
+	Shutdown();
+}
+
+/***********************************************************
+ *  Initialize()
+ *
+ *  This method is used for creating the placeholder array
+ *  texture and the persistently mapped upload buffer, and
+ *  starting the decoding threads.
+ ***********************************************************/
+void TextureManager::Initialize(int workerCount)
+{
+	if (m_bInitialized == true)
+	{
+		return;
+	}
+
+	glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &m_maxArrayLayers);
+
+	// the placeholder is the single layer of the first array,
+	// so every slot can be sampled from unit and layer alone
+	TEXTURE_ARRAY placeholder;
+	placeholder.internalFormat = GL_RGBA8;
+	placeholder.width = 1;
+	placeholder.height = 1;
+	placeholder.levelCount = 1;
+	placeholder.layerCount = 1;
+	placeholder.layerCapacity = 1;
+	placeholder.layerSlots.push_back(-1);
+	CreateArrayStorage(placeholder);
+	glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, 1, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, g_PlaceholderColor);
+	m_arrays.push_back(std::move(placeholder));
+	BindTextureUnits();
+
+	// the pixels go through a persistently mapped buffer - if
+	// it can't be mapped they are uploaded straight from the
+	// decoded images
+	GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	m_uploadBuffer.Create(GpuResourceTracker::RESOURCE_UPLOAD_BUFFER);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_uploadBuffer.GetID());
+	glBufferStorage(GL_PIXEL_UNPACK_BUFFER, 2 * g_UploadSegmentBytes, NULL, flags);
+	m_uploadBuffer.SetSize(2 * g_UploadSegmentBytes);
+	m_pUploadMemory = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, 2 * g_UploadSegmentBytes, flags);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	if (NULL == m_pUploadMemory)
+	{
+		std::cout << "Could not map the texture upload buffer" << std::endl;
+		DestroyUploadBuffer();
+	}
+
+	// the extension is checked here because the decoding
+	// threads have no context to query it
+	m_bUseTextureCache = (GLEW_EXT_texture_compression_s3tc == GL_TRUE);
+
+	// the flag is global in stb_image, so it is set once here
+	// before any of the decoding threads start
+	stbi_set_flip_vertically_on_load(true);
+
+	m_bStopWorkers = false;
+	workerCount = std::max(workerCount, 1);
+	for (int i = 0; i < workerCount; i++)
+	{
+		m_workers.push_back(std::thread(&TextureManager::WorkerLoop, this));
+	}
+
+	m_bInitialized = true;
+}
+
+/***********************************************************
+ *  Shutdown()
+ *
+ *  This method is used for stopping the decoding threads and
+ *  freeing every array texture, including the placeholder,
+ *  and the upload buffer.
+ ***********************************************************/
+void TextureManager::Shutdown()
+{
+	if (m_bInitialized == false)
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_bStopWorkers = true;
+		m_decodeJobs.clear();
+	}
+	m_jobReady.notify_all();
+	for (int i = 0; i < m_workers.size(); i++)
+	{
+		m_workers[i].join();
+	}
+	m_workers.clear();
+
+	for (int i = 0; i < m_decodedImages.size(); i++)
+	{
+		stbi_image_free(m_decodedImages[i].pixels);
+	}
+	m_decodedImages.clear();
+
+	// the array textures delete themselves
+	m_arrays.clear();
+	m_textures.clear();
+	m_tags.Clear();
+	m_residentBytes = 0;
+	m_pendingCount = 0;
+
+	DestroyUploadBuffer();
+
+	m_bInitialized = false;
+}
+
+/***********************************************************
+ *  DestroyUploadBuffer()
+ *
+ *  This method is used for unmapping and freeing the pixel
+ *  upload buffer.
+ ***********************************************************/
+void TextureManager::DestroyUploadBuffer()
+{
+	for (int i = 0; i < 2; i++)
+	{
+		if (m_segments[i].fence != 0)
+		{
+			glDeleteSync(m_segments[i].fence);
+			m_segments[i].fence = 0;
+		}
+	}
+
+	if ((m_uploadBuffer.GetID() != 0) && (NULL != m_pUploadMemory))
+	{
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_uploadBuffer.GetID());
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	}
+	m_uploadBuffer.Destroy();
+	m_pUploadMemory = NULL;
+}
+
+/***********************************************************
+ *  RequestTexture()
+ *
+ *  This method is used for reserving the next texture slot
+ *  for the passed in tag and queueing the image file to be
+ *  decoded. The slot is returned straight away, so it can be
+ *  used by the scene before the image is loaded.
+ ***********************************************************/
+int TextureManager::RequestTexture(const char* filename, const std::string& tag)
+{
+	// the slot doubles as the handle for the tag, so every
+	// tag can only be requested once
+	if (m_tags.Find(tag) != TagRegistry::INVALID_HANDLE)
+	{
+		std::cout << "Texture tag already loaded:" << tag << std::endl;
+		return(-1);
+	}
+	if (m_textures.size() >= MAX_TEXTURES)
+	{
+		std::cout << "No texture slot left for image:" << filename << std::endl;
+		return(-1);
+	}
+
+	TEXTURE_RECORD texture;
+	texture.tag = tag;
+	texture.filename = filename;
+	texture.arrayIndex = 0;
+	texture.layer = 0;
+	texture.width = 0;
+	texture.height = 0;
+	texture.levelCount = 0;
+	texture.colorChannels = 0;
+	texture.bCompressed = false;
+	texture.residentLevel = -1;
+	texture.residentBytes = 0;
+	texture.bLoading = false;
+	texture.state = TEXTURE_PENDING;
+
+	int slot = m_tags.Register(tag);
+	m_textures.push_back(texture);
+	QueueLoad(slot, 0);
+
+	return(slot);
+}
+
+/***********************************************************
+ *  QueueLoad()
+ *
+ *  This method is used for queueing the image file of a slot
+ *  to be loaded by the decoding threads.
+ ***********************************************************/
+void TextureManager::QueueLoad(int slot, int firstLevel)
+{
+	m_textures[slot].bLoading = true;
+	m_pendingCount++;
+
+	DECODE_JOB job;
+	job.slot = slot;
+	job.filename = m_textures[slot].filename;
+	job.firstLevel = firstLevel;
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_decodeJobs.push_back(job);
+	}
+	m_jobReady.notify_one();
+}
+
+/***********************************************************
+ *  RequestLevel()
+ *
+ *  This method is used for loading a slot again starting at
+ *  the passed in mip level, either to bring back an evicted
+ *  slot or to change how much detail a resident one keeps.
+ *  Only compressed images carry their mip chain, so raw
+ *  images always reload the full image.
+ ***********************************************************/
+void TextureManager::RequestLevel(int slot, int firstLevel)
+{
+	if ((slot < 0) || (slot >= m_textures.size()))
+	{
+		return;
+	}
+
+	TEXTURE_RECORD& texture = m_textures[slot];
+	if ((texture.bLoading == true) || (texture.state == TEXTURE_FAILED) || (texture.state == TEXTURE_PENDING))
+	{
+		return;
+	}
+
+	firstLevel = (texture.bCompressed == true) ? std::min(std::max(firstLevel, 0), texture.levelCount - 1) : 0;
+	if ((texture.state == TEXTURE_RESIDENT) && (texture.residentLevel == firstLevel))
+	{
+		return;
+	}
+
+	QueueLoad(slot, firstLevel);
+}
+
+/***********************************************************
+ *  Evict()
+ *
+ *  This method is used for freeing the array layer of a
+ *  resident slot, which shows the placeholder until it is
+ *  requested again.
+ ***********************************************************/
+bool TextureManager::Evict(int slot)
+{
+	if ((slot < 0) || (slot >= m_textures.size()))
+	{
+		return(false);
+	}
+
+	TEXTURE_RECORD& texture = m_textures[slot];
+	if ((texture.state != TEXTURE_RESIDENT) || (texture.bLoading == true))
+	{
+		return(false);
+	}
+
+	ReleaseArrayLayer(texture.arrayIndex, texture.layer);
+	m_residentBytes -= texture.residentBytes;
+	texture.residentBytes = 0;
+	texture.residentLevel = -1;
+	texture.arrayIndex = 0;
+	texture.layer = 0;
+	texture.state = TEXTURE_EVICTED;
+
+	return(true);
+}
+
+/***********************************************************
+ *  WorkerLoop()
+ *
+ *  This method is the main function of the decoding threads.
+ *  It decodes queued image files until the manager is shut
+ *  down, and hands the pixels over to the GL thread.
+ ***********************************************************/
+void TextureManager::WorkerLoop()
+{
+	while (true)
+	{
+		DECODE_JOB job;
+		{
+			std::unique_lock<std::mutex> lock(m_queueMutex);
+			m_jobReady.wait(lock, [this]() { return((m_bStopWorkers == true) || (m_decodeJobs.empty() == false)); });
+			if (m_bStopWorkers == true)
+			{
+				return;
+			}
+			job = m_decodeJobs.front();
+			m_decodeJobs.pop_front();
+		}
+
+		DECODED_IMAGE image;
+		LoadImage(job, image);
+
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		if (m_bStopWorkers == true)
+		{
+			stbi_image_free(image.pixels);
+			return;
+		}
+		m_decodedImages.push_back(image);
+	}
+}
+
+/***********************************************************
+ *  LoadImage()
+ *
+ *  This method is used for loading a queued image on a
+ *  decoding thread. A valid cache file is mapped and used
+ *  as is. Otherwise the image file is decoded and, when the
+ *  cache is in use, compressed and written to the cache so
+ *  the next run can skip the decoding.
+ ***********************************************************/
+void TextureManager::LoadImage(const DECODE_JOB& job, DECODED_IMAGE& image)
+{
+	image.slot = job.slot;
+	image.pixels = NULL;
+	image.width = 0;
+	image.height = 0;
+	image.colorChannels = 0;
+	image.bCompressed = false;
+	image.firstLevel = 0;
+
+	if ((m_bUseTextureCache == true) && (TextureCache::Load(job.filename, image.compressed) == true))
+	{
+		image.width = (int)image.compressed.width;
+		image.height = (int)image.compressed.height;
+		image.colorChannels = (image.compressed.format == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT) ? 4 : 3;
+		image.bCompressed = true;
+		image.firstLevel = std::min(job.firstLevel, (int)image.compressed.levels.size() - 1);
+		return;
+	}
+
+	image.pixels = stbi_load(
+		job.filename.c_str(),
+		&image.width,
+		&image.height,
+		&image.colorChannels,
+		0);
+
+	if ((m_bUseTextureCache == true) && (NULL != image.pixels) &&
+		(TextureCache::Compress(image.pixels, image.width, image.height, image.colorChannels, image.compressed) == true))
+	{
+		TextureCache::Save(job.filename, image.compressed);
+		stbi_image_free(image.pixels);
+		image.pixels = NULL;
+		image.bCompressed = true;
+		image.firstLevel = std::min(job.firstLevel, (int)image.compressed.levels.size() - 1);
+	}
+}
+
+/***********************************************************
+ *  ProcessUploads()
+ *
+ *  This method is used for uploading the images that have
+ *  finished decoding. The pixels are copied into the current
+ *  half of the upload buffer until it is full, and the rest
+ *  wait for a later frame. Each half is only written again
+ *  once the GPU has finished reading it, which is checked
+ *  without waiting. It returns the number of textures that
+ *  completed.
+ ***********************************************************/
+int TextureManager::ProcessUploads()
+{
+	if ((m_bInitialized == false) || (m_pendingCount == 0))
+	{
+		return(0);
+	}
+
+	std::deque<DECODED_IMAGE> readyImages;
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		readyImages.swap(m_decodedImages);
+	}
+	if (readyImages.empty() == true)
+	{
+		return(0);
+	}
+
+	UPLOAD_SEGMENT& segment = m_segments[m_currentSegment];
+	bool bSegmentFree = (NULL != m_pUploadMemory);
+	if ((bSegmentFree == true) && (segment.fence != 0))
+	{
+		GLenum result = glClientWaitSync(segment.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+		bSegmentFree = (result == GL_ALREADY_SIGNALED) || (result == GL_CONDITION_SATISFIED);
+		if (bSegmentFree == true)
+		{
+			glDeleteSync(segment.fence);
+			segment.fence = 0;
+		}
+	}
+
+	int completedCount = 0;
+	size_t usedBytes = 0;
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	while (readyImages.empty() == false)
+	{
+		DECODED_IMAGE& image = readyImages.front();
+		const unsigned char* pSource = image.pixels;
+		size_t imageBytes = (size_t)image.width * image.height * image.colorChannels;
+		TEXTURE_RECORD& texture = m_textures[image.slot];
+		if ((image.bCompressed == true) && (NULL != image.compressed.GetData()))
+		{
+			// the levels are stored largest first, so the ones
+			// from the first level on are one run of bytes
+			size_t skippedBytes = image.compressed.levels[image.firstLevel].offset;
+			pSource = image.compressed.GetData() + skippedBytes;
+			imageBytes = image.compressed.dataSize - skippedBytes;
+		}
+
+		// a failed reload keeps the image that is already resident
+		if (NULL == pSource)
+		{
+			std::cout << "Could not load image:" << texture.filename << std::endl;
+			if (texture.state != TEXTURE_RESIDENT)
+			{
+				texture.state = TEXTURE_FAILED;
+			}
+		}
+		else if ((image.colorChannels != 3) && (image.colorChannels != 4))
+		{
+			std::cout << "Not implemented to handle image with " << image.colorChannels << " channels" << std::endl;
+			texture.state = TEXTURE_FAILED;
+		}
+		else if ((NULL == m_pUploadMemory) || (imageBytes > g_UploadSegmentBytes))
+		{
+			// no upload buffer, or an image too big for it
+			UploadImage(image, pSource, false);
+		}
+		else if ((bSegmentFree == false) || (usedBytes + imageBytes > g_UploadSegmentBytes))
+		{
+			// the buffer is busy or full for this frame
+			break;
+		}
+		else
+		{
+			size_t offset = segment.offset + usedBytes;
+			memcpy(m_pUploadMemory + offset, pSource, imageBytes);
+			UploadImage(image, (const void*)offset, true);
+			// keep the next image on a 16 byte boundary, which
+			// covers the alignment of both pixels and blocks
+			usedBytes += (imageBytes + 15) & ~(size_t)15;
+		}
+
+		if (NULL != image.pixels)
+		{
+			stbi_image_free(image.pixels);
+		}
+		texture.bLoading = false;
+		readyImages.pop_front();
+		m_pendingCount--;
+		completedCount++;
+	}
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	// the GPU reads this half of the buffer asynchronously, so it
+	// is fenced and the next frame writes to the other half
+	if (usedBytes > 0)
+	{
+		segment.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_currentSegment = 1 - m_currentSegment;
+	}
+
+	// the images that did not fit wait for the next frame
+	if (readyImages.empty() == false)
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_decodedImages.insert(m_decodedImages.begin(), readyImages.begin(), readyImages.end());
+	}
+
+	return(completedCount);
+}
+
+/***********************************************************
+ *  UploadImage()
+ *
+ *  This method is used for uploading the pixels of a decoded
+ *  image into a free layer of the array texture matching its
+ *  size and format, either from client memory or from an
+ *  offset into the upload buffer. Compressed images upload
+ *  their stored mip levels from the first requested level
+ *  on, and raw images have the mipmaps of their own layer
+ *  generated. When the slot was already resident, its old
+ *  layer is freed once the new one is filled.
+ ***********************************************************/
+void TextureManager::UploadImage(const DECODED_IMAGE& image, const void* pPixels, bool bFromBuffer)
+{
+	TEXTURE_RECORD& texture = m_textures[image.slot];
+
+	GLenum internalFormat = (image.colorChannels == 4) ? GL_RGBA8 : GL_RGB8;
+	GLenum pixelFormat = (image.colorChannels == 4) ? GL_RGBA : GL_RGB;
+	int fullLevelCount = 1;
+	int firstLevel = 0;
+	if (image.bCompressed == true)
+	{
+		internalFormat = image.compressed.format;
+		fullLevelCount = (int)image.compressed.levels.size();
+		firstLevel = image.firstLevel;
+	}
+	else
+	{
+		// full mip chain, generated after the upload
+		for (int size = std::max(image.width, image.height); size > 1; size /= 2)
+		{
+			fullLevelCount++;
+		}
+	}
+
+	int width = std::max(image.width >> firstLevel, 1);
+	int height = std::max(image.height >> firstLevel, 1);
+	int levelCount = fullLevelCount - firstLevel;
+
+	int layer = 0;
+	int arrayIndex = AllocateArrayLayer(image.slot, internalFormat, width, height, levelCount, layer);
+	if (arrayIndex < 0)
+	{
+		std::cout << "No texture array left for image:" << texture.filename
+			<< ", all " << (MAX_TEXTURE_ARRAYS - 1) << " texture units hold images of another size or format" << std::endl;
+		if (texture.state != TEXTURE_RESIDENT)
+		{
+			texture.state = TEXTURE_FAILED;
+		}
+		return;
+	}
+
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_arrays[arrayIndex].texture.GetID());
+	if (bFromBuffer == true)
+	{
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_uploadBuffer.GetID());
+	}
+	if (image.bCompressed == true)
+	{
+		const TextureCache::COMPRESSED_IMAGE& compressed = image.compressed;
+		size_t skippedBytes = compressed.levels[firstLevel].offset;
+		for (int level = firstLevel; level < compressed.levels.size(); level++)
+		{
+			const TextureCache::MIP_LEVEL& mip = compressed.levels[level];
+			glCompressedTexSubImage3D(
+				GL_TEXTURE_2D_ARRAY,
+				level - firstLevel,
+				0, 0, layer,
+				mip.width,
+				mip.height,
+				1,
+				compressed.format,
+				mip.size,
+				(const unsigned char*)pPixels + (mip.offset - skippedBytes));
+		}
+	}
+	else
+	{
+		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, image.width, image.height, 1, pixelFormat, GL_UNSIGNED_BYTE, pPixels);
+	}
+	if (bFromBuffer == true)
+	{
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	}
+
+	// generate the texture mipmaps for mapping textures to lower
+	// resolutions, through a view of only the new layer so the
+	// other layers of the array are not generated again - the
+	// compressed images come with their own mip chain
+	if ((image.bCompressed == false) && (levelCount > 1))
+	{
+		GpuTexture layerView;
+		layerView.Create();
+		glTextureView(layerView.GetID(), GL_TEXTURE_2D_ARRAY, m_arrays[arrayIndex].texture.GetID(),
+			internalFormat, 0, levelCount, layer, 1);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, layerView.GetID());
+		glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, m_arrays[arrayIndex].texture.GetID());
+	}
+
+	// the record points at the new layer before the old one is
+	// freed, so a layer moved into the hole updates it correctly
+	bool bWasResident = (texture.state == TEXTURE_RESIDENT);
+	int oldArrayIndex = texture.arrayIndex;
+	int oldLayer = texture.layer;
+	size_t layerBytes = GetStorageBytes(internalFormat, width, height, levelCount, 1);
+
+	texture.arrayIndex = arrayIndex;
+	texture.layer = layer;
+	texture.width = image.width;
+	texture.height = image.height;
+	texture.levelCount = fullLevelCount;
+	texture.colorChannels = image.colorChannels;
+	texture.bCompressed = image.bCompressed;
+	texture.residentLevel = firstLevel;
+	m_residentBytes = m_residentBytes - texture.residentBytes + layerBytes;
+	texture.residentBytes = layerBytes;
+	texture.state = TEXTURE_RESIDENT;
+
+	if (bWasResident == true)
+	{
+		ReleaseArrayLayer(oldArrayIndex, oldLayer);
+	}
+	else
+	{
+		std::cout << "Successfully loaded image:" << texture.filename << ", width:" << image.width << ", height:" << image.height << ", channels:" << image.colorChannels << std::endl;
+	}
+
+	// the array may be new or have moved to larger storage
+	glActiveTexture(GL_TEXTURE0 + texture.arrayIndex);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, m_arrays[texture.arrayIndex].texture.GetID());
+}
+
+/***********************************************************
+ *  AllocateArrayLayer()
+ *
+ *  This method is used for finding the array texture for an
+ *  image with the passed in size and format, and reserving
+ *  its next layer for the slot. A full array is moved to
+ *  storage with twice the layers, and a new array is created
+ *  for an unseen size and format. It returns the array
+ *  index, or -1 when every texture unit already holds an
+ *  array.
+ ***********************************************************/
+int TextureManager::AllocateArrayLayer(int slot, GLenum internalFormat, int width, int height, int levelCount, int& layer)
+{
+	int freeIndex = -1;
+
+	// the placeholder array is never shared
+	for (int i = 1; i < m_arrays.size(); i++)
+	{
+		TEXTURE_ARRAY& array = m_arrays[i];
+		if (array.layerCapacity == 0)
+		{
+			if (freeIndex < 0)
+			{
+				freeIndex = i;
+			}
+			continue;
+		}
+		if ((array.internalFormat != internalFormat) ||
+			(array.width != width) || (array.height != height) ||
+			(array.levelCount != levelCount) ||
+			(array.layerCount >= m_maxArrayLayers))
+		{
+			continue;
+		}
+
+		if (array.layerCount == array.layerCapacity)
+		{
+			ResizeArray(i, std::min(array.layerCapacity * 2, m_maxArrayLayers));
+		}
+
+		layer = array.layerCount++;
+		array.layerSlots.push_back(slot);
+		return(i);
+	}
+
+	if (freeIndex < 0)
+	{
+		if (m_arrays.size() >= MAX_TEXTURE_ARRAYS)
+		{
+			return(-1);
+		}
+		m_arrays.push_back(TEXTURE_ARRAY());
+		freeIndex = (int)m_arrays.size() - 1;
+	}
+
+	TEXTURE_ARRAY& array = m_arrays[freeIndex];
+	array.internalFormat = internalFormat;
+	array.width = width;
+	array.height = height;
+	array.levelCount = levelCount;
+	array.layerCount = 1;
+	array.layerCapacity = std::min(4, m_maxArrayLayers);
+	array.layerSlots.assign(1, slot);
+	CreateArrayStorage(array);
+
+	layer = 0;
+	return(freeIndex);
+}
+
+/***********************************************************
+ *  ReleaseArrayLayer()
+ *
+ *  This method is used for freeing a layer of an array
+ *  texture. The last layer is copied into the hole so the
+ *  used layers stay packed, and the array moves to half
+ *  the storage once it is only a quarter full. An array
+ *  left without layers frees its storage, and its unit can
+ *  be taken by an array of another size.
+ ***********************************************************/
+void TextureManager::ReleaseArrayLayer(int arrayIndex, int layer)
+{
+	TEXTURE_ARRAY& array = m_arrays[arrayIndex];
+	int lastLayer = array.layerCount - 1;
+
+	if (layer != lastLayer)
+	{
+		for (int level = 0; level < array.levelCount; level++)
+		{
+			glCopyImageSubData(
+				array.texture.GetID(), GL_TEXTURE_2D_ARRAY, level, 0, 0, lastLayer,
+				array.texture.GetID(), GL_TEXTURE_2D_ARRAY, level, 0, 0, layer,
+				std::max(array.width >> level, 1),
+				std::max(array.height >> level, 1),
+				1);
+		}
+
+		int movedSlot = array.layerSlots[lastLayer];
+		array.layerSlots[layer] = movedSlot;
+		m_textures[movedSlot].layer = layer;
+	}
+	array.layerSlots.pop_back();
+	array.layerCount--;
+
+	if (array.layerCount == 0)
+	{
+		array.texture.Destroy();
+		array.layerCapacity = 0;
+	}
+	else if ((array.layerCapacity > 4) && (array.layerCount <= array.layerCapacity / 4))
+	{
+		ResizeArray(arrayIndex, array.layerCapacity / 2);
+	}
+
+	// nothing samples an emptied unit, but it is never left
+	// pointing at a deleted texture
+	GLuint textureID = (array.layerCapacity > 0) ? array.texture.GetID() : m_arrays[0].texture.GetID();
+	glActiveTexture(GL_TEXTURE0 + arrayIndex);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, textureID);
+}
+
+/***********************************************************
+ *  ResizeArray()
+ *
+ *  This method is used for moving an array texture to new
+ *  storage with the passed in number of layers. The used
+ *  layers are copied on the GPU, and the old storage is
+ *  freed by the move.
+ ***********************************************************/
+void TextureManager::ResizeArray(int arrayIndex, int layerCapacity)
+{
+	TEXTURE_ARRAY& array = m_arrays[arrayIndex];
+
+	TEXTURE_ARRAY resized;
+	resized.internalFormat = array.internalFormat;
+	resized.width = array.width;
+	resized.height = array.height;
+	resized.levelCount = array.levelCount;
+	resized.layerCount = array.layerCount;
+	resized.layerCapacity = layerCapacity;
+	resized.layerSlots = array.layerSlots;
+	CreateArrayStorage(resized);
+
+	for (int level = 0; level < array.levelCount; level++)
+	{
+		glCopyImageSubData(
+			array.texture.GetID(), GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+			resized.texture.GetID(), GL_TEXTURE_2D_ARRAY, level, 0, 0, 0,
+			std::max(array.width >> level, 1),
+			std::max(array.height >> level, 1),
+			array.layerCount);
+	}
+
+	array = std::move(resized);
+
+	glActiveTexture(GL_TEXTURE0 + arrayIndex);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, array.texture.GetID());
+}
+
+/***********************************************************
+ *  CreateArrayStorage()
+ *
+ *  This method is used for creating the texture and the
+ *  immutable storage of an array texture, recording its size
+ *  with the resource tracker, and setting its sampling
+ *  parameters. The new texture is left bound to
+ *  GL_TEXTURE_2D_ARRAY.
+ ***********************************************************/
+void TextureManager::CreateArrayStorage(TEXTURE_ARRAY& array)
+{
+	array.texture.Create();
+	glBindTexture(GL_TEXTURE_2D_ARRAY, array.texture.GetID());
+	glTexStorage3D(GL_TEXTURE_2D_ARRAY, array.levelCount, array.internalFormat, array.width, array.height, array.layerCapacity);
+	array.texture.SetSize(GetStorageBytes(array.internalFormat, array.width, array.height, array.levelCount, array.layerCapacity));
+
+	// set the texture wrapping parameters
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	// set texture filtering parameters, sampling the mip chain
+	// when minified - an array with a single level is still
+	// complete, as its immutable storage clamps the levels
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+}
+
+/***********************************************************
+ *  WaitForAll()
+ *
+ *  This method is used for uploading until every requested
+ *  texture has either completed or failed.
+ ***********************************************************/
+void TextureManager::WaitForAll()
+{
+	while (m_pendingCount > 0)
+	{
+		if (ProcessUploads() == 0)
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+/***********************************************************
+ *  GetTextureID()
+ *
+ *  This method is used for getting the OpenGL array texture
+ *  holding the passed in slot, or the placeholder when the
+ *  slot has not finished loading.
+ ***********************************************************/
+GLuint TextureManager::GetTextureID(int slot) const
+{
+	if (m_arrays.empty() == true)
+	{
+		return(0);
+	}
+
+	return(m_arrays[GetTextureUnit(slot)].texture.GetID());
+}
+
+/***********************************************************
+ *  GetTextureUnit()
+ *
+ *  This method is used for getting the texture unit of the
+ *  array texture holding the passed in slot, which is the
+ *  placeholder unit while the slot is still loading.
+ ***********************************************************/
+int TextureManager::GetTextureUnit(int slot) const
+{
+	if ((slot < 0) || (slot >= m_textures.size()) ||
+		(m_textures[slot].state != TEXTURE_RESIDENT))
+	{
+		return(0);
+	}
+
+	return(m_textures[slot].arrayIndex);
+}
+
+/***********************************************************
+ *  GetTextureLayer()
+ *
+ *  This method is used for getting the array layer of the
+ *  passed in slot, which is the placeholder layer while the
+ *  slot is still loading.
+ ***********************************************************/
+int TextureManager::GetTextureLayer(int slot) const
+{
+	if ((slot < 0) || (slot >= m_textures.size()) ||
+		(m_textures[slot].state != TEXTURE_RESIDENT))
+	{
+		return(0);
+	}
+
+	return(m_textures[slot].layer);
+}
+
+/***********************************************************
+ *  GetState()
+ *
+ *  This method is used for getting the loading state of the
+ *  passed in slot.
+ ***********************************************************/
+TextureManager::TEXTURE_STATE TextureManager::GetState(int slot) const
+{
+	if ((slot < 0) || (slot >= m_textures.size()))
+	{
+		return(TEXTURE_FAILED);
+	}
+
+	return(m_textures[slot].state);
+}
+
+/***********************************************************
+ *  IsLoading()
+ *
+ *  This method is used for checking whether a load of the
+ *  passed in slot is queued or decoding.
+ ***********************************************************/
+bool TextureManager::IsLoading(int slot) const
+{
+	if ((slot < 0) || (slot >= m_textures.size()))
+	{
+		return(false);
+	}
+
+	return(m_textures[slot].bLoading);
+}
+
+/***********************************************************
+ *  GetImageSize()
+ *
+ *  This method is used for getting the full size and the
+ *  number of mip levels of the image of the passed in slot.
+ ***********************************************************/
+void TextureManager::GetImageSize(int slot, int& width, int& height, int& levelCount) const
+{
+	width = 0;
+	height = 0;
+	levelCount = 0;
+	if ((slot < 0) || (slot >= m_textures.size()))
+	{
+		return;
+	}
+
+	width = m_textures[slot].width;
+	height = m_textures[slot].height;
+	levelCount = m_textures[slot].levelCount;
+}
+
+/***********************************************************
+ *  GetResidentLevel()
+ *
+ *  This method is used for getting the first mip level of
+ *  the passed in slot that is held on the GPU.
+ ***********************************************************/
+int TextureManager::GetResidentLevel(int slot) const
+{
+	if ((slot < 0) || (slot >= m_textures.size()) ||
+		(m_textures[slot].state != TEXTURE_RESIDENT))
+	{
+		return(-1);
+	}
+
+	return(m_textures[slot].residentLevel);
+}
+
+/***********************************************************
+ *  BindTextureUnits()
+ *
+ *  This method is used for binding every array texture to
+ *  the texture unit matching its index.
+ ***********************************************************/
+void TextureManager::BindTextureUnits()
+{
+	for (int i = 0; i < m_arrays.size(); i++)
+	{
+		// unused entries get the placeholder
+		TEXTURE_ARRAY& array = (m_arrays[i].layerCapacity > 0) ? m_arrays[i] : m_arrays[0];
+		glActiveTexture(GL_TEXTURE0 + i);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, array.texture.GetID());
+	}
+}
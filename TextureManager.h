@@ -0,0 +1,236 @@
+///////////////////////////////////////////////////////////////////////////////
+// texturemanager.h
+// ============
+// load scene textures in the background and upload them to the GPU
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GpuResource.h"
+#include "TagRegistry.h"
+#include "TextureCache.h"
+
+#include <GL/glew.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/***********************************************************
+ *  TextureManager
+ *
+ *  This class owns the textures of the 3D scene. Requesting
+ *  a texture reserves its slot and tag handle straight away,
+ *  while the image file is decoded by a pool of worker
+ *  threads. The decoded pixels are copied into a persistently
+ *  mapped pixel buffer on the GL thread, a few per frame, and
+ *  uploaded from there. Textures with the same size and
+ *  format are stored as layers of one 2D array texture, and
+ *  every array stays bound to its own texture unit, so a
+ *  texture is selected by its unit and layer without any
+ *  rebinding. Until its upload completes, a slot shows a
+ *  small placeholder texture. Slots can be evicted and
+ *  reloaded at a different first mip level later, which is
+ *  how the TextureStreamer keeps them within a budget. When the driver
+ *  supports S3TC, images are stored as block compressed mip
+ *  chains in the texture cache and read from it on later
+ *  runs instead of being decoded again.
+ ***********************************************************/
+class TextureManager
+{
+public:
+	// constructor
+	TextureManager();
+	// destructor
+	~TextureManager();
+
+	// loading state of one texture slot
+	enum TEXTURE_STATE
+	{
+		TEXTURE_PENDING = 0,
+		TEXTURE_RESIDENT,
+		TEXTURE_FAILED,
+		// was resident, and freed to stay within the budget
+		TEXTURE_EVICTED
+	};
+
+	// create the placeholder and the upload buffer and start
+	// the decoding threads - needs a current context
+	void Initialize(int workerCount);
+	// stop the decoding threads and free all the textures
+	void Shutdown();
+
+	// reserve a slot for the tag and queue the image file for
+	// decoding, returning the slot or -1 when it can't be added
+	int RequestTexture(const char* filename, const std::string& tag);
+	// upload the images that finished decoding - must be
+	// called on the GL thread, normally once per frame
+	int ProcessUploads();
+	// keep uploading until every requested texture is done
+	void WaitForAll();
+
+	// reload a slot in the background starting at the passed
+	// in mip level - the current image stays in use until then
+	void RequestLevel(int slot, int firstLevel);
+	// free the array layer of a resident slot, returning false
+	// when the slot is not resident or is still loading
+	bool Evict(int slot);
+
+	// find the slot of a requested texture by tag
+	int Find(const std::string& tag) const { return(m_tags.Find(tag)); }
+	// get the OpenGL array texture holding a slot, which is
+	// the placeholder while the slot is still loading
+	GLuint GetTextureID(int slot) const;
+	// get the texture unit and the array layer of a slot
+	int GetTextureUnit(int slot) const;
+	int GetTextureLayer(int slot) const;
+	TEXTURE_STATE GetState(int slot) const;
+	// true while a load of the slot is queued or decoding
+	bool IsLoading(int slot) const;
+	// get the full size and mip count of a slot's image, which
+	// are 0 until it was loaded once
+	void GetImageSize(int slot, int& width, int& height, int& levelCount) const;
+	// get the first mip level of a slot held on the GPU, or -1
+	int GetResidentLevel(int slot) const;
+	// get the bytes of the array layers in use by the slots
+	size_t GetResidentBytes() const { return(m_residentBytes); }
+	int GetTextureCount() const { return((int)m_textures.size()); }
+	// number of requested textures that are not uploaded yet
+	int GetPendingCount() const { return(m_pendingCount); }
+
+	// bind every array texture to its texture unit
+	void BindTextureUnits();
+
+	// maximum number of texture slots - a slot is only a
+	// record, the images are limited by the arrays below
+	static const int MAX_TEXTURES = 1024;
+	// maximum number of array textures, one per texture unit,
+	// including the placeholder. Every size, format and mip
+	// count of image takes an array of its own, so a scene
+	// can hold images of at most 15 such kinds, each of them
+	// up to GL_MAX_ARRAY_TEXTURE_LAYERS images
+	static const int MAX_TEXTURE_ARRAYS = 16;
+
+private:
+	struct TEXTURE_RECORD
+	{
+		std::string tag;
+		std::string filename;
+		// array texture and layer holding the image
+		int arrayIndex;
+		int layer;
+		// full size of the image and its number of mip levels
+		int width;
+		int height;
+		int levelCount;
+		int colorChannels;
+		bool bCompressed;
+		// first mip level held in the array layer
+		int residentLevel;
+		size_t residentBytes;
+		// a load is queued or decoding
+		bool bLoading;
+		TEXTURE_STATE state;
+	};
+
+	// array texture of same size and format images, bound to
+	// the texture unit matching its index
+	struct TEXTURE_ARRAY
+	{
+		GpuTexture texture;
+		GLenum internalFormat;
+		int width;
+		int height;
+		int levelCount;
+		int layerCount;
+		// 0 for an unused entry, whose unit can take a new array
+		int layerCapacity;
+		// slot stored in each layer
+		std::vector<int> layerSlots;
+	};
+
+	// image file waiting to be decoded
+	struct DECODE_JOB
+	{
+		int slot;
+		std::string filename;
+		int firstLevel;
+	};
+
+	// decoded image waiting to be uploaded, holding either raw
+	// pixels or a block compressed mip chain
+	struct DECODED_IMAGE
+	{
+		int slot;
+		unsigned char* pixels;
+		int width;
+		int height;
+		int colorChannels;
+		bool bCompressed;
+		TextureCache::COMPRESSED_IMAGE compressed;
+		// first mip level to upload - compressed images only
+		int firstLevel;
+	};
+
+	// one part of the pixel upload buffer, reused every other frame
+	struct UPLOAD_SEGMENT
+	{
+		size_t offset;
+		GLsync fence;
+	};
+
+	std::vector<TEXTURE_RECORD> m_textures;
+	TagRegistry m_tags;
+	// array textures, the first one holding the placeholder
+	std::vector<TEXTURE_ARRAY> m_arrays;
+	// layer limit of one array texture
+	int m_maxArrayLayers;
+	// bytes of the array layers in use by the slots
+	size_t m_residentBytes;
+	int m_pendingCount;
+	bool m_bInitialized;
+	// store and upload block compressed images
+	bool m_bUseTextureCache;
+
+	// decoding threads and the queues they share with the GL thread
+	std::vector<std::thread> m_workers;
+	std::mutex m_queueMutex;
+	std::condition_variable m_jobReady;
+	std::deque<DECODE_JOB> m_decodeJobs;
+	std::deque<DECODED_IMAGE> m_decodedImages;
+	bool m_bStopWorkers;
+
+	// persistently mapped pixel upload buffer
+	GpuBuffer m_uploadBuffer;
+	unsigned char* m_pUploadMemory;
+	UPLOAD_SEGMENT m_segments[2];
+	int m_currentSegment;
+
+	// main function of the decoding threads
+	void WorkerLoop();
+	// read a queued image from the texture cache, or decode it
+	// and add it to the cache
+	void LoadImage(const DECODE_JOB& job, DECODED_IMAGE& image);
+	// queue a slot for loading on the decoding threads
+	void QueueLoad(int slot, int firstLevel);
+	// upload the pixels of a decoded image into a free layer
+	void UploadImage(const DECODED_IMAGE& image, const void* pPixels, bool bFromBuffer);
+	// find an array texture with a free layer for the slot,
+	// growing or creating one as needed, or return -1
+	int AllocateArrayLayer(int slot, GLenum internalFormat, int width, int height, int levelCount, int& layer);
+	// free an array layer, moving the last layer into the hole
+	// and shrinking the array when it is mostly empty
+	void ReleaseArrayLayer(int arrayIndex, int layer);
+	// move an array texture to storage with the passed in
+	// number of layers, copying the used layers on the GPU
+	void ResizeArray(int arrayIndex, int layerCapacity);
+	// create the texture and storage of an array texture and
+	// set its sampling parameters
+	void CreateArrayStorage(TEXTURE_ARRAY& array);
+	// free the pixel upload buffer
+	void DestroyUploadBuffer();
+};
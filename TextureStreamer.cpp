@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+// texturestreamer.cpp
+// ============
+// keep the scene textures within a GPU memory budget
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "TextureStreamer.h"
+
+#include <algorithm>
+#include <cstdint>
+
+/***********************************************************
+ *  TextureStreamer()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+TextureStreamer::TextureStreamer(TextureManager* pTextureManager)
+{
+	m_pTextureManager = pTextureManager;
+	m_memoryBudget = SIZE_MAX;
+	m_frame = 0;
+	m_evictionCount = 0;
+}
+
+/***********************************************************
+ *  BeginFrame()
+ *
+ *  This method is used for starting a new frame, so the
+ *  textures marked from now on count as drawn in it.
+ ***********************************************************/
+void TextureStreamer::BeginFrame()
+{
+	m_frame++;
+
+	if (m_records.size() < m_pTextureManager->GetTextureCount())
+	{
+		STREAM_RECORD record;
+		record.lastUsedFrame = 0;
+		record.neededLevel = 0;
+		m_records.resize(m_pTextureManager->GetTextureCount(), record);
+	}
+}
+
+/***********************************************************
+ *  MarkUsed()
+ *
+ *  This method is used for recording that a slot is drawn in
+ *  the current frame. A slot drawn more than once keeps the
+ *  most detailed level that any of its draws needs.
+ ***********************************************************/
+void TextureStreamer::MarkUsed(int slot, int firstLevel)
+{
+	if ((slot < 0) || (slot >= m_records.size()))
+	{
+		return;
+	}
+
+	STREAM_RECORD& record = m_records[slot];
+	if (record.lastUsedFrame != m_frame)
+	{
+		record.lastUsedFrame = m_frame;
+		record.neededLevel = firstLevel;
+	}
+	else
+	{
+		record.neededLevel = std::min(record.neededLevel, firstLevel);
+	}
+}
+
+/***********************************************************
+ *  Update()
+ *
+ *  This method is used for bringing the resident textures in
+ *  line with the current frame. Drawn textures that are
+ *  evicted, or held with less detail than they need, are
+ *  requested again. While the resident bytes are over the
+ *  budget, textures not drawn this frame are evicted oldest
+ *  first, and then drawn textures holding more detail than
+ *  they need drop to their needed level.
+ ***********************************************************/
+int TextureStreamer::Update()
+{
+	for (int slot = 0; slot < m_records.size(); slot++)
+	{
+		const STREAM_RECORD& record = m_records[slot];
+		if (record.lastUsedFrame != m_frame)
+		{
+			continue;
+		}
+
+		TextureManager::TEXTURE_STATE state = m_pTextureManager->GetState(slot);
+		if ((state == TextureManager::TEXTURE_EVICTED) ||
+			((state == TextureManager::TEXTURE_RESIDENT) &&
+			 (m_pTextureManager->GetResidentLevel(slot) > record.neededLevel)))
+		{
+			m_pTextureManager->RequestLevel(slot, record.neededLevel);
+		}
+	}
+
+	if (m_pTextureManager->GetResidentBytes() <= m_memoryBudget)
+	{
+		return(0);
+	}
+
+	std::vector<int> candidates;
+	for (int slot = 0; slot < m_records.size(); slot++)
+	{
+		if ((m_records[slot].lastUsedFrame != m_frame) &&
+			(m_pTextureManager->GetState(slot) == TextureManager::TEXTURE_RESIDENT) &&
+			(m_pTextureManager->IsLoading(slot) == false))
+		{
+			candidates.push_back(slot);
+		}
+	}
+	std::sort(candidates.begin(), candidates.end(),
+		[this](int a, int b)
+		{
+			return(m_records[a].lastUsedFrame < m_records[b].lastUsedFrame);
+		});
+
+	int evictedCount = 0;
+	for (int i = 0; i < candidates.size(); i++)
+	{
+		if (m_pTextureManager->GetResidentBytes() <= m_memoryBudget)
+		{
+			break;
+		}
+		if (m_pTextureManager->Evict(candidates[i]) == true)
+		{
+			evictedCount++;
+		}
+	}
+	m_evictionCount += evictedCount;
+
+	// the textures on screen alone are over the budget, so
+	// they give up the detail their size does not need
+	if (m_pTextureManager->GetResidentBytes() > m_memoryBudget)
+	{
+		for (int slot = 0; slot < m_records.size(); slot++)
+		{
+			int residentLevel = m_pTextureManager->GetResidentLevel(slot);
+			if ((m_records[slot].lastUsedFrame == m_frame) &&
+				(residentLevel >= 0) &&
+				(residentLevel < m_records[slot].neededLevel))
+			{
+				m_pTextureManager->RequestLevel(slot, m_records[slot].neededLevel);
+			}
+		}
+	}
+
+	return(evictedCount);
+}
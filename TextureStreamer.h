@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////
+// texturestreamer.h
+// ============
+// keep the scene textures within a GPU memory budget
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "TextureManager.h"
+
+#include <cstddef>
+#include <vector>
+
+/***********************************************************
+ *  TextureStreamer
+ *
+ *  This class decides which textures of the TextureManager
+ *  stay on the GPU. Every frame the scene marks the textures
+ *  it draws with the first mip level their on-screen size
+ *  needs. Textures on screen are loaded at that level, and
+ *  when the resident textures go over the memory budget the
+ *  least recently used ones are evicted. Evicted textures
+ *  are loaded again in the background once they are drawn.
+ ***********************************************************/
+class TextureStreamer
+{
+public:
+	// constructor
+	TextureStreamer(TextureManager* pTextureManager);
+
+	// set the bytes the resident textures may take up - the
+	// default has no limit
+	void SetMemoryBudget(size_t bytes) { m_memoryBudget = bytes; }
+	size_t GetMemoryBudget() const { return(m_memoryBudget); }
+
+	// start tracking the textures drawn in a new frame
+	void BeginFrame();
+	// record that a slot is drawn this frame and needs the
+	// passed in first mip level
+	void MarkUsed(int slot, int firstLevel);
+	// load the textures that are on screen at the mip levels
+	// they need and evict textures over the budget, returning
+	// the number of textures evicted
+	int Update();
+
+	// total number of textures evicted so far
+	int GetEvictionCount() const { return(m_evictionCount); }
+
+private:
+	// use of one texture slot
+	struct STREAM_RECORD
+	{
+		unsigned int lastUsedFrame;
+		int neededLevel;
+	};
+
+	TextureManager* m_pTextureManager;
+	std::vector<STREAM_RECORD> m_records;
+	size_t m_memoryBudget;
+	// frame number, starting at 1 so 0 means never used
+	unsigned int m_frame;
+	int m_evictionCount;
+};
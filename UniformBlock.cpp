@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////
+// uniformblock.cpp
+// ============
+// manage a uniform buffer object that backs a shader uniform block
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "UniformBlock.h"
+
+#include <iostream>
+
+/***********************************************************
+ *  UniformBlock()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+UniformBlock::UniformBlock(GLuint bindingPoint)
+{
+	m_bindingPoint = bindingPoint;
+	m_size = 0;
+}
+
+/***********************************************************
+ *  ~UniformBlock()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+UniformBlock::~UniformBlock()
+{
+	Destroy();
+}
+
+/***********************************************************
+ *  Create()
+ *
+ *  This method is used for allocating zeroed buffer storage
+ *  of the passed in size and binding the buffer to the
+ *  binding point.
+ ***********************************************************/
+void UniformBlock::Create(size_t size)
+{
+	Destroy();
+
+	m_buffer.Create(GpuResourceTracker::RESOURCE_UNIFORM_BUFFER);
+	glBindBuffer(GL_UNIFORM_BUFFER, m_buffer.GetID());
+	glBufferData(GL_UNIFORM_BUFFER, size, NULL, GL_DYNAMIC_DRAW);
+	m_buffer.SetSize(size);
+	// start from zeroed values, so unused entries add nothing
+	glClearBufferData(GL_UNIFORM_BUFFER, GL_R8, GL_RED, GL_UNSIGNED_BYTE, NULL);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	glBindBufferBase(GL_UNIFORM_BUFFER, m_bindingPoint, m_buffer.GetID());
+	m_size = size;
+}
+
+/***********************************************************
+ *  Destroy()
+ *
+ *  This method is used for freeing the buffer storage.
+ ***********************************************************/
+void UniformBlock::Destroy()
+{
+	m_buffer.Destroy();
+	m_size = 0;
+}
+
+/***********************************************************
+ *  AttachToProgram()
+ *
+ *  This method is used for attaching the named uniform block
+ *  of the passed in shader program to the binding point of
+ *  this buffer.
+ ***********************************************************/
+bool UniformBlock::AttachToProgram(GLuint programID, const char* blockName)
+{
+	GLuint blockIndex = glGetUniformBlockIndex(programID, blockName);
+	if (blockIndex == GL_INVALID_INDEX)
+	{
+		std::cout << "Uniform block not found in shader:" << blockName << std::endl;
+		return(false);
+	}
+
+	glUniformBlockBinding(programID, blockIndex, m_bindingPoint);
+	return(true);
+}
+
+/***********************************************************
+ *  Update()
+ *
+ *  This method is used for copying the passed in bytes into
+ *  the buffer, starting at the passed in offset.
+ ***********************************************************/
+void UniformBlock::Update(size_t offset, size_t size, const void* pData)
+{
+	if ((m_buffer.GetID() == 0) || (offset + size > m_size))
+	{
+		std::cout << "Uniform buffer update out of range" << std::endl;
+		return;
+	}
+
+	glBindBuffer(GL_UNIFORM_BUFFER, m_buffer.GetID());
+	glBufferSubData(GL_UNIFORM_BUFFER, offset, size, pData);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
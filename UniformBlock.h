@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////
+// uniformblock.h
+// ============
+// manage a uniform buffer object that backs a shader uniform block
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GpuResource.h"
+
+#include <GL/glew.h>
+
+#include <cstddef>
+
+/***********************************************************
+ *  UniformBlock
+ *
+ *  This class owns one uniform buffer object that is bound
+ *  to a fixed binding point, so every shader program whose
+ *  named uniform block is attached to that binding point
+ *  reads its values from the buffer. The caller lays the
+ *  data out following the std140 rules of the block.
+ ***********************************************************/
+class UniformBlock
+{
+public:
+	// constructor
+	UniformBlock(GLuint bindingPoint);
+	// destructor
+	~UniformBlock();
+
+	// allocate the buffer storage and bind it to the binding point
+	void Create(size_t size);
+	// free the buffer storage
+	void Destroy();
+	// true once the buffer storage has been allocated
+	bool IsCreated() const { return(m_buffer.GetID() != 0); }
+
+	// attach the named uniform block of a shader program to
+	// the binding point of this buffer
+	bool AttachToProgram(GLuint programID, const char* blockName);
+	// copy the passed in bytes into the buffer at the offset
+	void Update(size_t offset, size_t size, const void* pData);
+
+	GLuint GetBindingPoint() const { return(m_bindingPoint); }
+	size_t GetSize() const { return(m_size); }
+
+private:
+	GLuint m_bindingPoint;
+	GpuBuffer m_buffer;
+	size_t m_size;
+};
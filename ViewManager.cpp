@@ -1,267 +1,622 @@
-///////////////////////////////////////////////////////////////////////////////
-// viewmanager.h
-// ============
-// manage the viewing of 3D objects within the viewport
-//
-//  AUTHOR: Brian Battersby - SNHU Instructor / Computer Science
-//	Created for CS-330-Computational Graphics and Visualization, Nov. 1st, 2023
-///////////////////////////////////////////////////////////////////////////////
-
-#include "ViewManager.h"
-
-// GLM Math Header inclusions
-#include <glm/glm.hpp>
-#include <glm/gtx/transform.hpp>
-#include <glm/gtc/type_ptr.hpp>    
-
-// declaration of the global variables and defines
-namespace
-{
-	// Variables for window width and height
-	const int WINDOW_WIDTH = 1000;
-	const int WINDOW_HEIGHT = 800;
-	const char* g_ViewName = "view";
-	const char* g_ProjectionName = "projection";
-
-	// camera object used for viewing and interacting with
-	// the 3D scene
-	Camera* g_pCamera = nullptr;
-
-	// these variables are used for mouse movement processing
-	float gLastX = WINDOW_WIDTH / 2.0f;
-	float gLastY = WINDOW_HEIGHT / 2.0f;
-	bool gFirstMouse = true;
-
-	// time between current frame and last frame
-	float gDeltaTime = 0.0f; 
-	float gLastFrame = 0.0f;
-
-	// the following variable is false when orthographic projection
-	// is off and true when it is on
-	bool bOrthographicProjection = false;
-
-	//This variable toggles the different view modes
-	bool bOrthographicView = false;
-}
-
-/***************************************************
-*scroll_callback
-*This method is automatically called from GLFW whenever
-* the mouse is scrolled in the active GLFW display window
-******************************************************/
-void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
-{
-	// Adjust camera movement speed based on the scroll direction
-	if (g_pCamera != nullptr) {
-		g_pCamera->ProcessMouseScroll((float)yoffset);
-	}
-}
-
-/***********************************************************
- *  ViewManager()
- *
- *  The constructor for the class
- ***********************************************************/
-ViewManager::ViewManager(
-	ShaderManager *pShaderManager)
-{
-	// initialize the member variables
-	m_pShaderManager = pShaderManager;
-	m_pWindow = NULL;
-	g_pCamera = new Camera();
-	// default camera view parameters
-	g_pCamera->Position = glm::vec3(0.0f, 5.0f, 12.0f);
-	g_pCamera->Front = glm::vec3(0.0f, -0.5f, -2.0f);
-	g_pCamera->Up = glm::vec3(0.0f, 1.0f, 0.0f);
-	g_pCamera->Zoom = 80;
-}
-
-/***********************************************************
- *  ~ViewManager()
- *
- *  The destructor for the class
- ***********************************************************/
-ViewManager::~ViewManager()
-{
-	// free up allocated memory
-	m_pShaderManager = NULL;
-	m_pWindow = NULL;
-	if (NULL != g_pCamera)
-	{
-		delete g_pCamera;
-		g_pCamera = NULL;
-	}
-}
-
-/***********************************************************
- *  CreateDisplayWindow()
- *
- *  This method is used to create the main display window.
- ***********************************************************/
-GLFWwindow* ViewManager::CreateDisplayWindow(const char* windowTitle)
-{
-	GLFWwindow* window = nullptr;
-
-	// try to create the displayed OpenGL window
-	window = glfwCreateWindow(
-		WINDOW_WIDTH,
-		WINDOW_HEIGHT,
-		windowTitle,
-		NULL, NULL);
-	if (window == NULL)
-	{
-		std::cout << "Failed to create GLFW window" << std::endl;
-		glfwTerminate();
-		return NULL;
-	}
-	glfwMakeContextCurrent(window);
-
-	// Register scroll callback function
-	glfwSetScrollCallback(window, scroll_callback);
-
-	// tell GLFW to capture all mouse events
-	//glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
-
-	// this callback is used to receive mouse moving events
-	glfwSetCursorPosCallback(window, &ViewManager::Mouse_Position_Callback);
-
-	// enable blending for supporting tranparent rendering
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-	m_pWindow = window;
-
-	return(window);
-}
-
-/***********************************************************
- *  Mouse_Position_Callback()
- *
- *  This method is automatically called from GLFW whenever
- *  the mouse is moved within the active GLFW display window.
- ***********************************************************/
-void ViewManager::Mouse_Position_Callback(GLFWwindow* window, double xMousePos, double yMousePos)
-{
-	// when the first mouse move event is received, this needs to be recorded so that
-	// all subsequent mouse moves can correctly calculate the X position offset and Y
-	// position offset for proper operation
-	if (gFirstMouse)
-	{
-		gLastX = xMousePos;
-		gLastY = yMousePos;
-		gFirstMouse = false;
-	}
-	// calculate the X offset and Y offset values for moving the 3D camera accordingly
-	float xOffset = xMousePos - gLastX;
-	float yOffset = gLastY - yMousePos; // reversed since y-coordinates go from bottom to top
-
-	// set the current positions into the last position variables
-	gLastX = xMousePos;
-	gLastY = yMousePos;
-
-	// move the 3D camera according to the calculated offsets
-	g_pCamera->ProcessMouseMovement(xOffset, yOffset);
-}
-
-/***********************************************************
- *  ProcessKeyboardEvents()
- *
- *  This method is called to process any keyboard events
- *  that may be waiting in the event queue.
- ***********************************************************/
-void ViewManager::ProcessKeyboardEvents()
-{
-	// close the window if the escape key has been pressed
-	if (glfwGetKey(m_pWindow, GLFW_KEY_ESCAPE) == GLFW_PRESS)
-	{
-		glfwSetWindowShouldClose(m_pWindow, true);
-	}
-
-	// if the camera object is null, then exit this method
-	if (NULL == g_pCamera)
-	{
-		return;
-	}
-
-	// process camera zooming in and out
-	if (glfwGetKey(m_pWindow, GLFW_KEY_W) == GLFW_PRESS)
-	{
-		g_pCamera->ProcessKeyboard(FORWARD, gDeltaTime);
-	}
-	if (glfwGetKey(m_pWindow, GLFW_KEY_S) == GLFW_PRESS)
-	{
-		g_pCamera->ProcessKeyboard(BACKWARD, gDeltaTime);
-	}
-
-	// process camera panning left and right
-	if (glfwGetKey(m_pWindow, GLFW_KEY_A) == GLFW_PRESS)
-	{
-		g_pCamera->ProcessKeyboard(LEFT, gDeltaTime);
-	}
-	if (glfwGetKey(m_pWindow, GLFW_KEY_D) == GLFW_PRESS)
-	{
-		g_pCamera->ProcessKeyboard(RIGHT, gDeltaTime);
-	}
-	if (glfwGetKey(m_pWindow, GLFW_KEY_Q) == GLFW_PRESS)
-	{
-		g_pCamera->ProcessKeyboard(UP, gDeltaTime);
-	}
-	if (glfwGetKey(m_pWindow, GLFW_KEY_E) == GLFW_PRESS)
-	{
-		g_pCamera->ProcessKeyboard(DOWN, gDeltaTime);
-	}
-	// Toggle between orthographic and perspective views
-	if (glfwGetKey(m_pWindow, GLFW_KEY_P) == GLFW_PRESS) {
-		bOrthographicView = false; // Switch to perspective view
-	}
-	if (glfwGetKey(m_pWindow, GLFW_KEY_O) == GLFW_PRESS) {
-		bOrthographicView = true; // Switch to orthographic view
-	}
-}
-
-/***********************************************************
- *  PrepareSceneView()
- *
- *  This method is used for preparing the 3D scene by loading
- *  the shapes, textures in memory to support the 3D scene 
- *  rendering
- ***********************************************************/
-void ViewManager::PrepareSceneView()
-{
-	glm::mat4 view;
-	glm::mat4 projection;
-
-	// per-frame timing
-	float currentFrame = glfwGetTime();
-	gDeltaTime = currentFrame - gLastFrame;
-	gLastFrame = currentFrame;
-
-	// process any keyboard events that may be waiting in the 
-	// event queue
-	ProcessKeyboardEvents();
-
-	// get the current view matrix from the camera
-	view = g_pCamera->GetViewMatrix();
-
-	// Define the projection matrix based on the current view mode
-	if (bOrthographicView) {
-		// Set up orthographic projection
-		float orthoSize = 10.0f; // Adjust this value based on the scene size
-		projection = glm::ortho(-orthoSize, orthoSize, -orthoSize, orthoSize, 0.1f, 100.0f);
-	}
-	else {
-		// Set up perspective projection
-		projection = glm::perspective(glm::radians(g_pCamera->Zoom), (GLfloat)WINDOW_WIDTH / (GLfloat)WINDOW_HEIGHT, 0.1f, 100.0f);
-	}
-
-	// if the shader manager object is valid
-	if (NULL != m_pShaderManager)
-	{
-		// set the view matrix into the shader for proper rendering
-		m_pShaderManager->setMat4Value(g_ViewName, view);
-		// set the view matrix into the shader for proper rendering
-		m_pShaderManager->setMat4Value(g_ProjectionName, projection);
-		// set the view position of the camera into the shader for proper rendering
-		m_pShaderManager->setVec3Value("viewPosition", g_pCamera->Position);
-	}
+///////////////////////////////////////////////////////////////////////////////
+// viewmanager.h
+// ============
+// manage the viewing of 3D objects within the viewport
+//
+//  AUTHOR: Brian Battersby - SNHU Instructor / Computer Science
+//	Created for CS-330-Computational Graphics and Visualization, Nov. 1st, 2023
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ViewManager.h"
+#include "SimulationThread.h"
+
+// GLM Math Header inclusions
+#include <glm/glm.hpp>
+#include <glm/gtx/transform.hpp>
+#include <glm/gtc/type_ptr.hpp>    
+
+#include <algorithm>
+#include <cstring>
+
+// declaration of the global variables and defines
+namespace
+{
+	// Variables for window width and height
+	const int WINDOW_WIDTH = 1000;
+	const int WINDOW_HEIGHT = 800;
+	const char* g_ViewName = "view";
+	const char* g_ProjectionName = "projection";
+
+	// camera object used for viewing and interacting with
+	// the 3D scene
+	Camera* g_pCamera = nullptr;
+	// thread moving the camera in fixed steps, which owns the
+	// camera while it runs
+	SimulationThread* g_pSimulation = nullptr;
+
+	// these variables are used for mouse movement processing
+	float gLastX = WINDOW_WIDTH / 2.0f;
+	float gLastY = WINDOW_HEIGHT / 2.0f;
+	bool gFirstMouse = true;
+
+	// time between current frame and last frame
+	float gDeltaTime = 0.0f; 
+	float gLastFrame = 0.0f;
+	// longest frame time the camera moves for, so the first
+	// frame after idling or a stall does not jump
+	const float g_MaxDeltaTime = 0.1f;
+
+	// the following variable is false when orthographic projection
+	// is off and true when it is on
+	bool bOrthographicProjection = false;
+
+	//This variable toggles the different view modes
+	bool bOrthographicView = false;
+
+	// true while the mouse input is ignored for a scripted camera
+	bool bIgnoreMouse = false;
+
+	// true when the input or the camera changed the view, or
+	// the window lost its contents, since the view was prepared
+	bool gViewDirty = true;
+}
+
+/***************************************************
+*scroll_callback
+*This method is automatically called from GLFW whenever
+* the mouse is scrolled in the active GLFW display window
+******************************************************/
+void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
+{
+	gViewDirty = true;
+
+	// Adjust camera movement speed based on the scroll direction
+	if ((g_pSimulation != nullptr) && (g_pSimulation->IsRunning() == true)) {
+		g_pSimulation->AddMouseScroll((float)yoffset);
+	}
+	else if (g_pCamera != nullptr) {
+		g_pCamera->ProcessMouseScroll((float)yoffset);
+	}
+}
+
+/***********************************************************
+ *  ViewManager()
+ *
+ *  The constructor for the class
+ ***********************************************************/
+ViewManager::ViewManager(
+	ShaderManager *pShaderManager)
+{
+	// initialize the member variables
+	m_pShaderManager = pShaderManager;
+	m_pWindow = NULL;
+	m_viewMatrix = glm::mat4(1.0f);
+	m_projectionMatrix = glm::mat4(1.0f);
+	m_viewPosition = glm::vec3(0.0f, 0.0f, 0.0f);
+	m_bScriptedCamera = false;
+	m_mainViewport.x = 0.0f;
+	m_mainViewport.y = 0.0f;
+	m_mainViewport.width = 1.0f;
+	m_mainViewport.height = 1.0f;
+	g_pCamera = new Camera();
+	// default camera view parameters
+	g_pCamera->Position = glm::vec3(0.0f, 5.0f, 12.0f);
+	g_pCamera->Front = glm::vec3(0.0f, -0.5f, -2.0f);
+	g_pCamera->Up = glm::vec3(0.0f, 1.0f, 0.0f);
+	g_pCamera->Zoom = 80;
+}
+
+/***********************************************************
+ *  ~ViewManager()
+ *
+ *  The destructor for the class
+ ***********************************************************/
+ViewManager::~ViewManager()
+{
+	// free up allocated memory
+	m_pShaderManager = NULL;
+	m_pWindow = NULL;
+	if (NULL != g_pSimulation)
+	{
+		delete g_pSimulation;
+		g_pSimulation = NULL;
+	}
+	if (NULL != g_pCamera)
+	{
+		delete g_pCamera;
+		g_pCamera = NULL;
+	}
+}
+
+/***********************************************************
+ *  CreateDisplayWindow()
+ *
+ *  This method is used to create the main display window.
+ ***********************************************************/
+GLFWwindow* ViewManager::CreateDisplayWindow(const char* windowTitle)
+{
+	GLFWwindow* window = nullptr;
+
+	// try to create the displayed OpenGL window
+	window = glfwCreateWindow(
+		WINDOW_WIDTH,
+		WINDOW_HEIGHT,
+		windowTitle,
+		NULL, NULL);
+	if (window == NULL)
+	{
+		std::cout << "Failed to create GLFW window" << std::endl;
+		glfwTerminate();
+		return NULL;
+	}
+	glfwMakeContextCurrent(window);
+
+	// Register scroll callback function
+	glfwSetScrollCallback(window, scroll_callback);
+	// register the callbacks that only tell the on-demand
+	// rendering a new frame is needed
+	glfwSetKeyCallback(window, &ViewManager::Key_Callback);
+	glfwSetWindowRefreshCallback(window, &ViewManager::Window_Refresh_Callback);
+
+	// tell GLFW to capture all mouse events
+	//glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+
+	// this callback is used to receive mouse moving events
+	glfwSetCursorPosCallback(window, &ViewManager::Mouse_Position_Callback);
+
+	// enable blending for supporting tranparent rendering
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	m_pWindow = window;
+
+	return(window);
+}
+
+/***********************************************************
+ *  Mouse_Position_Callback()
+ *
+ *  This method is automatically called from GLFW whenever
+ *  the mouse is moved within the active GLFW display window.
+ ***********************************************************/
+void ViewManager::Mouse_Position_Callback(GLFWwindow* window, double xMousePos, double yMousePos)
+{
+	if (bIgnoreMouse)
+	{
+		return;
+	}
+
+	// when the first mouse move event is received, this needs to be recorded so that
+	// all subsequent mouse moves can correctly calculate the X position offset and Y
+	// position offset for proper operation
+	if (gFirstMouse)
+	{
+		gLastX = xMousePos;
+		gLastY = yMousePos;
+		gFirstMouse = false;
+	}
+	// calculate the X offset and Y offset values for moving the 3D camera accordingly
+	float xOffset = xMousePos - gLastX;
+	float yOffset = gLastY - yMousePos; // reversed since y-coordinates go from bottom to top
+
+	// set the current positions into the last position variables
+	gLastX = xMousePos;
+	gLastY = yMousePos;
+	gViewDirty = true;
+
+	// move the 3D camera according to the calculated offsets,
+	// through the simulation thread while it owns the camera
+	if ((g_pSimulation != nullptr) && (g_pSimulation->IsRunning() == true))
+	{
+		g_pSimulation->AddMouseMovement(xOffset, yOffset);
+	}
+	else
+	{
+		g_pCamera->ProcessMouseMovement(xOffset, yOffset);
+	}
+}
+
+/***********************************************************
+ *  Key_Callback()
+ *
+ *  This method is automatically called from GLFW whenever
+ *  a key is pressed, repeated or released. The keys are read
+ *  in ProcessKeyboardEvents(), so this only marks the view
+ *  as changed, which wakes up the on-demand rendering.
+ ***********************************************************/
+void ViewManager::Key_Callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+	gViewDirty = true;
+}
+
+/***********************************************************
+ *  Window_Refresh_Callback()
+ *
+ *  This method is automatically called from GLFW whenever
+ *  the contents of the window have to be drawn again, such
+ *  as after it was uncovered or resized.
+ ***********************************************************/
+void ViewManager::Window_Refresh_Callback(GLFWwindow* window)
+{
+	gViewDirty = true;
+}
+
+/***********************************************************
+ *  IsViewDirty()
+ *
+ *  This method is used for checking whether a new frame is
+ *  needed for the input, the camera or the window. A camera
+ *  moved by the simulation thread after the input stopped
+ *  counts as well.
+ ***********************************************************/
+bool ViewManager::IsViewDirty() const
+{
+	return((gViewDirty == true) ||
+		((IsSimulationThreadRunning() == true) && (g_pSimulation->HasCameraMoved() == true)));
+}
+
+/***********************************************************
+ *  ProcessKeyboardEvents()
+ *
+ *  This method is called to process any keyboard events
+ *  that may be waiting in the event queue.
+ ***********************************************************/
+void ViewManager::ProcessKeyboardEvents()
+{
+	// close the window if the escape key has been pressed
+	if (glfwGetKey(m_pWindow, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+	{
+		glfwSetWindowShouldClose(m_pWindow, true);
+	}
+
+	// Toggle between orthographic and perspective views
+	if (glfwGetKey(m_pWindow, GLFW_KEY_P) == GLFW_PRESS) {
+		bOrthographicView = false; // Switch to perspective view
+		gViewDirty = true;
+	}
+	if (glfwGetKey(m_pWindow, GLFW_KEY_O) == GLFW_PRESS) {
+		bOrthographicView = true; // Switch to orthographic view
+		gViewDirty = true;
+	}
+
+	// if the camera object is null, then exit this method
+	if (NULL == g_pCamera)
+	{
+		return;
+	}
+
+	// the simulation thread moves the camera by the held keys
+	// itself, at its own fixed step
+	if (IsSimulationThreadRunning() == true)
+	{
+		unsigned int heldMovement = 0;
+		if (glfwGetKey(m_pWindow, GLFW_KEY_W) == GLFW_PRESS)
+		{
+			heldMovement |= (1u << FORWARD);
+		}
+		if (glfwGetKey(m_pWindow, GLFW_KEY_S) == GLFW_PRESS)
+		{
+			heldMovement |= (1u << BACKWARD);
+		}
+		if (glfwGetKey(m_pWindow, GLFW_KEY_A) == GLFW_PRESS)
+		{
+			heldMovement |= (1u << LEFT);
+		}
+		if (glfwGetKey(m_pWindow, GLFW_KEY_D) == GLFW_PRESS)
+		{
+			heldMovement |= (1u << RIGHT);
+		}
+		if (glfwGetKey(m_pWindow, GLFW_KEY_Q) == GLFW_PRESS)
+		{
+			heldMovement |= (1u << UP);
+		}
+		if (glfwGetKey(m_pWindow, GLFW_KEY_E) == GLFW_PRESS)
+		{
+			heldMovement |= (1u << DOWN);
+		}
+		g_pSimulation->SetHeldMovement(heldMovement);
+		if (heldMovement != 0)
+		{
+			gViewDirty = true;
+		}
+		return;
+	}
+
+	// process camera zooming in and out
+	if (glfwGetKey(m_pWindow, GLFW_KEY_W) == GLFW_PRESS)
+	{
+		g_pCamera->ProcessKeyboard(FORWARD, gDeltaTime);
+		gViewDirty = true;
+	}
+	if (glfwGetKey(m_pWindow, GLFW_KEY_S) == GLFW_PRESS)
+	{
+		g_pCamera->ProcessKeyboard(BACKWARD, gDeltaTime);
+		gViewDirty = true;
+	}
+
+	// process camera panning left and right
+	if (glfwGetKey(m_pWindow, GLFW_KEY_A) == GLFW_PRESS)
+	{
+		g_pCamera->ProcessKeyboard(LEFT, gDeltaTime);
+		gViewDirty = true;
+	}
+	if (glfwGetKey(m_pWindow, GLFW_KEY_D) == GLFW_PRESS)
+	{
+		g_pCamera->ProcessKeyboard(RIGHT, gDeltaTime);
+		gViewDirty = true;
+	}
+	if (glfwGetKey(m_pWindow, GLFW_KEY_Q) == GLFW_PRESS)
+	{
+		g_pCamera->ProcessKeyboard(UP, gDeltaTime);
+		gViewDirty = true;
+	}
+	if (glfwGetKey(m_pWindow, GLFW_KEY_E) == GLFW_PRESS)
+	{
+		g_pCamera->ProcessKeyboard(DOWN, gDeltaTime);
+		gViewDirty = true;
+	}
+}
+
+/***********************************************************
+ *  SetScriptedCamera()
+ *
+ *  This method is used for switching the camera between the
+ *  keyboard and mouse input and being placed from code,
+ *  which stops the simulation thread.
+ ***********************************************************/
+void ViewManager::SetScriptedCamera(bool bScripted)
+{
+	// code placing the camera takes it back from the thread
+	if (bScripted == true)
+	{
+		StopSimulationThread();
+	}
+	m_bScriptedCamera = bScripted;
+	bIgnoreMouse = bScripted;
+	gFirstMouse = true;
+}
+
+/***********************************************************
+ *  SetCameraPose()
+ *
+ *  This method is used for placing the camera at the passed
+ *  in position, looking at the passed in target.
+ ***********************************************************/
+void ViewManager::SetCameraPose(const glm::vec3& position, const glm::vec3& target)
+{
+	if ((NULL == g_pCamera) || (IsSimulationThreadRunning() == true))
+	{
+		return;
+	}
+
+	g_pCamera->Position = position;
+	if (glm::length(target - position) > 0.0f)
+	{
+		g_pCamera->Front = glm::normalize(target - position);
+	}
+}
+
+/***********************************************************
+ *  StartSimulationThread()
+ *
+ *  This method is used for handing the camera to a thread
+ *  that moves it in fixed steps at the passed in rate. From
+ *  then on the input is passed to the thread and the view is
+ *  built from the camera it publishes.
+ ***********************************************************/
+void ViewManager::StartSimulationThread(double stepsPerSecond)
+{
+	if ((NULL == g_pCamera) || (m_bScriptedCamera == true))
+	{
+		return;
+	}
+
+	if (NULL == g_pSimulation)
+	{
+		g_pSimulation = new SimulationThread();
+	}
+	g_pSimulation->Start(g_pCamera, stepsPerSecond);
+}
+
+/***********************************************************
+ *  StopSimulationThread()
+ *
+ *  This method is used for stopping the simulation thread,
+ *  so the camera is moved once per frame again.
+ ***********************************************************/
+void ViewManager::StopSimulationThread()
+{
+	if (NULL != g_pSimulation)
+	{
+		g_pSimulation->Stop();
+	}
+}
+
+/***********************************************************
+ *  IsSimulationThreadRunning()
+ *
+ *  This method is used for checking whether the camera is
+ *  moved by the simulation thread.
+ ***********************************************************/
+bool ViewManager::IsSimulationThreadRunning() const
+{
+	return((NULL != g_pSimulation) && (g_pSimulation->IsRunning() == true));
+}
+
+/***********************************************************
+ *  PrepareSceneView()
+ *
+ *  This method is used for preparing the 3D scene by loading
+ *  the shapes, textures in memory to support the 3D scene 
+ *  rendering
+ ***********************************************************/
+void ViewManager::PrepareSceneView()
+{
+	glm::mat4 view;
+	glm::mat4 projection;
+
+	// the changes so far are taken into this view, the input
+	// below and a moving camera mark it again
+	gViewDirty = false;
+	if (IsSimulationThreadRunning() == true)
+	{
+		g_pSimulation->ClearCameraMoved();
+	}
+
+	// per-frame timing
+	float currentFrame = glfwGetTime();
+	gDeltaTime = std::min(currentFrame - gLastFrame, g_MaxDeltaTime);
+	gLastFrame = currentFrame;
+
+	// process any keyboard events that may be waiting in the 
+	// event queue, unless the camera is placed from code
+	if (m_bScriptedCamera == false)
+	{
+		ProcessKeyboardEvents();
+	}
+
+	// get the current view matrix from the camera, or from the
+	// camera blended between the last two simulation steps -
+	// the simulation thread owns the camera while it runs, so
+	// the camera is only read when the thread is stopped
+	glm::vec3 viewPosition;
+	float zoom;
+	if (IsSimulationThreadRunning() == true)
+	{
+		SimulationThread::CAMERA_STATE state = g_pSimulation->GetCameraState();
+		view = glm::lookAt(state.position, state.position + state.front, state.up);
+		viewPosition = state.position;
+		zoom = state.zoom;
+	}
+	else
+	{
+		view = g_pCamera->GetViewMatrix();
+		viewPosition = g_pCamera->Position;
+		zoom = g_pCamera->Zoom;
+	}
+
+	// Define the projection matrix based on the current view mode
+	if (bOrthographicView) {
+		// Set up orthographic projection
+		float orthoSize = 10.0f; // Adjust this value based on the scene size
+		projection = glm::ortho(-orthoSize, orthoSize, -orthoSize, orthoSize, 0.1f, 100.0f);
+	}
+	else {
+		// Set up perspective projection, for the shape of the
+		// part of the window the camera is drawn into
+		GLfloat aspect = ((GLfloat)WINDOW_WIDTH * m_mainViewport.width) / ((GLfloat)WINDOW_HEIGHT * m_mainViewport.height);
+		projection = glm::perspective(glm::radians(zoom), aspect, 0.1f, 100.0f);
+	}
+
+	// a camera that is still moving, such as between the steps
+	// of the simulation thread, needs the frame after this too
+	if ((memcmp(&view, &m_viewMatrix, sizeof(glm::mat4)) != 0) ||
+		(memcmp(&projection, &m_projectionMatrix, sizeof(glm::mat4)) != 0))
+	{
+		gViewDirty = true;
+	}
+
+	// keep the view values for the scene rendering
+	m_viewMatrix = view;
+	m_projectionMatrix = projection;
+	m_viewPosition = viewPosition;
+
+	// the interactive camera comes first, followed by the
+	// fixed cameras in the order they were added
+	m_cameraViews.resize(1 + m_fixedCameras.size());
+	m_cameraViews[0].view = view;
+	m_cameraViews[0].projection = projection;
+	m_cameraViews[0].viewPosition = viewPosition;
+	GetViewportPixels(m_mainViewport, m_cameraViews[0]);
+	for (int i = 0; i < m_fixedCameras.size(); i++)
+	{
+		const FIXED_CAMERA& camera = m_fixedCameras[i];
+		CAMERA_VIEW& cameraView = m_cameraViews[i + 1];
+		GetViewportPixels(camera.viewport, cameraView);
+
+		GLfloat aspect = (GLfloat)cameraView.viewportWidth / (GLfloat)std::max(cameraView.viewportHeight, 1);
+		cameraView.view = glm::lookAt(camera.position, camera.target, camera.up);
+		if (camera.orthographicSize > 0.0f)
+		{
+			float size = camera.orthographicSize;
+			cameraView.projection = glm::ortho(-size * aspect, size * aspect, -size, size, 0.1f, 100.0f);
+		}
+		else
+		{
+			cameraView.projection = glm::perspective(glm::radians(45.0f), aspect, 0.1f, 100.0f);
+		}
+		cameraView.viewPosition = camera.position;
+	}
+
+	// if the shader manager object is valid
+	if (NULL != m_pShaderManager)
+	{
+		// set the view matrix into the shader for proper rendering
+		m_pShaderManager->setMat4Value(g_ViewName, view);
+		// set the view matrix into the shader for proper rendering
+		m_pShaderManager->setMat4Value(g_ProjectionName, projection);
+		// set the view position of the camera into the shader for proper rendering
+		m_pShaderManager->setVec3Value("viewPosition", viewPosition);
+	}
+}
+
+/***********************************************************
+ *  SetMainViewport()
+ *
+ *  This method is used for setting the part of the window
+ *  that the interactive camera is drawn into, leaving the
+ *  rest of it to the fixed cameras.
+ ***********************************************************/
+void ViewManager::SetMainViewport(const VIEWPORT_RECT& viewport)
+{
+	m_mainViewport = viewport;
+	gViewDirty = true;
+}
+
+/***********************************************************
+ *  AddFixedCamera()
+ *
+ *  This method is used for adding a camera that looks from a
+ *  position at a target and never moves, such as a floor
+ *  plan from above. It is orthographic when the passed in
+ *  size is above 0, showing twice that size from bottom to
+ *  top, and perspective otherwise.
+ ***********************************************************/
+void ViewManager::AddFixedCamera(
+	const glm::vec3& position,
+	const glm::vec3& target,
+	const glm::vec3& up,
+	float orthographicSize,
+	const VIEWPORT_RECT& viewport)
+{
+	FIXED_CAMERA camera;
+	camera.position = position;
+	camera.target = target;
+	camera.up = up;
+	camera.orthographicSize = orthographicSize;
+	camera.viewport = viewport;
+	m_fixedCameras.push_back(camera);
+	gViewDirty = true;
+}
+
+/***********************************************************
+ *  GetViewportPixels()
+ *
+ *  This method is used for working out the pixels of the
+ *  window that a viewport covers, from the framebuffer size
+ *  so that it also fits a high DPI display.
+ ***********************************************************/
+void ViewManager::GetViewportPixels(const VIEWPORT_RECT& viewport, CAMERA_VIEW& cameraView) const
+{
+	int framebufferWidth = WINDOW_WIDTH;
+	int framebufferHeight = WINDOW_HEIGHT;
+	if (NULL != m_pWindow)
+	{
+		glfwGetFramebufferSize(m_pWindow, &framebufferWidth, &framebufferHeight);
+	}
+
+	cameraView.viewportX = (int)(viewport.x * framebufferWidth + 0.5f);
+	cameraView.viewportY = (int)(viewport.y * framebufferHeight + 0.5f);
+	cameraView.viewportWidth = (int)((viewport.x + viewport.width) * framebufferWidth + 0.5f) - cameraView.viewportX;
+	cameraView.viewportHeight = (int)((viewport.y + viewport.height) * framebufferHeight + 0.5f) - cameraView.viewportY;
 }
\ No newline at end of file
@@ -1,45 +1,141 @@
-///////////////////////////////////////////////////////////////////////////////
-// viewmanager.h
-// ============
-// manage the viewing of 3D objects within the viewport
-//
-//  AUTHOR: Brian Battersby - SNHU Instructor / Computer Science
-//	Created for CS-330-Computational Graphics and Visualization, Nov. 1st, 2023
-///////////////////////////////////////////////////////////////////////////////
-
-#pragma once
-
-#include "ShaderManager.h"
-#include "camera.h"
-
-// GLFW library
-#include "GLFW/glfw3.h" 
-
-class ViewManager
-{
-public:
-	// constructor
-	ViewManager(
-		ShaderManager* pShaderManager);
-	// destructor
-	~ViewManager();
-
-	// mouse position callback for mouse interaction with the 3D scene
-	static void Mouse_Position_Callback(GLFWwindow* window, double xMousePos, double yMousePos);
-
-private:
-	// pointer to shader manager object
-	ShaderManager* m_pShaderManager;
-	// active OpenGL display window
-	GLFWwindow* m_pWindow;
-
-	// process keyboard events for interaction with the 3D scene
-	void ProcessKeyboardEvents();
-
-public:
-	// create the initial OpenGL display window
-	GLFWwindow* CreateDisplayWindow(const char* windowTitle);
-	
-	// prepare the conversion from 3D object display to 2D scene display
-	void PrepareSceneView();
+///////////////////////////////////////////////////////////////////////////////
+// viewmanager.h
+// ============
+// manage the viewing of 3D objects within the viewport
+//
+//  AUTHOR: Brian Battersby - SNHU Instructor / Computer Science
+//	Created for CS-330-Computational Graphics and Visualization, Nov. 1st, 2023
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ShaderManager.h"
+#include "camera.h"
+
+// GLFW library
+#include "GLFW/glfw3.h" 
+
+#include <vector>
+
+class ViewManager
+{
+public:
+	// constructor
+	ViewManager(
+		ShaderManager* pShaderManager);
+	// destructor
+	~ViewManager();
+
+	// mouse position callback for mouse interaction with the 3D scene
+	static void Mouse_Position_Callback(GLFWwindow* window, double xMousePos, double yMousePos);
+	// key and window refresh callbacks, which only mark the
+	// view as changed
+	static void Key_Callback(GLFWwindow* window, int key, int scancode, int action, int mods);
+	static void Window_Refresh_Callback(GLFWwindow* window);
+
+	// part of the window a camera is drawn into, as fractions
+	// of the window from its bottom left corner
+	struct VIEWPORT_RECT
+	{
+		float x;
+		float y;
+		float width;
+		float height;
+	};
+
+	// values of one camera prepared by PrepareSceneView(), and
+	// the pixels of the window it is drawn into
+	struct CAMERA_VIEW
+	{
+		glm::mat4 view;
+		glm::mat4 projection;
+		glm::vec3 viewPosition;
+		int viewportX;
+		int viewportY;
+		int viewportWidth;
+		int viewportHeight;
+	};
+
+private:
+	// camera that stays where it was placed, such as a floor
+	// plan shown next to the interactive camera
+	struct FIXED_CAMERA
+	{
+		glm::vec3 position;
+		glm::vec3 target;
+		glm::vec3 up;
+		// half the height shown by an orthographic projection,
+		// or 0 for a perspective projection
+		float orthographicSize;
+		VIEWPORT_RECT viewport;
+	};
+
+	// pointer to shader manager object
+	ShaderManager* m_pShaderManager;
+	// active OpenGL display window
+	GLFWwindow* m_pWindow;
+	// view and projection of the last prepared scene view
+	glm::mat4 m_viewMatrix;
+	glm::mat4 m_projectionMatrix;
+	glm::vec3 m_viewPosition;
+	// true while the camera is placed by SetCameraPose()
+	// instead of the keyboard and mouse
+	bool m_bScriptedCamera;
+	// part of the window the interactive camera is drawn into
+	VIEWPORT_RECT m_mainViewport;
+	std::vector<FIXED_CAMERA> m_fixedCameras;
+	// every camera of the last prepared scene view, the
+	// interactive one first
+	std::vector<CAMERA_VIEW> m_cameraViews;
+
+	// work out the pixels of the window a viewport covers
+	void GetViewportPixels(const VIEWPORT_RECT& viewport, CAMERA_VIEW& cameraView) const;
+
+	// process keyboard events for interaction with the 3D scene
+	void ProcessKeyboardEvents();
+
+public:
+	// create the initial OpenGL display window
+	GLFWwindow* CreateDisplayWindow(const char* windowTitle);
+	
+	// prepare the conversion from 3D object display to 2D scene display
+	void PrepareSceneView();
+
+	// place the camera from code only, ignoring the keyboard
+	// and mouse input
+	void SetScriptedCamera(bool bScripted);
+	// place the camera at a position, looking at a target
+	void SetCameraPose(const glm::vec3& position, const glm::vec3& target);
+
+	// move the camera in fixed steps on a thread of its own,
+	// with the keyboard and mouse input passed to it
+	void StartSimulationThread(double stepsPerSecond);
+	void StopSimulationThread();
+	bool IsSimulationThreadRunning() const;
+
+	// true when the input or the camera has changed the view
+	// since the last PrepareSceneView(), or the window has to
+	// be drawn again
+	bool IsViewDirty() const;
+
+	// set the part of the window the interactive camera is
+	// drawn into
+	void SetMainViewport(const VIEWPORT_RECT& viewport);
+	// add a camera that stays where it is placed, drawn into
+	// its own part of the window after the interactive camera
+	void AddFixedCamera(
+		const glm::vec3& position,
+		const glm::vec3& target,
+		const glm::vec3& up,
+		float orthographicSize,
+		const VIEWPORT_RECT& viewport);
+
+	// get the values computed by the last PrepareSceneView()
+	const glm::mat4& GetViewMatrix() const { return(m_viewMatrix); }
+	const glm::mat4& GetProjectionMatrix() const { return(m_projectionMatrix); }
+	const glm::vec3& GetViewPosition() const { return(m_viewPosition); }
+	// get every camera of the last PrepareSceneView(), the
+	// interactive one first
+	int GetCameraViewCount() const { return((int)m_cameraViews.size()); }
+	const CAMERA_VIEW& GetCameraView(int index) const { return(m_cameraViews[index]); }
 };
\ No newline at end of file
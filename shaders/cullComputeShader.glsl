@@ -0,0 +1,226 @@
+///////////////////////////////////////////////////////////////////////////////
+// cullComputeShader.glsl
+// ============
+// test every instance against the view frustum and the depth pyramid of the
+// last frame, and compact the visible ones into the indirect draw commands
+//
+///////////////////////////////////////////////////////////////////////////////
+#version 440 core
+
+layout (local_size_x = 64) in;
+
+// matches InstancedMeshes::INSTANCE_DATA
+struct INSTANCE_DATA
+{
+	mat4 model;
+	vec4 color;
+	vec2 uvScale;
+	int materialIndex;
+	int textureLayer;
+};
+
+// matches GpuCuller::CULL_BATCH
+struct CULL_BATCH
+{
+	uint firstInstance;
+	uint instanceCount;
+	uint command;
+	uint flags;
+};
+
+// flags of a batch, the low bits are the mesh type
+const uint BATCH_MESH_MASK = 0xFFu;
+const uint BATCH_TRANSPARENT = 0x100u;
+// words in one indirect draw command
+const uint COMMAND_WORDS = 5u;
+const uint COMMAND_INSTANCE_COUNT = 1u;
+
+const int MESH_COUNT = 7;
+
+layout (std430, binding = 0) readonly buffer SourceInstances
+{
+	INSTANCE_DATA sourceInstances[];
+};
+
+layout (std430, binding = 1) writeonly buffer CulledInstances
+{
+	INSTANCE_DATA culledInstances[];
+};
+
+layout (std430, binding = 2) buffer DrawCommands
+{
+	uint commandWords[];
+};
+
+layout (std430, binding = 3) readonly buffer CullBatches
+{
+	CULL_BATCH batches[];
+};
+
+layout (std430, binding = 4) buffer CullCounters
+{
+	uint visibleInstanceCount;
+};
+
+uniform uint instanceCount;
+uniform uint batchCount;
+// local bounding box of each mesh type
+uniform vec4 meshCenters[MESH_COUNT];
+uniform vec4 meshExtents[MESH_COUNT];
+// clip planes of the current view, xyz = inward normal
+uniform vec4 frustumPlanes[6];
+uniform bool bFrustumTest;
+// count the visible instances for the CPU to read back
+uniform bool bCountVisible;
+// depth pyramid of the last frame and the view it was drawn with
+uniform bool bOcclusionTest;
+uniform mat4 occlusionViewProjection;
+uniform sampler2D depthPyramid;
+uniform int pyramidLevelCount;
+
+/***********************************************************
+ *  FindBatch()
+ *
+ *  find the batch holding the passed in instance, the
+ *  batches are sorted by their first instance
+ ***********************************************************/
+uint FindBatch(uint instance)
+{
+	uint low = 0u;
+	uint high = batchCount - 1u;
+	while (low < high)
+	{
+		uint middle = (low + high + 1u) / 2u;
+		if (batches[middle].firstInstance <= instance)
+		{
+			low = middle;
+		}
+		else
+		{
+			high = middle - 1u;
+		}
+	}
+	return(low);
+}
+
+/***********************************************************
+ *  IsInsideFrustum()
+ *
+ *  true when any part of the world space box may be inside
+ *  the view frustum
+ ***********************************************************/
+bool IsInsideFrustum(vec3 center, vec3 extent)
+{
+	for (int i = 0; i < 6; i++)
+	{
+		vec4 plane = frustumPlanes[i];
+		float distance = dot(plane.xyz, center) + plane.w;
+		float reach = dot(abs(plane.xyz), extent);
+		if (distance + reach < 0.0)
+		{
+			return(false);
+		}
+	}
+	return(true);
+}
+
+/***********************************************************
+ *  IsOccluded()
+ *
+ *  true when the world space box is behind the depth of the
+ *  last frame everywhere it covers on the screen
+ ***********************************************************/
+bool IsOccluded(vec3 center, vec3 extent)
+{
+	vec3 ndcMin = vec3(1.0);
+	vec3 ndcMax = vec3(-1.0);
+	for (int corner = 0; corner < 8; corner++)
+	{
+		vec3 offset = vec3(
+			((corner & 1) != 0) ? 1.0 : -1.0,
+			((corner & 2) != 0) ? 1.0 : -1.0,
+			((corner & 4) != 0) ? 1.0 : -1.0);
+		vec4 clip = occlusionViewProjection * vec4(center + offset * extent, 1.0);
+		// a box crossing the near plane cannot be tested
+		if (clip.w <= 0.0)
+		{
+			return(false);
+		}
+		vec3 ndc = clip.xyz / clip.w;
+		ndcMin = min(ndcMin, ndc);
+		ndcMax = max(ndcMax, ndc);
+	}
+
+	vec2 uvMin = clamp(ndcMin.xy * 0.5 + 0.5, 0.0, 1.0);
+	vec2 uvMax = clamp(ndcMax.xy * 0.5 + 0.5, 0.0, 1.0);
+	float nearestDepth = ndcMin.z * 0.5 + 0.5;
+
+	// pick the level where the box covers at most 2x2 texels
+	vec2 size = vec2(textureSize(depthPyramid, 0));
+	vec2 extentPixels = (uvMax - uvMin) * size;
+	int level = int(ceil(log2(max(max(extentPixels.x, extentPixels.y), 1.0))));
+	level = clamp(level, 0, pyramidLevelCount - 1);
+
+	ivec2 levelSize = textureSize(depthPyramid, level);
+	ivec2 texelMin = clamp(ivec2(uvMin * vec2(levelSize)), ivec2(0), levelSize - 1);
+	ivec2 texelMax = clamp(ivec2(uvMax * vec2(levelSize)), ivec2(0), levelSize - 1);
+
+	float farthestDepth = max(
+		max(texelFetch(depthPyramid, texelMin, level).r, texelFetch(depthPyramid, ivec2(texelMax.x, texelMin.y), level).r),
+		max(texelFetch(depthPyramid, ivec2(texelMin.x, texelMax.y), level).r, texelFetch(depthPyramid, texelMax, level).r));
+
+	return(nearestDepth > farthestDepth);
+}
+
+void main()
+{
+	uint instance = gl_GlobalInvocationID.x;
+	if ((instance >= instanceCount) || (batchCount == 0u))
+	{
+		return;
+	}
+
+	CULL_BATCH batch = batches[FindBatch(instance)];
+	INSTANCE_DATA source = sourceInstances[instance];
+
+	// world space box of the transformed mesh, the same way
+	// as the bounds of the render items are worked out
+	uint mesh = min(batch.flags & BATCH_MESH_MASK, uint(MESH_COUNT - 1));
+	vec3 center = vec3(source.model * vec4(meshCenters[mesh].xyz, 1.0));
+	vec3 extent =
+		abs(source.model[0].xyz) * meshExtents[mesh].x +
+		abs(source.model[1].xyz) * meshExtents[mesh].y +
+		abs(source.model[2].xyz) * meshExtents[mesh].z;
+
+	bool bVisible = true;
+	if (bFrustumTest == true)
+	{
+		bVisible = IsInsideFrustum(center, extent);
+	}
+	if ((bVisible == true) && (bOcclusionTest == true))
+	{
+		bVisible = (IsOccluded(center, extent) == false);
+	}
+	if ((bVisible == true) && (bCountVisible == true))
+	{
+		atomicAdd(visibleInstanceCount, 1u);
+	}
+
+	// transparent instances keep their back to front slot, a
+	// hidden one is collapsed to a point instead of removed
+	if ((batch.flags & BATCH_TRANSPARENT) != 0u)
+	{
+		if (bVisible == false)
+		{
+			source.model = mat4(0.0);
+		}
+		culledInstances[instance] = source;
+		return;
+	}
+
+	if (bVisible == true)
+	{
+		uint slot = atomicAdd(commandWords[batch.command * COMMAND_WORDS + COMMAND_INSTANCE_COUNT], 1u);
+		culledInstances[batch.firstInstance + slot] = source;
+	}
+}
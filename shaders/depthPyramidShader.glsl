@@ -0,0 +1,58 @@
+///////////////////////////////////////////////////////////////////////////////
+// depthPyramidShader.glsl
+// ============
+// build one level of the depth pyramid, each texel holding the farthest depth
+// of the texels it covers in the level below
+//
+///////////////////////////////////////////////////////////////////////////////
+#version 440 core
+
+layout (local_size_x = 8, local_size_y = 8) in;
+
+// depth buffer copy, only read for the first level
+uniform sampler2D depthTexture;
+layout (r32f, binding = 0) uniform readonly image2D sourceLevel;
+layout (r32f, binding = 1) uniform writeonly image2D destinationLevel;
+
+// true when the first level is copied from the depth buffer
+uniform bool bFromDepth;
+
+void main()
+{
+	ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+	ivec2 destinationSize = imageSize(destinationLevel);
+	if ((texel.x >= destinationSize.x) || (texel.y >= destinationSize.y))
+	{
+		return;
+	}
+
+	if (bFromDepth == true)
+	{
+		imageStore(destinationLevel, texel, vec4(texelFetch(depthTexture, texel, 0).r));
+		return;
+	}
+
+	// an odd sized level folds its last row and column into
+	// the texels before them, so nothing is skipped
+	ivec2 sourceSize = imageSize(sourceLevel);
+	ivec2 first = texel * 2;
+	ivec2 last = first + 1;
+	if (texel.x == destinationSize.x - 1)
+	{
+		last.x = sourceSize.x - 1;
+	}
+	if (texel.y == destinationSize.y - 1)
+	{
+		last.y = sourceSize.y - 1;
+	}
+
+	float depth = 0.0;
+	for (int y = first.y; y <= last.y; y++)
+	{
+		for (int x = first.x; x <= last.x; x++)
+		{
+			depth = max(depth, imageLoad(sourceLevel, ivec2(x, y)).r);
+		}
+	}
+	imageStore(destinationLevel, texel, vec4(depth));
+}
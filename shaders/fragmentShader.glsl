@@ -0,0 +1,216 @@
+///////////////////////////////////////////////////////////////////////////////
+// fragmentShader.glsl
+// ============
+// shade the mesh fragments with the object color or texture and the
+// Phong lighting of the scene light sources, shadowed by their cube maps,
+// either looping over the light block or over the lights of the cluster
+// the fragment is in
+//
+///////////////////////////////////////////////////////////////////////////////
+#version 440 core
+
+// these must match the limits in SceneManager.cpp
+#define MAX_LIGHTS 64
+#define MAX_MATERIALS 256
+// these must match LightClusters.h
+#define CLUSTER_GRID_X 16
+#define CLUSTER_GRID_Y 9
+#define CLUSTER_GRID_Z 24
+#define MAX_CLUSTER_LIGHTS 64
+
+struct Material
+{
+	// xyz = ambient color, w = ambient strength
+	vec4 ambientColorStrength;
+	// xyz = diffuse color, w = shininess
+	vec4 diffuseColorShininess;
+	vec4 specularColor;
+};
+
+struct LightSource
+{
+	// xyz = position, w = focal strength
+	vec4 positionFocal;
+	vec4 ambientColor;
+	// xyz = diffuse color, w = range, 0 for no falloff
+	vec4 diffuseColorRange;
+	// xyz = specular color, w = specular intensity
+	vec4 specularColorIntensity;
+};
+
+layout (std140) uniform LightBlock
+{
+	int lightCount;
+	LightSource lightSources[MAX_LIGHTS];
+};
+
+layout (std140) uniform MaterialBlock
+{
+	Material materials[MAX_MATERIALS];
+};
+
+// every light source of the scene, and the light count followed by
+// the light indices of every cluster
+layout (std430, binding = 4) readonly buffer LightBuffer
+{
+	LightSource clusteredLights[];
+};
+
+layout (std430, binding = 5) readonly buffer ClusterBuffer
+{
+	uint clusterWords[];
+};
+
+in vec3 fragmentPosition;
+in vec3 fragmentVertexNormal;
+in vec2 fragmentTextureCoordinate;
+in vec4 fragmentColor;
+in vec2 fragmentUVscale;
+flat in int fragmentMaterialIndex;
+flat in int fragmentTextureLayer;
+
+out vec4 outFragmentColor;
+
+uniform bool bUseTexture = false;
+uniform bool bUseLighting = false;
+// array texture holding the object texture, as one of its layers
+uniform sampler2DArray objectTexture;
+uniform vec3 viewPosition;
+// true while only the depth of the objects is drawn, for the
+// depth pre-pass and the shadow maps
+uniform bool bDepthOnly = false;
+// depth cube maps of the first shadowLightCount light sources,
+// drawn with the near and far plane of shadowDepthRange
+uniform bool bUseShadows = false;
+uniform samplerCubeArrayShadow shadowMaps;
+uniform int shadowLightCount = 0;
+uniform vec2 shadowDepthRange = vec2(0.1f, 100.0f);
+// true when only the lights of the fragment's cluster are evaluated,
+// with the viewport the clusters are laid over and the scale and bias
+// turning the log of the view depth into a depth slice
+uniform bool bUseClusters = false;
+uniform mat4 view;
+uniform vec4 clusterViewport;
+uniform vec2 clusterSliceScaleBias;
+
+// index of the cluster the fragment is in
+uint FindCluster()
+{
+	vec2 tile = (gl_FragCoord.xy - clusterViewport.xy) / clusterViewport.zw * vec2(CLUSTER_GRID_X, CLUSTER_GRID_Y);
+	uvec2 xy = uvec2(clamp(tile, vec2(0.0f), vec2(CLUSTER_GRID_X - 1, CLUSTER_GRID_Y - 1)));
+
+	float viewDepth = -(view * vec4(fragmentPosition, 1.0f)).z;
+	float slice = log(max(viewDepth, 1.0e-4f)) * clusterSliceScaleBias.x - clusterSliceScaleBias.y;
+	uint z = uint(clamp(slice, 0.0f, float(CLUSTER_GRID_Z - 1)));
+
+	return((z * uint(CLUSTER_GRID_Y) + xy.y) * uint(CLUSTER_GRID_X) + xy.x);
+}
+
+// part of the light source at the passed in index that reaches
+// the fragment, blended from the four nearest shadow map texels
+float CalculateShadow(int lightIndex, vec3 lightPosition)
+{
+	if ((bUseShadows == false) || (lightIndex >= shadowLightCount))
+	{
+		return(1.0f);
+	}
+
+	// the cube face a direction is looked up in is the one of its
+	// largest axis, which is the view depth on that face as well
+	vec3 lightToFragment = fragmentPosition - lightPosition;
+	vec3 distances = abs(lightToFragment);
+	float faceDepth = max(distances.x, max(distances.y, distances.z));
+	float nearPlane = shadowDepthRange.x;
+	float farPlane = shadowDepthRange.y;
+	if (faceDepth >= farPlane)
+	{
+		return(1.0f);
+	}
+
+	// the window depth the face projection stored for that distance
+	float depth = (farPlane + nearPlane) / (farPlane - nearPlane) -
+		(2.0f * farPlane * nearPlane) / ((farPlane - nearPlane) * faceDepth);
+	depth = depth * 0.5f + 0.5f;
+
+	return(texture(shadowMaps, vec4(lightToFragment, float(lightIndex)), depth));
+}
+
+vec3 CalculateLightSource(LightSource light, Material material, vec3 normal, vec3 viewDirection, float shadow)
+{
+	vec3 ambient = light.ambientColor.rgb * material.ambientColorStrength.rgb * material.ambientColorStrength.w;
+
+	// a light with a range fades out smoothly to nothing at it,
+	// so leaving it out of the clusters past it changes nothing
+	vec3 lightOffset = light.positionFocal.xyz - fragmentPosition;
+	float falloff = 1.0f;
+	if (light.diffuseColorRange.w > 0.0f)
+	{
+		float distanceRatio = length(lightOffset) / light.diffuseColorRange.w;
+		falloff = clamp(1.0f - pow(distanceRatio, 4.0f), 0.0f, 1.0f);
+		falloff *= falloff;
+	}
+
+	vec3 lightDirection = normalize(lightOffset);
+	float diffuseImpact = max(dot(normal, lightDirection), 0.0f);
+	vec3 diffuse = diffuseImpact * light.diffuseColorRange.rgb * material.diffuseColorShininess.rgb;
+
+	vec3 reflectDirection = reflect(-lightDirection, normal);
+	float specularComponent = pow(max(dot(viewDirection, reflectDirection), 0.0f), max(light.positionFocal.w, 1.0f));
+	vec3 specular = light.specularColorIntensity.w * material.diffuseColorShininess.w * specularComponent *
+		light.specularColorIntensity.rgb * material.specularColor.rgb;
+
+	// the ambient term stands in for bounced light, so shadows
+	// only take away the direct part
+	return(falloff * (ambient + shadow * (diffuse + specular)));
+}
+
+void main()
+{
+	// the color writes are masked, so nothing has to be shaded
+	if (bDepthOnly == true)
+	{
+		outFragmentColor = vec4(0.0f);
+		return;
+	}
+
+	vec4 baseColor = fragmentColor;
+	if (bUseTexture == true)
+	{
+		baseColor = texture(objectTexture, vec3(fragmentTextureCoordinate * fragmentUVscale, fragmentTextureLayer));
+	}
+
+	// objects without a valid material are drawn unlit
+	if ((bUseLighting == true) && (fragmentMaterialIndex >= 0) && (fragmentMaterialIndex < MAX_MATERIALS))
+	{
+		Material material = materials[fragmentMaterialIndex];
+		vec3 normal = normalize(fragmentVertexNormal);
+		vec3 viewDirection = normalize(viewPosition - fragmentPosition);
+		vec3 phongResult = vec3(0.0f);
+
+		if (bUseClusters == true)
+		{
+			uint firstWord = FindCluster() * uint(MAX_CLUSTER_LIGHTS + 1);
+			uint clusterLightCount = clusterWords[firstWord];
+			for (uint i = 0u; i < clusterLightCount; i++)
+			{
+				int lightIndex = int(clusterWords[firstWord + 1u + i]);
+				float shadow = CalculateShadow(lightIndex, clusteredLights[lightIndex].positionFocal.xyz);
+				phongResult += CalculateLightSource(clusteredLights[lightIndex], material, normal, viewDirection, shadow);
+			}
+		}
+		else
+		{
+			for (int i = 0; i < min(lightCount, MAX_LIGHTS); i++)
+			{
+				float shadow = CalculateShadow(i, lightSources[i].positionFocal.xyz);
+				phongResult += CalculateLightSource(lightSources[i], material, normal, viewDirection, shadow);
+			}
+		}
+
+		outFragmentColor = vec4(phongResult * baseColor.rgb, baseColor.a);
+	}
+	else
+	{
+		outFragmentColor = baseColor;
+	}
+}
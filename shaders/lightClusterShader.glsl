@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+// lightClusterShader.glsl
+// ============
+// list the light sources whose range reaches each view space cluster of the
+// frame, for the clustered lighting of the scene shader
+//
+///////////////////////////////////////////////////////////////////////////////
+#version 440 core
+
+// these must match LightClusters.h
+#define GRID_X 16
+#define GRID_Y 9
+#define GRID_Z 24
+#define MAX_CLUSTER_LIGHTS 64
+#define GROUP_SIZE 128
+
+layout (local_size_x = GROUP_SIZE) in;
+
+// matches LightClusters::LIGHT_DATA
+struct LightSource
+{
+	// xyz = position, w = focal strength
+	vec4 positionFocal;
+	vec4 ambientColor;
+	// xyz = diffuse color, w = range, 0 for no falloff
+	vec4 diffuseColorRange;
+	// xyz = specular color, w = specular intensity
+	vec4 specularColorIntensity;
+};
+
+layout (std430, binding = 4) readonly buffer LightBuffer
+{
+	LightSource lights[];
+};
+
+// the light count of every cluster followed by its light indices
+layout (std430, binding = 5) writeonly buffer ClusterBuffer
+{
+	uint clusterWords[];
+};
+
+uniform mat4 view;
+uniform mat4 inverseProjection;
+uniform int lightCount;
+// depth range the exponential slices cover, and the depth range
+// of the projection that the first and the last slice reach out to
+uniform vec2 sliceRange;
+uniform vec2 viewRange;
+
+// view space position and range of a round of lights, loaded once
+// for the whole work group
+shared vec4 groupLights[GROUP_SIZE];
+
+/***********************************************************
+ *  UnprojectToDepth()
+ *
+ *  get the view space point at the passed in depth in front
+ *  of the camera that lands on the passed in NDC position,
+ *  which works for perspective and orthographic projections
+ ***********************************************************/
+vec3 UnprojectToDepth(vec2 ndc, float depth)
+{
+	vec4 nearPoint = inverseProjection * vec4(ndc, -1.0f, 1.0f);
+	vec4 farPoint = inverseProjection * vec4(ndc, 1.0f, 1.0f);
+	nearPoint /= nearPoint.w;
+	farPoint /= farPoint.w;
+
+	// the camera looks down -z in view space
+	float t = (-depth - nearPoint.z) / (farPoint.z - nearPoint.z);
+	return(mix(nearPoint.xyz, farPoint.xyz, t));
+}
+
+void main()
+{
+	uint cluster = gl_GlobalInvocationID.x;
+	bool bActive = (cluster < uint(GRID_X * GRID_Y * GRID_Z));
+
+	// view space box around the part of the frustum the cluster
+	// covers, from its screen tile and its depth slice
+	uint x = cluster % uint(GRID_X);
+	uint y = (cluster / uint(GRID_X)) % uint(GRID_Y);
+	uint z = cluster / uint(GRID_X * GRID_Y);
+
+	vec2 ndcMin = vec2(x, y) / vec2(GRID_X, GRID_Y) * 2.0f - 1.0f;
+	vec2 ndcMax = vec2(x + 1u, y + 1u) / vec2(GRID_X, GRID_Y) * 2.0f - 1.0f;
+	float depthRatio = sliceRange.y / sliceRange.x;
+	float sliceNear = sliceRange.x * pow(depthRatio, float(z) / float(GRID_Z));
+	float sliceFar = sliceRange.x * pow(depthRatio, float(z + 1u) / float(GRID_Z));
+	if (z == 0u)
+	{
+		sliceNear = min(sliceNear, viewRange.x);
+	}
+	if (z == uint(GRID_Z - 1))
+	{
+		sliceFar = max(sliceFar, viewRange.y);
+	}
+
+	vec3 boxMin = vec3(1.0e30f);
+	vec3 boxMax = vec3(-1.0e30f);
+	for (int corner = 0; corner < 4; corner++)
+	{
+		vec2 ndc = vec2(((corner & 1) != 0) ? ndcMax.x : ndcMin.x, ((corner & 2) != 0) ? ndcMax.y : ndcMin.y);
+		vec3 nearPoint = UnprojectToDepth(ndc, sliceNear);
+		vec3 farPoint = UnprojectToDepth(ndc, sliceFar);
+		boxMin = min(boxMin, min(nearPoint, farPoint));
+		boxMax = max(boxMax, max(nearPoint, farPoint));
+	}
+
+	// every invocation loads one light of a round, then each
+	// cluster tests the whole round against its box
+	uint count = 0u;
+	uint firstWord = cluster * uint(MAX_CLUSTER_LIGHTS + 1);
+	for (int first = 0; first < lightCount; first += GROUP_SIZE)
+	{
+		int lightIndex = first + int(gl_LocalInvocationID.x);
+		if (lightIndex < lightCount)
+		{
+			LightSource light = lights[lightIndex];
+			groupLights[gl_LocalInvocationID.x] = vec4(
+				(view * vec4(light.positionFocal.xyz, 1.0f)).xyz,
+				light.diffuseColorRange.w);
+		}
+		barrier();
+
+		int roundCount = min(GROUP_SIZE, lightCount - first);
+		for (int i = 0; (i < roundCount) && (bActive == true); i++)
+		{
+			vec4 light = groupLights[i];
+
+			// lights without a range reach every cluster
+			bool bReaches = (light.w <= 0.0f);
+			if (bReaches == false)
+			{
+				vec3 offset = clamp(light.xyz, boxMin, boxMax) - light.xyz;
+				bReaches = (dot(offset, offset) <= light.w * light.w);
+			}
+
+			// a full cluster drops the lights after it, the
+			// lights without a range come first in the scene
+			if ((bReaches == true) && (count < uint(MAX_CLUSTER_LIGHTS)))
+			{
+				clusterWords[firstWord + 1u + count] = uint(first + i);
+				count++;
+			}
+		}
+		barrier();
+	}
+
+	if (bActive == true)
+	{
+		clusterWords[firstWord] = count;
+	}
+}
@@ -0,0 +1,66 @@
+///////////////////////////////////////////////////////////////////////////////
+// vertexShader.glsl
+// ============
+// transform the mesh vertices, either with the model uniform or with the
+// per-instance values of an instanced draw
+//
+///////////////////////////////////////////////////////////////////////////////
+#version 440 core
+
+// per-vertex values
+layout (location = 0) in vec3 inVertexPosition;
+layout (location = 1) in vec3 inVertexNormal;
+layout (location = 2) in vec2 inTextureCoordinate;
+
+// per-instance values, only read for instanced draws
+layout (location = 3) in mat4 inInstanceModel;
+layout (location = 7) in vec4 inInstanceColor;
+layout (location = 8) in vec2 inInstanceUVscale;
+layout (location = 9) in ivec2 inInstanceMaterialTexture;
+
+out vec3 fragmentPosition;
+out vec3 fragmentVertexNormal;
+out vec2 fragmentTextureCoordinate;
+out vec4 fragmentColor;
+out vec2 fragmentUVscale;
+flat out int fragmentMaterialIndex;
+flat out int fragmentTextureLayer;
+
+uniform bool bUseInstancing = false;
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec4 objectColor = vec4(1.0f);
+uniform vec2 UVscale = vec2(1.0f, 1.0f);
+uniform int materialIndex = -1;
+uniform int textureLayer = 0;
+
+// the depth pre-pass and the shaded pass after it must compute the
+// same depth for a vertex, or the shaded pass would fail its depth test
+invariant gl_Position;
+
+void main()
+{
+	mat4 modelMatrix = model;
+	fragmentColor = objectColor;
+	fragmentUVscale = UVscale;
+	fragmentMaterialIndex = materialIndex;
+	fragmentTextureLayer = textureLayer;
+
+	if (bUseInstancing == true)
+	{
+		modelMatrix = inInstanceModel;
+		fragmentColor = inInstanceColor;
+		fragmentUVscale = inInstanceUVscale;
+		fragmentMaterialIndex = inInstanceMaterialTexture.x;
+		// the baked static batches store a negative layer and set
+		// the current layer of their texture in the uniform
+		fragmentTextureLayer = (inInstanceMaterialTexture.y >= 0) ? inInstanceMaterialTexture.y : textureLayer;
+	}
+
+	gl_Position = projection * view * modelMatrix * vec4(inVertexPosition, 1.0f);
+
+	fragmentPosition = vec3(modelMatrix * vec4(inVertexPosition, 1.0f));
+	fragmentVertexNormal = mat3(transpose(inverse(modelMatrix))) * inVertexNormal;
+	fragmentTextureCoordinate = inTextureCoordinate;
+}